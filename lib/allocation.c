@@ -978,6 +978,75 @@ hw_alloc_assoc_set(const unsigned lcore,
         return ret;
 }
 
+int
+hw_alloc_assoc_set_many(const unsigned *cores,
+                        const unsigned num_cores,
+                        const unsigned class_id)
+{
+        const uint32_t reg = PQOS_MSR_ASSOC;
+        int ret = PQOS_RETVAL_OK;
+        unsigned num_l2_cos = 0, num_l3_cos = 0, i;
+        struct msr_batch rd, wr;
+
+        ASSERT(cores != NULL);
+        ASSERT(m_cpu != NULL);
+        for (i = 0; i < num_cores; i++) {
+                ret = pqos_cpu_check_core(m_cpu, cores[i]);
+                if (ret != PQOS_RETVAL_OK)
+                        return PQOS_RETVAL_PARAM;
+        }
+
+        ASSERT(m_cap != NULL);
+        ret = pqos_l3ca_get_cos_num(m_cap, &num_l3_cos);
+        if (ret != PQOS_RETVAL_OK && ret != PQOS_RETVAL_RESOURCE)
+                return ret;
+
+        ret = pqos_l2ca_get_cos_num(m_cap, &num_l2_cos);
+        if (ret != PQOS_RETVAL_OK && ret != PQOS_RETVAL_RESOURCE)
+                return ret;
+
+        if (class_id >= num_l3_cos && class_id >= num_l2_cos)
+                /* class_id is out of bounds */
+                return PQOS_RETVAL_PARAM;
+
+        /**
+         * Read all association registers in one batch, then write
+         * the changed ones in another
+         */
+        msr_batch_init(&rd);
+        msr_batch_init(&wr);
+        for (i = 0; i < num_cores; i++)
+                if (msr_batch_read(&rd, cores[i], reg) < 0) {
+                        ret = PQOS_RETVAL_RESOURCE;
+                        goto hw_alloc_assoc_set_many_exit;
+                }
+        if (msr_batch_submit(&rd) != MACHINE_RETVAL_OK) {
+                ret = PQOS_RETVAL_ERROR;
+                goto hw_alloc_assoc_set_many_exit;
+        }
+
+        for (i = 0; i < rd.num_ops; i++) {
+                uint64_t val = rd.ops[i].value;
+
+                val &= (~PQOS_MSR_ASSOC_QECOS_MASK);
+                val |= (((uint64_t) class_id) << PQOS_MSR_ASSOC_QECOS_SHIFT);
+                if (val == rd.ops[i].value)
+                        continue;
+                if (msr_batch_write(&wr, rd.ops[i].lcore, reg, val) !=
+                    MACHINE_RETVAL_OK) {
+                        ret = PQOS_RETVAL_RESOURCE;
+                        goto hw_alloc_assoc_set_many_exit;
+                }
+        }
+        if (wr.num_ops > 0 && msr_batch_submit(&wr) != MACHINE_RETVAL_OK)
+                ret = PQOS_RETVAL_ERROR;
+
+ hw_alloc_assoc_set_many_exit:
+        msr_batch_fini(&rd);
+        msr_batch_fini(&wr);
+        return ret;
+}
+
 int
 hw_alloc_assoc_get(const unsigned lcore,
                    unsigned *class_id)
@@ -77,6 +77,20 @@ int pqos_alloc_fini(void);
 int hw_alloc_assoc_set(const unsigned lcore,
                        const unsigned class_id);
 
+/**
+ * @brief Hardware interface to associate \a cores
+ *        with given class of service
+ *
+ * @param [in] cores table of CPU logical core id's
+ * @param [in] num_cores number of cores in the table
+ * @param [in] class_id class of service
+ *
+ * @return Operations status
+ */
+int hw_alloc_assoc_set_many(const unsigned *cores,
+                            const unsigned num_cores,
+                            const unsigned class_id);
+
 /**
  * @brief Hardware interface to read association
  *        of \a lcore with class of service
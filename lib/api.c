@@ -59,6 +59,49 @@
  */
 static int m_interface = PQOS_INTER_MSR;
 
+/**
+ * @brief Acquires API locks of resources \a res
+ *
+ * With OS interface allocation technologies share schemata files
+ * and resctrl state cached by the library, they are locked together
+ * and exclusively.
+ *
+ * @param [in] res API_LOCK_* mask of resources
+ * @param [in] write 1 for exclusive lock, 0 for shared lock
+ *
+ * @return Mask of locked resources to be passed to _pqos_api_unlock_res()
+ */
+static unsigned
+api_lock(unsigned res, int write)
+{
+        const unsigned alloc = API_LOCK_L3CA | API_LOCK_L2CA | API_LOCK_MBA;
+
+        if (m_interface == PQOS_INTER_OS &&
+            (res & (alloc | API_LOCK_ASSOC))) {
+                if (res & alloc)
+                        res |= alloc;
+                write = 1;
+        }
+        _pqos_api_lock_res(res, write);
+
+        return res;
+}
+
+/**
+ * @brief Gets API locks of operations changing monitoring RMIDs
+ *
+ * With MSR interface RMID and class of service share PQR_ASSOC register.
+ *
+ * @return API_LOCK_* mask of resources
+ */
+static unsigned
+mon_assoc_res(void)
+{
+        if (m_interface == PQOS_INTER_MSR)
+                return API_LOCK_MON | API_LOCK_ASSOC;
+        return API_LOCK_MON;
+}
+
 /*
  * =======================================
  * Init module
@@ -85,12 +128,13 @@ pqos_alloc_assoc_set(const unsigned lcore,
                      const unsigned class_id)
 {
 	int ret;
+	unsigned lock;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -104,7 +148,41 @@ pqos_alloc_assoc_set(const unsigned lcore,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
+
+	return ret;
+}
+
+int
+pqos_alloc_assoc_set_many(const unsigned *cores,
+                          const unsigned num_cores,
+                          const unsigned class_id)
+{
+	int ret;
+	unsigned lock;
+
+	if (cores == NULL || num_cores == 0)
+		return PQOS_RETVAL_PARAM;
+
+	lock = api_lock(API_LOCK_ASSOC, 1);
+
+        ret = _pqos_check_init(1);
+        if (ret != PQOS_RETVAL_OK) {
+                _pqos_api_unlock_res(lock);
+                return ret;
+        }
+
+	if (m_interface == PQOS_INTER_MSR)
+		ret = hw_alloc_assoc_set_many(cores, num_cores, class_id);
+	else {
+#ifdef __linux__
+		ret = os_alloc_assoc_set_many(cores, num_cores, class_id);
+#else
+                LOG_INFO("OS interface not supported!\n");
+                ret = PQOS_RETVAL_RESOURCE;
+#endif
+        }
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -114,15 +192,16 @@ pqos_alloc_assoc_get(const unsigned lcore,
                      unsigned *class_id)
 {
 	int ret;
+	unsigned lock;
 
 	if (class_id == NULL)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -136,7 +215,7 @@ pqos_alloc_assoc_get(const unsigned lcore,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -146,19 +225,20 @@ pqos_alloc_assoc_set_pid(const pid_t task,
                          const unsigned class_id)
 {
         int ret;
+        unsigned lock;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
         if (m_interface != PQOS_INTER_OS) {
                 LOG_ERROR("Incompatible interface "
                           "selected for task association!\n");
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return PQOS_RETVAL_ERROR;
         }
 
@@ -170,7 +250,7 @@ pqos_alloc_assoc_set_pid(const pid_t task,
         LOG_INFO("OS interface not supported!\n");
         ret = PQOS_RETVAL_RESOURCE;
 #endif
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 
@@ -181,22 +261,23 @@ pqos_alloc_assoc_get_pid(const pid_t task,
                          unsigned *class_id)
 {
 	int ret;
+	unsigned lock;
 
 	if (class_id == NULL)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
         if (m_interface != PQOS_INTER_OS) {
                 LOG_ERROR("Incompatible interface "
                           "selected for task association!\n");
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return PQOS_RETVAL_ERROR;
         }
 
@@ -208,7 +289,47 @@ pqos_alloc_assoc_get_pid(const pid_t task,
         LOG_INFO("OS interface not supported!\n");
         ret = PQOS_RETVAL_RESOURCE;
 #endif
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
+
+	return ret;
+}
+
+int
+pqos_alloc_assoc_get_pids(const pid_t *tasks,
+                          const unsigned num_tasks,
+                          unsigned *class_ids)
+{
+	int ret;
+	unsigned lock;
+
+	if (tasks == NULL || class_ids == NULL || num_tasks == 0)
+		return PQOS_RETVAL_PARAM;
+
+	lock = api_lock(API_LOCK_ASSOC, 0);
+
+        ret = _pqos_check_init(1);
+        if (ret != PQOS_RETVAL_OK) {
+                _pqos_api_unlock_res(lock);
+                return ret;
+        }
+
+        if (m_interface != PQOS_INTER_OS) {
+                LOG_ERROR("Incompatible interface "
+                          "selected for task association!\n");
+                _pqos_api_unlock_res(lock);
+                return PQOS_RETVAL_ERROR;
+        }
+
+#ifdef __linux__
+        ret = os_alloc_assoc_get_pids(tasks, num_tasks, class_ids);
+#else
+        UNUSED_PARAM(tasks);
+        UNUSED_PARAM(num_tasks);
+        UNUSED_PARAM(class_ids);
+        LOG_INFO("OS interface not supported!\n");
+        ret = PQOS_RETVAL_RESOURCE;
+#endif
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -223,16 +344,17 @@ pqos_alloc_assign(const unsigned technology,
 	const int l2_req = ((technology & (1 << PQOS_CAP_TYPE_L2CA)) != 0);
 	const int l3_req = ((technology & (1 << PQOS_CAP_TYPE_L3CA)) != 0);
 	const int mba_req = ((technology & (1 << PQOS_CAP_TYPE_MBA)) != 0);
+	unsigned lock;
 
         if (core_num == 0 || core_array == NULL || class_id == NULL ||
             !(l2_req || l3_req || mba_req))
                 return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
         if (m_interface == PQOS_INTER_MSR)
@@ -247,7 +369,7 @@ pqos_alloc_assign(const unsigned technology,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -257,15 +379,16 @@ pqos_alloc_release(const unsigned *core_array,
                    const unsigned core_num)
 {
 	int ret;
+	unsigned lock;
 
         if (core_num == 0 || core_array == NULL)
                 return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -279,7 +402,7 @@ pqos_alloc_release(const unsigned *core_array,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -291,22 +414,23 @@ pqos_alloc_assign_pid(const unsigned technology,
                       unsigned *class_id)
 {
         int ret;
+        unsigned lock;
 
         if (task_array == NULL || task_num == 0 || class_id == NULL)
                 return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
         if (m_interface != PQOS_INTER_OS) {
                 LOG_ERROR("Incompatible interface "
                           "selected for task association!\n");
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return PQOS_RETVAL_ERROR;
         }
 
@@ -317,7 +441,7 @@ pqos_alloc_assign_pid(const unsigned technology,
         LOG_INFO("OS interface not supported!\n");
         ret = PQOS_RETVAL_RESOURCE;
 #endif
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -327,22 +451,23 @@ pqos_alloc_release_pid(const pid_t *task_array,
                        const unsigned task_num)
 {
         int ret;
+        unsigned lock;
 
         if (task_array == NULL || task_num == 0)
                 return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_ASSOC, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
         if (m_interface != PQOS_INTER_OS) {
                 LOG_ERROR("Incompatible interface "
                           "selected for task association!\n");
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return PQOS_RETVAL_ERROR;
         }
 
@@ -352,7 +477,7 @@ pqos_alloc_release_pid(const pid_t *task_array,
         LOG_INFO("OS interface not supported!\n");
         ret = PQOS_RETVAL_RESOURCE;
 #endif
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -398,6 +523,7 @@ pqos_pid_get_pid_assoc(const unsigned class_id, unsigned *count)
 {
         unsigned *tasks = NULL;
         int ret;
+        unsigned lock;
 
         if (count == NULL)
                 return NULL;
@@ -407,11 +533,11 @@ pqos_pid_get_pid_assoc(const unsigned class_id, unsigned *count)
                           "selected for task association!\n");
                 return NULL;
         }
-        _pqos_api_lock();
+        lock = api_lock(API_LOCK_ASSOC, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return NULL;
         }
 
@@ -424,7 +550,7 @@ pqos_pid_get_pid_assoc(const unsigned class_id, unsigned *count)
         LOG_INFO("OS interface not supported!\n");
 #endif
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return tasks;
 }
@@ -471,15 +597,16 @@ pqos_l3ca_set(const unsigned socket,
 {
 	int ret;
 	unsigned i;
+	unsigned lock;
 
 	if (ca == NULL || num_cos == 0)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L3CA, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -498,7 +625,7 @@ pqos_l3ca_set(const unsigned socket,
 		if (!is_contig) {
 			LOG_ERROR("L3 COS%u bit mask is not contiguous!\n",
 			          ca[i].class_id);
-			_pqos_api_unlock();
+			_pqos_api_unlock_res(lock);
 			return PQOS_RETVAL_PARAM;
 		}
 	}
@@ -513,7 +640,7 @@ pqos_l3ca_set(const unsigned socket,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -525,15 +652,16 @@ pqos_l3ca_get(const unsigned socket,
               struct pqos_l3ca *ca)
 {
 	int ret;
+	unsigned lock;
 
 	if (num_ca == NULL || ca == NULL || max_num_ca == 0)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L3CA, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 	if (m_interface == PQOS_INTER_MSR)
@@ -546,7 +674,7 @@ pqos_l3ca_get(const unsigned socket,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -555,15 +683,16 @@ int
 pqos_l3ca_get_min_cbm_bits(unsigned *min_cbm_bits)
 {
 	int ret;
+	unsigned lock;
 
 	if (min_cbm_bits == NULL)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L3CA | API_LOCK_ASSOC, 1);
 
 	ret = _pqos_check_init(1);
 	if (ret != PQOS_RETVAL_OK) {
-		_pqos_api_unlock();
+		_pqos_api_unlock_res(lock);
 		return ret;
 	}
 
@@ -578,7 +707,7 @@ pqos_l3ca_get_min_cbm_bits(unsigned *min_cbm_bits)
 #endif
 	}
 
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -596,15 +725,16 @@ pqos_l2ca_set(const unsigned l2id,
 {
 	int ret;
 	unsigned i;
+	unsigned lock;
 
 	if (ca == NULL || num_cos == 0)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L2CA, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -615,7 +745,7 @@ pqos_l2ca_set(const unsigned l2id,
 		if (!is_contiguous(ca[i].ways_mask)) {
 			LOG_ERROR("L2 COS%u bit mask is not contiguous!\n",
 			          ca[i].class_id);
-			_pqos_api_unlock();
+			_pqos_api_unlock_res(lock);
 			return PQOS_RETVAL_PARAM;
 		}
 	}
@@ -629,7 +759,7 @@ pqos_l2ca_set(const unsigned l2id,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -641,15 +771,16 @@ pqos_l2ca_get(const unsigned l2id,
               struct pqos_l2ca *ca)
 {
 	int ret;
+	unsigned lock;
 
 	if (num_ca == NULL || ca == NULL || max_num_ca == 0)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L2CA, 0);
 
 	ret = _pqos_check_init(1);
 	if (ret != PQOS_RETVAL_OK) {
-		_pqos_api_unlock();
+		_pqos_api_unlock_res(lock);
 		return ret;
 	}
 
@@ -663,7 +794,7 @@ pqos_l2ca_get(const unsigned l2id,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -672,15 +803,16 @@ int
 pqos_l2ca_get_min_cbm_bits(unsigned *min_cbm_bits)
 {
 	int ret;
+	unsigned lock;
 
 	if (min_cbm_bits == NULL)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_L2CA | API_LOCK_ASSOC, 1);
 
 	ret = _pqos_check_init(1);
 	if (ret != PQOS_RETVAL_OK) {
-		_pqos_api_unlock();
+		_pqos_api_unlock_res(lock);
 		return ret;
 	}
 
@@ -695,7 +827,7 @@ pqos_l2ca_get_min_cbm_bits(unsigned *min_cbm_bits)
 #endif
 	}
 
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -714,6 +846,7 @@ pqos_mba_set(const unsigned socket,
 {
 	int ret;
 	unsigned i;
+	unsigned lock;
 
 	if (requested == NULL || num_cos == 0)
 		return PQOS_RETVAL_PARAM;
@@ -728,11 +861,11 @@ pqos_mba_set(const unsigned socket,
 			return PQOS_RETVAL_PARAM;
 		}
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_MBA, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -747,7 +880,7 @@ pqos_mba_set(const unsigned socket,
 #endif
         }
 
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 
@@ -760,15 +893,16 @@ pqos_mba_get(const unsigned socket,
              struct pqos_mba *mba_tab)
 {
 	int ret;
+	unsigned lock;
 
 	if (num_cos == NULL || mba_tab == NULL || max_num_cos == 0)
 		return PQOS_RETVAL_PARAM;
 
-	_pqos_api_lock();
+	lock = api_lock(API_LOCK_MBA, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -783,7 +917,7 @@ pqos_mba_get(const unsigned socket,
 #endif
         }
 
-	_pqos_api_unlock();
+	_pqos_api_unlock_res(lock);
 
 	return ret;
 }
@@ -798,12 +932,13 @@ int
 pqos_mon_reset(void)
 {
         int ret;
+        unsigned lock;
 
-        _pqos_api_lock();
+        lock = api_lock(mon_assoc_res(), 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -814,7 +949,38 @@ pqos_mon_reset(void)
                 ret = PQOS_RETVAL_RESOURCE;
         }
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
+
+        return ret;
+}
+
+int
+pqos_mon_rmid_avail(const unsigned l3_id,
+                    unsigned *num_free,
+                    unsigned *num_limbo)
+{
+        int ret;
+        unsigned lock;
+
+        if (num_free == NULL)
+                return PQOS_RETVAL_PARAM;
+
+        lock = api_lock(API_LOCK_MON, 0);
+
+        ret = _pqos_check_init(1);
+        if (ret != PQOS_RETVAL_OK) {
+                _pqos_api_unlock_res(lock);
+                return ret;
+        }
+
+        if (m_interface == PQOS_INTER_MSR)
+                ret = hw_mon_rmid_avail(l3_id, num_free, num_limbo);
+        else {
+                LOG_INFO("OS interface not supported!\n");
+                ret = PQOS_RETVAL_RESOURCE;
+        }
+
+        _pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -824,12 +990,13 @@ pqos_mon_assoc_get(const unsigned lcore,
                    pqos_rmid_t *rmid)
 {
         int ret;
+        unsigned lock;
 
-        _pqos_api_lock();
+        lock = api_lock(API_LOCK_MON, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -840,7 +1007,7 @@ pqos_mon_assoc_get(const unsigned lcore,
                 ret = PQOS_RETVAL_RESOURCE;
         }
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -853,6 +1020,7 @@ pqos_mon_start(const unsigned num_cores,
                struct pqos_mon_data *group)
 {
         int ret;
+        unsigned lock;
 
         if (group == NULL || cores == NULL || num_cores == 0 || event == 0)
                 return PQOS_RETVAL_PARAM;
@@ -875,11 +1043,11 @@ pqos_mon_start(const unsigned num_cores,
             (event & (PQOS_PERF_EVENT_IPC | PQOS_PERF_EVENT_LLC_MISS)) != 0)
                 return PQOS_RETVAL_PARAM;
 
-        _pqos_api_lock();
+        lock = api_lock(mon_assoc_res(), 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -903,7 +1071,7 @@ pqos_mon_start(const unsigned num_cores,
         if (ret == PQOS_RETVAL_OK)
                 group->valid = GROUP_VALID_MARKER;
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -912,6 +1080,7 @@ int
 pqos_mon_stop(struct pqos_mon_data *group)
 {
         int ret;
+        unsigned lock;
 
         if (group == NULL)
                 return PQOS_RETVAL_PARAM;
@@ -919,11 +1088,11 @@ pqos_mon_stop(struct pqos_mon_data *group)
         if (group->valid != GROUP_VALID_MARKER)
                 return PQOS_RETVAL_PARAM;
 
-        _pqos_api_lock();
+        lock = api_lock(mon_assoc_res(), 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -937,7 +1106,7 @@ pqos_mon_stop(struct pqos_mon_data *group)
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -948,6 +1117,7 @@ pqos_mon_poll(struct pqos_mon_data **groups,
 {
         int ret;
         unsigned i;
+        unsigned lock;
 
         if (groups == NULL || num_groups == 0 || *groups == NULL)
                 return PQOS_RETVAL_PARAM;
@@ -959,11 +1129,20 @@ pqos_mon_poll(struct pqos_mon_data **groups,
                         return PQOS_RETVAL_PARAM;
         }
 
-        _pqos_api_lock();
+        /* rotation of multiplexed RMIDs changes core associations */
+        lock = API_LOCK_MON;
+        if (hw_mon_poll_assoc())
+                lock = mon_assoc_res();
+        /* tasks attached to monitored cgroups are moved in resctrl */
+        for (i = 0; i < num_groups; i++)
+                if (groups[i]->resctrl_mon != NULL &&
+                    groups[i]->cgroup != NULL)
+                        lock |= API_LOCK_ASSOC;
+        lock = api_lock(lock, 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -977,7 +1156,7 @@ pqos_mon_poll(struct pqos_mon_data **groups,
                 ret = PQOS_RETVAL_RESOURCE;
 #endif
         }
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return ret;
 }
@@ -989,6 +1168,7 @@ pqos_mon_start_pid(const pid_t pid,
                    struct pqos_mon_data *group)
 {
         int ret;
+        unsigned lock;
 
         if (group == NULL || event == 0 || pid < 0)
                 return PQOS_RETVAL_PARAM;
@@ -1016,11 +1196,11 @@ pqos_mon_start_pid(const pid_t pid,
             (event & (PQOS_PERF_EVENT_IPC | PQOS_PERF_EVENT_LLC_MISS)) != 0)
                 return PQOS_RETVAL_PARAM;
 
-        _pqos_api_lock();
+        lock = api_lock(mon_assoc_res(), 1);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(lock);
                 return ret;
         }
 
@@ -1028,6 +1208,8 @@ pqos_mon_start_pid(const pid_t pid,
         group->event = event;
         group->pid = pid;
         group->context = context;
+        group->values.confidence = 1.0;
+        group->values.llc_confidence = 1.0;
 
 #ifdef __linux__
         ret = os_mon_start_pid(group);
@@ -1038,8 +1220,74 @@ pqos_mon_start_pid(const pid_t pid,
         if (ret == PQOS_RETVAL_OK)
                 group->valid = GROUP_VALID_MARKER;
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(lock);
 
         return ret;
 
 }
+
+int
+pqos_mon_start_cgroup(const char *cgroup,
+                      const enum pqos_mon_event event,
+                      void *context,
+                      struct pqos_mon_data *group)
+{
+        int ret;
+        unsigned lock;
+
+        if (group == NULL || event == 0 || cgroup == NULL)
+                return PQOS_RETVAL_PARAM;
+
+        if (group->valid == GROUP_VALID_MARKER)
+                return PQOS_RETVAL_PARAM;
+
+        if (m_interface != PQOS_INTER_OS) {
+                LOG_ERROR("Incompatible interface "
+                          "selected for cgroup monitoring!\n");
+                return PQOS_RETVAL_ERROR;
+        }
+        /**
+         * Validate event parameter
+         * - only combinations of events allowed
+         */
+        if (event & (~(PQOS_MON_EVENT_L3_OCCUP | PQOS_MON_EVENT_LMEM_BW |
+                       PQOS_MON_EVENT_TMEM_BW | PQOS_MON_EVENT_RMEM_BW |
+                       PQOS_PERF_EVENT_IPC | PQOS_PERF_EVENT_LLC_MISS)))
+                return PQOS_RETVAL_PARAM;
+
+        /* cgroup tasks are looked up and moved in resctrl */
+        lock = api_lock(mon_assoc_res() | API_LOCK_ASSOC, 1);
+
+        ret = _pqos_check_init(1);
+        if (ret != PQOS_RETVAL_OK) {
+                _pqos_api_unlock_res(lock);
+                return ret;
+        }
+
+        memset(group, 0, sizeof(*group));
+        group->event = event;
+        group->context = context;
+        group->values.confidence = 1.0;
+        group->values.llc_confidence = 1.0;
+        group->cgroup_fd = -1;
+        group->cgroup = strdup(cgroup);
+        if (group->cgroup == NULL) {
+                _pqos_api_unlock_res(lock);
+                return PQOS_RETVAL_RESOURCE;
+        }
+
+#ifdef __linux__
+        ret = os_mon_start_cgroup(group);
+#else
+        LOG_INFO("OS interface not supported!\n");
+        free(group->cgroup);
+        group->cgroup = NULL;
+        ret = PQOS_RETVAL_RESOURCE;
+#endif
+        if (ret == PQOS_RETVAL_OK)
+                group->valid = GROUP_VALID_MARKER;
+
+        _pqos_api_unlock_res(lock);
+
+        return ret;
+}
@@ -54,8 +54,9 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <fcntl.h>     /* O_CREAT */
-#include <unistd.h>    /* usleep(), lockf() */
+#include <errno.h>
+#include <fcntl.h>     /* O_CREAT, fcntl() */
+#include <unistd.h>    /* usleep() */
 #include <sys/stat.h>  /* S_Ixxx */
 #include <pthread.h>
 
@@ -72,6 +73,7 @@
 #include "api.h"
 #include "utils.h"
 #include "resctrl_alloc.h"
+#include "snapshot.h"
 
 /**
  * ---------------------------------------
@@ -143,9 +145,26 @@ static int m_init_done = 0;
 
 /**
  * API thread/process safe access is secured through these locks.
+ *
+ * Threads of the process synchronize on pthread locks.
+ * Processes synchronize on fcntl() locks of the lock file:
+ * - whole file for _pqos_api_lock()
+ * - one byte per resource for _pqos_api_lock_res()
  */
 static int m_apilock = -1;
-static pthread_mutex_t m_apilock_mutex;
+static pthread_rwlock_t m_apilock_rwlock;
+
+/**
+ * Resource lock
+ */
+struct api_lock_res {
+        pthread_rwlock_t rwlock;        /**< threads lock */
+        pthread_mutex_t mutex;          /**< protects users */
+        unsigned users;                 /**< threads holding the resource,
+                                           file lock is held if non-zero */
+};
+
+static struct api_lock_res m_apilock_res[API_LOCK_NUM];
 
 /**
  * Interface status
@@ -161,6 +180,36 @@ static int m_interface = PQOS_INTER_MSR;
  * ---------------------------------------
  */
 
+/**
+ * @brief Sets fcntl() lock on lock file
+ *
+ * @param [in] type F_RDLCK, F_WRLCK or F_UNLCK
+ * @param [in] start first byte of the locked range
+ * @param [in] len length of the range, 0 for up to the end of file
+ *
+ * @return Operation status
+ * @retval 0 success
+ * @retval -1 error
+ */
+static int
+_pqos_api_flock(const short type, const off_t start, const off_t len)
+{
+        struct flock fl;
+        int ret;
+
+        memset(&fl, 0, sizeof(fl));
+        fl.l_type = type;
+        fl.l_whence = SEEK_SET;
+        fl.l_start = start;
+        fl.l_len = len;
+
+        do {
+                ret = fcntl(m_apilock, F_SETLKW, &fl);
+        } while (ret != 0 && errno == EINTR);
+
+        return ret;
+}
+
 /**
  * @brief Initalizes API locks
  *
@@ -173,16 +222,39 @@ _pqos_api_init(void)
 {
 
         const char *lock_filename = LOCKFILE;
+        unsigned i;
 
         if (m_apilock != -1)
                 return -1;
 
-        m_apilock = open(lock_filename, O_WRONLY | O_CREAT,
+        m_apilock = open(lock_filename, O_RDWR | O_CREAT,
                          S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
         if (m_apilock == -1)
                 return -1;
 
-        if (pthread_mutex_init(&m_apilock_mutex, NULL) != 0) {
+        if (pthread_rwlock_init(&m_apilock_rwlock, NULL) != 0) {
+                close(m_apilock);
+                m_apilock = -1;
+                return -1;
+        }
+
+        for (i = 0; i < DIM(m_apilock_res); i++) {
+                struct api_lock_res *lock = &m_apilock_res[i];
+
+                lock->users = 0;
+                if (pthread_rwlock_init(&lock->rwlock, NULL) != 0)
+                        break;
+                if (pthread_mutex_init(&lock->mutex, NULL) != 0) {
+                        pthread_rwlock_destroy(&lock->rwlock);
+                        break;
+                }
+        }
+        if (i < DIM(m_apilock_res)) {
+                while (i-- > 0) {
+                        pthread_mutex_destroy(&m_apilock_res[i].mutex);
+                        pthread_rwlock_destroy(&m_apilock_res[i].rwlock);
+                }
+                pthread_rwlock_destroy(&m_apilock_rwlock);
                 close(m_apilock);
                 m_apilock = -1;
                 return -1;
@@ -202,13 +274,21 @@ static int
 _pqos_api_exit(void)
 {
         int ret = 0;
+        unsigned i;
 
         if (close(m_apilock) != 0)
                 ret = -1;
 
-        if (pthread_mutex_destroy(&m_apilock_mutex) != 0)
+        if (pthread_rwlock_destroy(&m_apilock_rwlock) != 0)
                 ret = -1;
 
+        for (i = 0; i < DIM(m_apilock_res); i++) {
+                if (pthread_mutex_destroy(&m_apilock_res[i].mutex) != 0)
+                        ret = -1;
+                if (pthread_rwlock_destroy(&m_apilock_res[i].rwlock) != 0)
+                        ret = -1;
+        }
+
         m_apilock = -1;
 
         return ret;
@@ -219,10 +299,10 @@ _pqos_api_lock(void)
 {
         int err = 0;
 
-        if (lockf(m_apilock, F_LOCK, 0) != 0)
+        if (pthread_rwlock_wrlock(&m_apilock_rwlock) != 0)
                 err = 1;
 
-        if (pthread_mutex_lock(&m_apilock_mutex) != 0)
+        if (_pqos_api_flock(F_WRLCK, 0, 0) != 0)
                 err = 1;
 
         if (err)
@@ -234,10 +314,76 @@ _pqos_api_unlock(void)
 {
         int err = 0;
 
-        if (lockf(m_apilock, F_ULOCK, 0) != 0)
+        if (_pqos_api_flock(F_UNLCK, 0, 0) != 0)
+                err = 1;
+
+        if (pthread_rwlock_unlock(&m_apilock_rwlock) != 0)
+                err = 1;
+
+        if (err)
+                LOG_ERROR("API unlock error!\n");
+}
+
+void
+_pqos_api_lock_res(const unsigned res, const int write)
+{
+        int err = 0;
+        unsigned i;
+
+        if (pthread_rwlock_rdlock(&m_apilock_rwlock) != 0)
                 err = 1;
 
-        if (pthread_mutex_unlock(&m_apilock_mutex) != 0)
+        /* resources are always locked in the same order */
+        for (i = 0; i < DIM(m_apilock_res); i++) {
+                struct api_lock_res *lock = &m_apilock_res[i];
+
+                if (!(res & (1 << i)))
+                        continue;
+
+                if (write) {
+                        if (pthread_rwlock_wrlock(&lock->rwlock) != 0)
+                                err = 1;
+                } else if (pthread_rwlock_rdlock(&lock->rwlock) != 0)
+                        err = 1;
+
+                /**
+                 * fcntl() locks are owned by the process,
+                 * first thread in takes the file lock for all of them
+                 */
+                pthread_mutex_lock(&lock->mutex);
+                if (lock->users++ == 0 &&
+                    _pqos_api_flock(write ? F_WRLCK : F_RDLCK, i + 1, 1) != 0)
+                        err = 1;
+                pthread_mutex_unlock(&lock->mutex);
+        }
+
+        if (err)
+                LOG_ERROR("API lock error!\n");
+}
+
+void
+_pqos_api_unlock_res(const unsigned res)
+{
+        int err = 0;
+        unsigned i = DIM(m_apilock_res);
+
+        while (i-- > 0) {
+                struct api_lock_res *lock = &m_apilock_res[i];
+
+                if (!(res & (1 << i)))
+                        continue;
+
+                pthread_mutex_lock(&lock->mutex);
+                if (--lock->users == 0 &&
+                    _pqos_api_flock(F_UNLCK, i + 1, 1) != 0)
+                        err = 1;
+                pthread_mutex_unlock(&lock->mutex);
+
+                if (pthread_rwlock_unlock(&lock->rwlock) != 0)
+                        err = 1;
+        }
+
+        if (pthread_rwlock_unlock(&m_apilock_rwlock) != 0)
                 err = 1;
 
         if (err)
@@ -1406,6 +1552,43 @@ log_hw_caps(struct pqos_cap *p_cap)
  * =======================================
  * =======================================
  */
+/**
+ * @brief Refreshes capability state that may change between runs
+ *
+ * Snapshot stores L3 CAT with CDP off, CDP state is read from
+ * the hardware.
+ *
+ * @param [in,out] cap capabilities loaded from snapshot
+ * @param [in] cpu detected CPU topology
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+static int
+snapshot_refresh(struct pqos_cap *cap, const struct pqos_cpuinfo *cpu)
+{
+        unsigned i;
+
+        for (i = 0; i < cap->num_cap; i++) {
+                struct pqos_cap_l3ca *l3ca;
+                int cdp_on = 0;
+                int ret;
+
+                if (cap->capabilities[i].type != PQOS_CAP_TYPE_L3CA)
+                        continue;
+                l3ca = cap->capabilities[i].u.l3ca;
+                if (!l3ca->cdp)
+                        continue;
+                ret = cdp_is_enabled(cpu, &cdp_on);
+                if (ret != PQOS_RETVAL_OK)
+                        return ret;
+                l3ca->cdp_on = cdp_on;
+                if (cdp_on)
+                        l3ca->num_classes = l3ca->num_classes / 2;
+        }
+        return PQOS_RETVAL_OK;
+}
+
 int
 pqos_init(const struct pqos_config *config)
 {
@@ -1413,6 +1596,8 @@ pqos_init(const struct pqos_config *config)
         unsigned i = 0, max_core = 0;
         int cat_init = 0, mon_init = 0;
         char *environment = NULL;
+        struct pqos_cpuinfo *snap_cpu = NULL;
+        struct pqos_cap *snap_cap = NULL;
 
         if (config == NULL)
                 return PQOS_RETVAL_PARAM;
@@ -1464,13 +1649,24 @@ pqos_init(const struct pqos_config *config)
                 goto init_error;
         }
 
+        if (config->snapshot &&
+            snapshot_load(&snap_cpu, &snap_cap) != PQOS_RETVAL_OK) {
+                snap_cpu = NULL;
+                snap_cap = NULL;
+        }
+
         /**
          * Topology not provided through config.
          * CPU discovery done through internal mechanism.
          */
-        ret = cpuinfo_init(&m_cpu);
+        if (snap_cpu != NULL)
+                ret = cpuinfo_init_snapshot(snap_cpu, &m_cpu);
+        else
+                ret = cpuinfo_init(&m_cpu);
         if (ret != 0 || m_cpu == NULL) {
                 LOG_ERROR("cpuinfo_init() error %d\n", ret);
+                if (snap_cpu != NULL)
+                        free(snap_cpu);
                 ret = PQOS_RETVAL_ERROR;
                 goto log_init_error;
         }
@@ -1488,10 +1684,25 @@ pqos_init(const struct pqos_config *config)
                 goto cpuinfo_init_error;
         }
 
-        ret = discover_capabilities(&m_cap, m_cpu);
-        if (ret != PQOS_RETVAL_OK) {
-                LOG_ERROR("discover_capabilities() error %d\n", ret);
-                goto machine_init_error;
+        if (snap_cap != NULL) {
+                if (snapshot_refresh(snap_cap, m_cpu) == PQOS_RETVAL_OK) {
+                        m_cap = snap_cap;
+                } else {
+                        for (i = 0; i < snap_cap->num_cap; i++)
+                                free(snap_cap->capabilities[i].u.generic_ptr);
+                        free(snap_cap);
+                }
+                snap_cap = NULL;
+        }
+
+        if (m_cap == NULL) {
+                ret = discover_capabilities(&m_cap, m_cpu);
+                if (ret != PQOS_RETVAL_OK) {
+                        LOG_ERROR("discover_capabilities() error %d\n", ret);
+                        goto machine_init_error;
+                }
+                if (config->snapshot)
+                        (void) snapshot_save(m_cpu, m_cap);
         }
         ASSERT(m_cap != NULL);
 #ifdef __linux__
@@ -1580,6 +1791,11 @@ pqos_init(const struct pqos_config *config)
         if (ret != PQOS_RETVAL_OK)
                 (void) log_fini();
  init_error:
+        if (snap_cap != NULL) {
+                for (i = 0; i < snap_cap->num_cap; i++)
+                        free(snap_cap->capabilities[i].u.generic_ptr);
+                free(snap_cap);
+        }
         if (ret != PQOS_RETVAL_OK) {
                 if (m_cap != NULL)
                         free(m_cap);
@@ -1669,11 +1885,11 @@ pqos_cap_get(const struct pqos_cap **cap,
         if (cap == NULL && cpu == NULL)
                 return PQOS_RETVAL_PARAM;
 
-        _pqos_api_lock();
+        _pqos_api_lock_res(0, 0);
 
         ret = _pqos_check_init(1);
         if (ret != PQOS_RETVAL_OK) {
-                _pqos_api_unlock();
+                _pqos_api_unlock_res(0);
                 return ret;
         }
 
@@ -1687,7 +1903,7 @@ pqos_cap_get(const struct pqos_cap **cap,
                 *cpu = m_cpu;
         }
 
-        _pqos_api_unlock();
+        _pqos_api_unlock_res(0);
         return PQOS_RETVAL_OK;
 }
 
@@ -54,11 +54,22 @@ extern "C" {
  */
 void _pqos_cap_l3cdp_change(const int prev, const int next);
 
+/**
+ * Resources protected by separate API locks
+ */
+#define API_LOCK_MON    (1 << 0)        /**< monitoring */
+#define API_LOCK_ASSOC  (1 << 1)        /**< class of service association */
+#define API_LOCK_L3CA   (1 << 2)        /**< L3 cache allocation */
+#define API_LOCK_L2CA   (1 << 3)        /**< L2 cache allocation */
+#define API_LOCK_MBA    (1 << 4)        /**< memory bandwidth allocation */
+#define API_LOCK_NUM    5               /**< number of resource locks */
+
 /**
  * @brief Aquires lock for PQoS API use
  *
- * Only one thread at a time is allowed to use the API.
- * Each PQoS API need to use api_lock and api_unlock functions.
+ * Lock is exclusive across the whole library, no other thread or
+ * process can use the API until it is released.
+ * It is used by operations that change state of all resources.
  */
 void _pqos_api_lock(void);
 
@@ -67,6 +78,28 @@ void _pqos_api_lock(void);
  */
 void _pqos_api_unlock(void);
 
+/**
+ * @brief Aquires locks of resources \a res for PQoS API use
+ *
+ * Operations on different resources run in parallel, threads and
+ * processes only wait for the resources they use.
+ * Shared locks of a resource are held together, exclusive one is
+ * held alone.
+ *
+ * @param [in] res API_LOCK_* mask of resources, 0 only holds off
+ *             \a _pqos_api_lock users
+ * @param [in] write 1 for exclusive lock, 0 for shared lock
+ */
+void _pqos_api_lock_res(const unsigned res, const int write);
+
+/**
+ * @brief Symmetric operation to \a _pqos_api_lock_res to release the locks
+ *
+ * @param [in] res API_LOCK_* mask of resources, as passed to
+ *             \a _pqos_api_lock_res
+ */
+void _pqos_api_unlock_res(const unsigned res);
+
 /**
  * @brief Checks library initialization state
  *
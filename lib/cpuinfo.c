@@ -36,6 +36,7 @@
  * @brief CPU sockets and cores enumeration module.
  */
 
+#include <stdio.h>
 #include <string.h>
 #include <stdint.h>
 #include <limits.h>
@@ -465,6 +466,147 @@ cpuinfo_build_topo(void)
         return l_cpu;
 }
 
+#ifdef __linux__
+/**
+ * @brief Reads unsigned value from sysfs file of \a cpu
+ *
+ * @param [in] cpu logical cpu id used by OS
+ * @param [in] fname file name relative to cpu directory
+ * @param [out] value place to store the value
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+sysfs_cpu_read(const unsigned cpu, const char *fname, unsigned *value)
+{
+        char path[128];
+        FILE *fd;
+        int ret;
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/%s",
+                 cpu, fname);
+        fd = fopen(path, "r");
+        if (fd == NULL)
+                return -1;
+        ret = (fscanf(fd, "%u", value) == 1) ? 0 : -1;
+        fclose(fd);
+        return ret;
+}
+
+/**
+ * @brief Finds sysfs cache index of cache \a level
+ *
+ * @param [in] level cache level
+ * @param [out] index place to store the cache index
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 cache not found
+ */
+static int
+sysfs_cache_index(const unsigned level, unsigned *index)
+{
+        unsigned i;
+
+        for (i = 0; ; i++) {
+                char fname[64];
+                unsigned l;
+
+                snprintf(fname, sizeof(fname), "cache/index%u/level", i);
+                if (sysfs_cpu_read(0, fname, &l) != 0)
+                        return -1;
+                if (l == level) {
+                        *index = i;
+                        return 0;
+                }
+        }
+}
+
+/**
+ * @brief Builds CPU topology structure from sysfs
+ *
+ * Unlike cpuinfo_build_topo() task is not migrated across processors,
+ * socket and cache cluster ids are read from
+ * /sys/devices/system/cpu/cpuN directories.
+ *
+ * @return Pointer to CPU topology structure
+ * @retval NULL on error
+ */
+static struct pqos_cpuinfo *
+cpuinfo_build_topo_sysfs(void)
+{
+        unsigned i, max_core_count, core_count = 0;
+        unsigned l2_idx, l3_idx;
+        int l3 = 1;
+        struct pqos_cpuinfo *l_cpu = NULL;
+        struct apic_info apic;
+        char l2_fname[64], l3_fname[64];
+
+        max_core_count = sysconf(_SC_NPROCESSORS_CONF);
+        if (max_core_count == 0)
+                return NULL;
+
+        if (detect_apic_masks(&apic) != 0)
+                return NULL;
+
+        if (sysfs_cache_index(2, &l2_idx) != 0)
+                return NULL;
+        if (sysfs_cache_index(3, &l3_idx) != 0)
+                l3 = 0;
+        snprintf(l2_fname, sizeof(l2_fname), "cache/index%u/id", l2_idx);
+        if (l3)
+                snprintf(l3_fname, sizeof(l3_fname), "cache/index%u/id",
+                         l3_idx);
+
+        const size_t mem_sz = sizeof(*l_cpu) +
+                (max_core_count * sizeof(struct pqos_coreinfo));
+
+        l_cpu = (struct pqos_cpuinfo *)malloc(mem_sz);
+        if (l_cpu == NULL)
+                return NULL;
+        memset(l_cpu, 0, mem_sz);
+        l_cpu->mem_size = (unsigned) mem_sz;
+
+        for (i = 0; i < max_core_count; i++) {
+                struct pqos_coreinfo *info = &l_cpu->cores[core_count];
+                unsigned online = 1;
+
+                /* cpu0 may have no online file */
+                if (sysfs_cpu_read(i, "online", &online) == 0 && !online)
+                        continue;
+
+                info->lcore = i;
+                if (sysfs_cpu_read(i, "topology/physical_package_id",
+                                   &info->socket) != 0 ||
+                    sysfs_cpu_read(i, l2_fname, &info->l2_id) != 0)
+                        goto cpuinfo_build_topo_sysfs_error;
+                if (!l3)
+                        info->l3_id = info->socket;
+                else if (sysfs_cpu_read(i, l3_fname, &info->l3_id) != 0)
+                        goto cpuinfo_build_topo_sysfs_error;
+
+                LOG_DEBUG("Detected core %u, socket %u, "
+                          "L2 ID %u, L3 ID %u\n",
+                          info->lcore, info->socket,
+                          info->l2_id, info->l3_id);
+                core_count++;
+        }
+
+        l_cpu->l2 = m_l2;
+        l_cpu->l3 = m_l3;
+        l_cpu->num_cores = core_count;
+        if (core_count > 0)
+                return l_cpu;
+
+ cpuinfo_build_topo_sysfs_error:
+        LOG_DEBUG("Incomplete sysfs topology, using CPUID\n");
+        free(l_cpu);
+        return NULL;
+}
+#endif /* __linux__ */
+
 /**
  * Detect number of logical processors on the machine
  * and their location.
@@ -478,7 +620,11 @@ cpuinfo_init(const struct pqos_cpuinfo **topology)
         if (m_cpu != NULL)
                 return -EPERM;
 
-        m_cpu = cpuinfo_build_topo();
+#ifdef __linux__
+        m_cpu = cpuinfo_build_topo_sysfs();
+        if (m_cpu == NULL)
+#endif
+                m_cpu = cpuinfo_build_topo();
         if (m_cpu == NULL) {
                 LOG_ERROR("CPU topology detection error!");
                 return -EFAULT;
@@ -488,6 +634,21 @@ cpuinfo_init(const struct pqos_cpuinfo **topology)
         return 0;
 }
 
+int
+cpuinfo_init_snapshot(struct pqos_cpuinfo *snapshot,
+                      const struct pqos_cpuinfo **topology)
+{
+        if (topology == NULL || snapshot == NULL)
+                return -EINVAL;
+
+        if (m_cpu != NULL)
+                return -EPERM;
+
+        m_cpu = snapshot;
+        *topology = m_cpu;
+        return 0;
+}
+
 int
 cpuinfo_fini(void)
 {
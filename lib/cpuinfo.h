@@ -61,6 +61,22 @@ extern "C" {
  */
 int cpuinfo_init(const struct pqos_cpuinfo **topology);
 
+/**
+ * @brief Initializes CPU information module with topology from snapshot
+ *
+ * Module takes ownership of \a snapshot.
+ *
+ * @param [in] snapshot CPU topology loaded from snapshot
+ * @param [out] topology place to store pointer to CPU topology data
+ *
+ * @return Operation status
+ * @retval 0 success
+ * @retval -EINVAL invalid argument
+ * @retval -EPERM cpuinfo already initialized
+ */
+int cpuinfo_init_snapshot(struct pqos_cpuinfo *snapshot,
+                          const struct pqos_cpuinfo **topology);
+
 /**
  * @brief Shuts down CPU information module
  *
@@ -34,13 +34,26 @@
 
 /**
  * @brief Library operations logger for info, warnings and errors.
+ *
+ * Messages are formatted by the logging thread into its own ring
+ * buffer and delivered to the log file descriptor and callback by
+ * a flusher thread. Logging threads never write themselves, messages
+ * logged while their ring is full are dropped and counted. Rings are
+ * drained by log_fini() and at process exit.
+ * Each warning and error call site is rate limited to LOG_RATE_BURST
+ * messages a second.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <string.h>
 #include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
 #ifdef __linux__
 #include <error.h>
 #endif /* __linux__ */
@@ -55,6 +68,38 @@
  * ---------------------------------------
  */
 #define AP_BUFFER_SIZE  256
+#define LOG_RING_SIZE   64              /**< messages per ring, power of 2 */
+#define LOG_FLUSH_MS    100             /**< max flusher sleep time */
+
+#ifdef CLOCK_MONOTONIC_COARSE
+#define LOG_CLOCK CLOCK_MONOTONIC_COARSE
+#elif defined(CLOCK_MONOTONIC_FAST)
+#define LOG_CLOCK CLOCK_MONOTONIC_FAST
+#else
+#define LOG_CLOCK CLOCK_MONOTONIC
+#endif
+
+/**
+ * Formatted log message
+ */
+struct log_msg {
+        uint64_t seq;                   /**< order across all rings */
+        int size;                       /**< message length */
+        char buf[AP_BUFFER_SIZE];       /**< message text */
+};
+
+/**
+ * Single producer, single consumer ring of log messages
+ */
+struct log_ring {
+        struct log_ring *next;          /**< next ring in the list */
+        int used;                       /**< ring owned by a thread */
+        unsigned head;                  /**< written by owner thread */
+        unsigned tail;                  /**< written by flusher thread */
+        unsigned dropped;               /**< messages lost to a full ring,
+                                           written by owner thread */
+        struct log_msg msg[LOG_RING_SIZE];
+};
 
 /**
  * ---------------------------------------
@@ -70,12 +115,373 @@ static void *m_context_log = NULL;      /**< log callback context */
  */
 static void (*m_callback_log)(void *, const size_t, const char *);
 static int log_init_successful = 0;     /**< log init gatekeeper */
+
+/**
+ * Rings are reused by new threads once their owner exits and are kept
+ * for the lifetime of the process
+ */
+static struct log_ring *m_rings = NULL;
+static pthread_mutex_t m_rings_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread struct log_ring *m_ring = NULL; /**< ring of the thread */
+static pthread_key_t m_ring_key;        /**< releases ring on thread exit */
+static pthread_once_t m_once = PTHREAD_ONCE_INIT;
+static uint64_t m_seq = 0;              /**< message sequence number */
+
+static pthread_t m_flusher;             /**< flusher thread */
+static int m_async = 0;                 /**< flusher thread running */
+static int m_stop = 0;                  /**< flusher thread to exit */
+static int m_idle = 0;                  /**< flusher waits for messages */
+static sem_t m_wakeup;                  /**< wakes up flusher thread */
+static pthread_mutex_t m_output_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /**
  * ---------------------------------------
  * Local functions
  * ---------------------------------------
  */
 
+/**
+ * @brief Delivers message to log file descriptor and callback
+ *
+ * Caller holds m_output_lock.
+ *
+ * @param [in] buf message
+ * @param [in] size message length
+ */
+static void
+log_output(const char *buf, const int size)
+{
+	if (m_callback_log != NULL)
+		m_callback_log(m_context_log, size, buf);
+
+	if (m_fd >= 0) {
+		if (write(m_fd, buf, size) < 0)
+			fprintf(stderr, "%s: printing to file failed\n",
+                                __func__);
+	}
+}
+
+/**
+ * @brief Releases ring of exiting thread
+ *
+ * @param [in] arg ring
+ */
+static void
+log_ring_release(void *arg)
+{
+        struct log_ring *ring = (struct log_ring *)arg;
+
+        __atomic_store_n(&ring->used, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Forked child has no flusher thread, it logs synchronously
+ */
+static void
+log_atfork_child(void)
+{
+        m_async = 0;
+        /* flusher might have held it at fork time */
+        pthread_mutex_init(&m_output_lock, NULL);
+}
+
+static void log_flusher_stop(void);
+
+/**
+ * @brief Delivers messages still in the rings when process exits
+ */
+static void
+log_atexit(void)
+{
+        log_flusher_stop();
+}
+
+/**
+ * @brief One time initialization of thread rings
+ */
+static void
+log_once(void)
+{
+        (void) pthread_key_create(&m_ring_key, log_ring_release);
+        (void) pthread_atfork(NULL, NULL, log_atfork_child);
+        (void) atexit(log_atexit);
+}
+
+/**
+ * @brief Gets ring of the current thread
+ *
+ * First call of the thread takes over a released ring or allocates
+ * a new one.
+ *
+ * @return Ring of the current thread
+ * @retval NULL on error
+ */
+static struct log_ring *
+log_ring_get(void)
+{
+        struct log_ring *ring;
+
+        if (m_ring != NULL)
+                return m_ring;
+
+        pthread_mutex_lock(&m_rings_lock);
+        for (ring = m_rings; ring != NULL; ring = ring->next)
+                if (!__atomic_load_n(&ring->used, __ATOMIC_ACQUIRE))
+                        break;
+        if (ring == NULL) {
+                ring = calloc(1, sizeof(*ring));
+                if (ring != NULL) {
+                        ring->next = m_rings;
+                        __atomic_store_n(&m_rings, ring, __ATOMIC_RELEASE);
+                }
+        }
+        if (ring != NULL)
+                ring->used = 1;
+        pthread_mutex_unlock(&m_rings_lock);
+
+        if (ring != NULL && pthread_setspecific(m_ring_key, ring) != 0) {
+                log_ring_release(ring);
+                return NULL;
+        }
+
+        m_ring = ring;
+        return ring;
+}
+
+/**
+ * @brief Wakes up flusher thread if it waits for messages
+ */
+static void
+log_flusher_wakeup(void)
+{
+        if (__atomic_exchange_n(&m_idle, 0, __ATOMIC_SEQ_CST))
+                sem_post(&m_wakeup);
+}
+
+/**
+ * @brief Formats message into ring of the current thread
+ *
+ * If the ring is full the message is dropped and counted, the count
+ * is logged ahead of the next message that fits.
+ *
+ * @param [in] ring ring of the current thread
+ * @param [in] str format string compatible with printf()
+ * @param [in] ap arguments of \a str
+ */
+static void
+log_ring_push(struct log_ring *ring, const char *str, va_list ap)
+{
+        unsigned head = ring->head;
+        unsigned space = LOG_RING_SIZE -
+                (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE));
+        struct log_msg *msg;
+        int size;
+
+        /* the drop notice needs a slot of its own */
+        if (space == 0 || (ring->dropped > 0 && space < 2)) {
+                ring->dropped++;
+                log_flusher_wakeup();
+                return;
+        }
+
+        if (ring->dropped > 0) {
+                msg = &ring->msg[head & (LOG_RING_SIZE - 1)];
+                size = snprintf(msg->buf, sizeof(msg->buf),
+                                "WARN: %u log messages dropped\n",
+                                ring->dropped);
+                msg->size = size;
+                msg->seq = __atomic_fetch_add(&m_seq, 1, __ATOMIC_RELAXED);
+                ring->dropped = 0;
+                __atomic_store_n(&ring->head, ++head, __ATOMIC_SEQ_CST);
+        }
+
+        msg = &ring->msg[head & (LOG_RING_SIZE - 1)];
+        size = vsnprintf(msg->buf, sizeof(msg->buf), str, ap);
+        if (size >= 0) {
+                if (size >= (int)sizeof(msg->buf))
+                        size = sizeof(msg->buf) - 1;
+                msg->size = size;
+                msg->seq = __atomic_fetch_add(&m_seq, 1, __ATOMIC_RELAXED);
+                __atomic_store_n(&ring->head, head + 1, __ATOMIC_SEQ_CST);
+        }
+
+        log_flusher_wakeup();
+}
+
+/**
+ * @brief Formats message into ring of the current thread
+ *
+ * @param [in] ring ring of the current thread
+ * @param [in] str format string compatible with printf().
+ *             Variadic arguments to follow depending on \a str.
+ */
+static void
+log_ring_printf(struct log_ring *ring, const char *str, ...)
+{
+        va_list ap;
+
+        va_start(ap, str);
+        log_ring_push(ring, str, ap);
+        va_end(ap);
+}
+
+/**
+ * @brief Delivers messages of all rings in order they were logged
+ *
+ * @return Number of delivered messages
+ */
+static unsigned
+log_flush_rings(void)
+{
+        struct log_ring *rings = __atomic_load_n(&m_rings, __ATOMIC_ACQUIRE);
+        unsigned num = 0;
+
+        for (;;) {
+                struct log_ring *ring, *next = NULL;
+                struct log_msg *msg;
+
+                pthread_mutex_lock(&m_output_lock);
+                for (ring = rings; ring != NULL; ring = ring->next) {
+                        if (__atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) ==
+                            ring->tail)
+                                continue;
+                        msg = &ring->msg[ring->tail & (LOG_RING_SIZE - 1)];
+                        if (next == NULL || msg->seq <
+                            next->msg[next->tail & (LOG_RING_SIZE - 1)].seq)
+                                next = ring;
+                }
+                if (next == NULL) {
+                        pthread_mutex_unlock(&m_output_lock);
+                        break;
+                }
+
+                msg = &next->msg[next->tail & (LOG_RING_SIZE - 1)];
+                log_output(msg->buf, msg->size);
+                __atomic_store_n(&next->tail, next->tail + 1,
+                                 __ATOMIC_RELEASE);
+                pthread_mutex_unlock(&m_output_lock);
+                num++;
+        }
+
+        return num;
+}
+
+/**
+ * @brief Flusher thread
+ *
+ * @param [in] arg not used
+ *
+ * @return NULL
+ */
+static void *
+log_flusher(void *arg)
+{
+        UNUSED_PARAM(arg);
+
+        while (!__atomic_load_n(&m_stop, __ATOMIC_ACQUIRE)) {
+                struct timespec ts;
+
+                if (log_flush_rings() > 0)
+                        continue;
+
+                /* producers wake us up only if we are idle */
+                __atomic_store_n(&m_idle, 1, __ATOMIC_SEQ_CST);
+                if (log_flush_rings() > 0) {
+                        __atomic_store_n(&m_idle, 0, __ATOMIC_SEQ_CST);
+                        continue;
+                }
+
+                clock_gettime(CLOCK_REALTIME, &ts);
+                ts.tv_nsec += LOG_FLUSH_MS * 1000000L;
+                if (ts.tv_nsec >= 1000000000L) {
+                        ts.tv_sec++;
+                        ts.tv_nsec -= 1000000000L;
+                }
+                (void) sem_timedwait(&m_wakeup, &ts);
+                __atomic_store_n(&m_idle, 0, __ATOMIC_SEQ_CST);
+        }
+        (void) log_flush_rings();
+
+        return NULL;
+}
+
+/**
+ * @brief Starts flusher thread
+ *
+ * Logging stays synchronous if the thread can't be started.
+ */
+static void
+log_flusher_start(void)
+{
+        sigset_t all, old;
+
+        (void) pthread_once(&m_once, log_once);
+
+        if (sem_init(&m_wakeup, 0, 0) != 0)
+                return;
+
+        m_stop = 0;
+        m_idle = 0;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        if (pthread_create(&m_flusher, NULL, log_flusher, NULL) == 0)
+                m_async = 1;
+        else
+                sem_destroy(&m_wakeup);
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
+/**
+ * @brief Stops flusher thread once all messages are delivered
+ */
+static void
+log_flusher_stop(void)
+{
+        if (!m_async)
+                return;
+
+        __atomic_store_n(&m_stop, 1, __ATOMIC_RELEASE);
+        sem_post(&m_wakeup);
+        pthread_join(m_flusher, NULL);
+        sem_destroy(&m_wakeup);
+        m_async = 0;
+}
+
+/**
+ * @brief Applies rate limit of call site \a site
+ *
+ * @param [in] site call site state
+ * @param [out] suppressed number of messages suppressed in the previous
+ *              window to be reported
+ *
+ * @return Rate limit status
+ * @retval 0 message to be logged
+ * @retval 1 message suppressed
+ */
+static int
+log_rate_limit(struct log_site *site, unsigned *suppressed)
+{
+        struct timespec ts;
+        unsigned window;
+
+        clock_gettime(LOG_CLOCK, &ts);
+        window = (unsigned)ts.tv_sec;
+
+        *suppressed = 0;
+        if (__atomic_load_n(&site->window, __ATOMIC_RELAXED) != window) {
+                __atomic_store_n(&site->window, window, __ATOMIC_RELAXED);
+                __atomic_store_n(&site->count, 0, __ATOMIC_RELAXED);
+                *suppressed = __atomic_exchange_n(&site->suppressed, 0,
+                                                  __ATOMIC_RELAXED);
+        }
+
+        if (__atomic_add_fetch(&site->count, 1, __ATOMIC_RELAXED) >
+            LOG_RATE_BURST) {
+                __atomic_add_fetch(&site->suppressed, 1, __ATOMIC_RELAXED);
+                return 1;
+        }
+        return 0;
+}
 
 /**
  * =======================================
@@ -118,6 +524,7 @@ log_init(int fd_log, void (*callback_log)(void *, const size_t, const char *),
 	m_fd = fd_log;
 	m_callback_log = callback_log;
 	m_context_log = context_log;
+	log_flusher_start();
 	log_init_successful = 1;
 
         return LOG_RETVAL_OK;
@@ -131,6 +538,8 @@ log_fini(void)
 		return LOG_RETVAL_OK;
         }
 
+        log_flusher_stop();
+
         m_opt = 0;
 	m_fd = -1;
 	m_callback_log = NULL;
@@ -140,11 +549,20 @@ log_fini(void)
         return LOG_RETVAL_OK;
 }
 
-void
-log_printf(int type, const char *str, ...)
+/**
+ * @brief Logs message of call site \a site
+ *
+ * @param [in] site call site state, NULL if not rate limited
+ * @param [in] type log type to be made
+ * @param [in] str format string compatible with printf()
+ * @param [in] ap arguments of \a str
+ */
+static void
+log_vprintf(struct log_site *site, int type, const char *str, va_list ap)
 {
-        va_list ap;
 	char ap_buffer[AP_BUFFER_SIZE];
+        struct log_ring *ring = NULL;
+        unsigned suppressed = 0;
         int size;
 
 	/* If log_init has not been successful then
@@ -163,20 +581,57 @@ log_printf(int type, const char *str, ...)
         if (str == NULL)
                 return;
 
-	va_start(ap, str);
-	ap_buffer[AP_BUFFER_SIZE - 1] = '\0';
-	size = vsnprintf(ap_buffer, AP_BUFFER_SIZE - 1, str, ap);
-	va_end(ap);
+        if (site != NULL && log_rate_limit(site, &suppressed))
+                return;
+
+        if (m_async)
+                ring = log_ring_get();
+
+        if (ring != NULL) {
+                if (suppressed > 0)
+                        log_ring_printf(ring, "WARN: %u similar messages "
+                                        "suppressed\n", suppressed);
+                log_ring_push(ring, str, ap);
+                return;
+        }
+
+        if (suppressed > 0) {
+                size = snprintf(ap_buffer, sizeof(ap_buffer),
+                                "WARN: %u similar messages suppressed\n",
+                                suppressed);
+                pthread_mutex_lock(&m_output_lock);
+                log_output(ap_buffer, size);
+                pthread_mutex_unlock(&m_output_lock);
+        }
+
+	size = vsnprintf(ap_buffer, sizeof(ap_buffer), str, ap);
 	ASSERT(size >= 0);
 	if (size < 0)
 		return;
+        if (size >= (int)sizeof(ap_buffer))
+                size = sizeof(ap_buffer) - 1;
 
-	if (m_callback_log != NULL)
-		m_callback_log(m_context_log, size, ap_buffer);
+        pthread_mutex_lock(&m_output_lock);
+        log_output(ap_buffer, size);
+        pthread_mutex_unlock(&m_output_lock);
+}
 
-	if (m_fd >= 0) {
-		if (write(m_fd, ap_buffer, size) < 0)
-			fprintf(stderr, "%s: printing to file failed\n",
-                                __func__);
-	}
+void
+log_printf(int type, const char *str, ...)
+{
+        va_list ap;
+
+	va_start(ap, str);
+        log_vprintf(NULL, type, str, ap);
+	va_end(ap);
+}
+
+void
+log_printf_site(struct log_site *site, int type, const char *str, ...)
+{
+        va_list ap;
+
+	va_start(ap, str);
+        log_vprintf(site, type, str, ap);
+	va_end(ap);
 }
@@ -65,10 +65,44 @@ extern "C" {
 #define LOG_OPT_SUPER_VERBOSE   (LOG_OPT_WARN|LOG_OPT_ERROR|LOG_OPT_INFO| \
                                  LOG_OPT_DEBUG)
 
-#define LOG_INFO(str...)  log_printf(LOG_OPT_INFO, "INFO: " str)
-#define LOG_WARN(str...)  log_printf(LOG_OPT_WARN, "WARN: " str)
-#define LOG_ERROR(str...) log_printf(LOG_OPT_ERROR, "ERROR: " str)
-#define LOG_DEBUG(str...) log_printf(LOG_OPT_DEBUG, "DEBUG: " str)
+/**
+ * Log types built into the library, calls of other types are elided
+ * at compile time, e.g. EXTRA_CFLAGS=-DLOG_OPT_BUILD=LOG_OPT_DEFAULT
+ */
+#ifndef LOG_OPT_BUILD
+#define LOG_OPT_BUILD           LOG_OPT_SUPER_VERBOSE
+#endif
+
+#define LOG_RATE_BURST          10        /**< warning and error messages
+                                             per call site and second */
+
+/**
+ * Call site rate limit state
+ */
+struct log_site {
+        unsigned window;                  /**< current second */
+        unsigned count;                   /**< messages in the window */
+        unsigned suppressed;              /**< messages over the limit */
+};
+
+#define LOG_BUILD_PRINTF(type, str...)                                  \
+        do {                                                            \
+                if (LOG_OPT_BUILD & (type))                             \
+                        log_printf(type, str);                          \
+        } while (0)
+
+#define LOG_SITE_PRINTF(type, str...)                                   \
+        do {                                                            \
+                static struct log_site __log_site;                      \
+                                                                        \
+                if (LOG_OPT_BUILD & (type))                             \
+                        log_printf_site(&__log_site, type, str);        \
+        } while (0)
+
+#define LOG_INFO(str...)  LOG_BUILD_PRINTF(LOG_OPT_INFO, "INFO: " str)
+#define LOG_WARN(str...)  LOG_SITE_PRINTF(LOG_OPT_WARN, "WARN: " str)
+#define LOG_ERROR(str...) LOG_SITE_PRINTF(LOG_OPT_ERROR, "ERROR: " str)
+#define LOG_DEBUG(str...) LOG_BUILD_PRINTF(LOG_OPT_DEBUG, "DEBUG: " str)
 
 /**
  * @brief Initializes PQoS log module
@@ -84,6 +118,9 @@ extern "C" {
  *  [5] keep all logging silent
  *  @note log_init(-1, NULL, NULL, LOG_VER_SILENT);
  *
+ * Messages are delivered by a flusher thread, \a callback_log is
+ * called from that thread.
+ *
  * @param [in] fd_log file descriptor to be used as library log
  * @param [in] callback_log pointer to an application callback function
  *         void *       - An application context - it can point to a structure
@@ -125,6 +162,19 @@ int log_fini(void);
  */
 void log_printf(int type, const char *str, ...);
 
+/**
+ * @brief PQoS log function of rate limited call site
+ *
+ * Messages over LOG_RATE_BURST a second are suppressed, their number
+ * is reported with the next message of the call site.
+ *
+ * @param [in] site call site state
+ * @param [in] type log type to be made
+ * @param [in] str format string compatible with printf().
+ *             Variadic arguments to follow depending on \a str.
+ */
+void log_printf_site(struct log_site *site, int type, const char *str, ...);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -51,6 +52,9 @@
 #include <sys/cpuctl.h>
 #include <sys/ioctl.h>
 #endif
+#ifdef __linux__
+#include <sys/ioctl.h>
+#endif
 
 #include "machine.h"
 #include "log.h"
@@ -58,6 +62,34 @@
 static int *m_msr_fd = NULL;           /**< MSR driver file descriptors table */
 static unsigned m_maxcores = 0;        /**< max number of cores (size of the
                                           table above too) */
+static int m_batch_fd = -1;            /**< msr-safe batch device */
+static int m_batch_disabled = 0;       /**< driver has no batch ioctl */
+
+#ifdef __linux__
+#define MSR_BATCH_DEVICE "/dev/cpu/msr_batch"
+
+/**
+ * msr-safe batch operation, layout defined by the msr-safe driver
+ */
+struct msr_safe_batch_op {
+        uint16_t cpu;                  /**< core to execute operation on */
+        uint16_t isrdmsr;              /**< 0 for WRMSR, RDMSR otherwise */
+        int32_t err;                   /**< operation error */
+        uint32_t msr;                  /**< MSR address */
+        uint64_t msrdata;              /**< value to write or value read */
+        uint64_t wmask;                /**< applied write mask */
+};
+
+/**
+ * msr-safe batch table
+ */
+struct msr_safe_batch_array {
+        uint32_t numops;
+        struct msr_safe_batch_op *ops;
+};
+
+#define X86_IOC_MSR_BATCH _IOWR('c', 0xA2, struct msr_safe_batch_array)
+#endif /* __linux__ */
 
 int
 machine_init(const unsigned max_core_id)
@@ -83,6 +115,13 @@ machine_init(const unsigned max_core_id)
         for (i = 0; i < m_maxcores; i++)
                 m_msr_fd[i] = -1;
 
+#ifdef __linux__
+        m_batch_disabled = 0;
+        m_batch_fd = open(MSR_BATCH_DEVICE, O_RDWR);
+        if (m_batch_fd >= 0)
+                LOG_INFO("Using %s for batched MSR access\n",
+                         MSR_BATCH_DEVICE);
+#endif
         return MACHINE_RETVAL_OK;
 }
 
@@ -108,6 +147,11 @@ machine_fini(void)
         m_msr_fd = NULL;
         m_maxcores = 0;
 
+        if (m_batch_fd >= 0) {
+                close(m_batch_fd);
+                m_batch_fd = -1;
+        }
+
         return MACHINE_RETVAL_OK;
 }
 
@@ -165,7 +209,7 @@ msr_file_open(const unsigned lcore)
         ASSERT(lcore < m_maxcores);
         ASSERT(m_msr_fd != NULL);
 
-        int fd = m_msr_fd[lcore];
+        int fd = __atomic_load_n(&m_msr_fd[lcore], __ATOMIC_ACQUIRE);
 
         if (fd < 0) {
                 char fname[32];
@@ -180,10 +224,20 @@ msr_file_open(const unsigned lcore)
                          "/dev/cpuctl%u", lcore);
 #endif
                 fd = open(fname, O_RDWR);
-                if (fd < 0)
+                if (fd < 0) {
                         LOG_WARN("Error opening file '%s'!\n", fname);
-                else
-                        m_msr_fd[lcore] = fd;
+                } else {
+                        int cur = -1;
+
+                        /* API calls of different resources run in parallel */
+                        if (!__atomic_compare_exchange_n(&m_msr_fd[lcore],
+                                                         &cur, fd, 0,
+                                                         __ATOMIC_ACQ_REL,
+                                                         __ATOMIC_ACQUIRE)) {
+                                close(fd);
+                                fd = cur;
+                        }
+                }
         }
 
         return fd;
@@ -285,3 +339,230 @@ msr_write(const unsigned lcore,
 
         return ret;
 }
+
+void
+msr_batch_init(struct msr_batch *batch)
+{
+        ASSERT(batch != NULL);
+        memset(batch, 0, sizeof(*batch));
+}
+
+void
+msr_batch_fini(struct msr_batch *batch)
+{
+        ASSERT(batch != NULL);
+        free(batch->ops);
+        free(batch->sys_ops);
+        memset(batch, 0, sizeof(*batch));
+}
+
+void
+msr_batch_clear(struct msr_batch *batch)
+{
+        ASSERT(batch != NULL);
+        batch->num_ops = 0;
+}
+
+/**
+ * @brief Appends operation to \a batch growing its tables if needed
+ * @param batch batch to add operation to
+ * @return Pointer to the new operation
+ * @retval NULL on error
+ */
+static struct msr_batch_op *
+msr_batch_add(struct msr_batch *batch, const unsigned lcore)
+{
+        struct msr_batch_op *op;
+
+        ASSERT(batch != NULL);
+        if (batch == NULL || lcore >= m_maxcores)
+                return NULL;
+
+        if (batch->num_ops == batch->max_ops) {
+                const unsigned max_ops =
+                        batch->max_ops == 0 ? 64 : batch->max_ops * 2;
+                void *ops = realloc(batch->ops, max_ops * sizeof(*op));
+
+                if (ops == NULL)
+                        return NULL;
+                batch->ops = ops;
+                /* driver table is reallocated on next submit */
+                free(batch->sys_ops);
+                batch->sys_ops = NULL;
+                batch->max_ops = max_ops;
+        }
+        op = &batch->ops[batch->num_ops++];
+        op->lcore = lcore;
+        op->err = MACHINE_RETVAL_OK;
+        return op;
+}
+
+int
+msr_batch_read(struct msr_batch *batch,
+               const unsigned lcore,
+               const uint32_t reg)
+{
+        struct msr_batch_op *op = msr_batch_add(batch, lcore);
+
+        if (op == NULL)
+                return -1;
+        op->reg = reg;
+        op->write = 0;
+        op->value = 0;
+        return (int)(op - batch->ops);
+}
+
+int
+msr_batch_write(struct msr_batch *batch,
+                const unsigned lcore,
+                const uint32_t reg,
+                const uint64_t value)
+{
+        struct msr_batch_op *op;
+        unsigned i;
+
+        ASSERT(batch != NULL);
+        if (batch == NULL)
+                return MACHINE_RETVAL_PARAM;
+
+        /**
+         * Drop the write if the register already holds the value,
+         * i.e. the last write queued to it was the same.
+         */
+        for (i = batch->num_ops; i > 0; i--) {
+                op = &batch->ops[i - 1];
+                if (!op->write || op->lcore != lcore || op->reg != reg)
+                        continue;
+                if (op->value == value)
+                        return MACHINE_RETVAL_OK;
+                break;
+        }
+
+        op = msr_batch_add(batch, lcore);
+        if (op == NULL)
+                return MACHINE_RETVAL_ERROR;
+        op->reg = reg;
+        op->write = 1;
+        op->value = value;
+        return MACHINE_RETVAL_OK;
+}
+
+#ifdef __linux__
+/**
+ * @brief Executes \a batch with a single msr-safe ioctl
+ * @param batch batch to execute
+ * @param unsupported set to 1 if the driver has no batch support
+ * @return Operation status
+ * @retval MACHINE_RETVAL_OK all operations executed
+ * @retval MACHINE_RETVAL_ERROR batch not executed
+ */
+static int
+msr_batch_submit_ioctl(struct msr_batch *batch, int *unsupported)
+{
+        struct msr_safe_batch_op *sys_ops = batch->sys_ops;
+        struct msr_safe_batch_array arr;
+        unsigned i;
+
+        *unsupported = 0;
+        if (sys_ops == NULL) {
+                sys_ops = malloc(batch->max_ops * sizeof(*sys_ops));
+                if (sys_ops == NULL)
+                        return MACHINE_RETVAL_ERROR;
+                batch->sys_ops = sys_ops;
+        }
+
+        for (i = 0; i < batch->num_ops; i++) {
+                const struct msr_batch_op *op = &batch->ops[i];
+
+                memset(&sys_ops[i], 0, sizeof(sys_ops[i]));
+                sys_ops[i].cpu = (uint16_t)op->lcore;
+                sys_ops[i].isrdmsr = !op->write;
+                sys_ops[i].msr = op->reg;
+                sys_ops[i].msrdata = op->value;
+        }
+        arr.numops = batch->num_ops;
+        arr.ops = sys_ops;
+
+        /**
+         * msr-safe validates all operations before running any, on
+         * a per operation error (allowlist, offline CPU) nothing is
+         * executed and results are not valid
+         */
+        if (ioctl(m_batch_fd, X86_IOC_MSR_BATCH, &arr) < 0) {
+                const int err = errno;
+                int op_err = 0;
+
+                for (i = 0; i < batch->num_ops; i++) {
+                        if (sys_ops[i].err == 0)
+                                continue;
+                        op_err = 1;
+                        LOG_DEBUG("MSR batch: %s reg[0x%x] on "
+                                  "lcore %u rejected (%d)\n",
+                                  batch->ops[i].write ?
+                                  "WRMSR" : "RDMSR",
+                                  (unsigned)batch->ops[i].reg,
+                                  batch->ops[i].lcore,
+                                  sys_ops[i].err);
+                }
+                /* unknown ioctl, not a failure of one of the operations */
+                *unsupported = !op_err && (err == ENOTTY || err == EINVAL);
+                return MACHINE_RETVAL_ERROR;
+        }
+
+        for (i = 0; i < batch->num_ops; i++) {
+                struct msr_batch_op *op = &batch->ops[i];
+
+                op->err = MACHINE_RETVAL_OK;
+                if (!op->write)
+                        op->value = sys_ops[i].msrdata;
+        }
+        return MACHINE_RETVAL_OK;
+}
+#endif /* __linux__ */
+
+int
+msr_batch_submit(struct msr_batch *batch)
+{
+        int ret = MACHINE_RETVAL_OK;
+        unsigned i;
+
+        ASSERT(batch != NULL);
+        if (batch == NULL)
+                return MACHINE_RETVAL_PARAM;
+        if (batch->num_ops == 0)
+                return MACHINE_RETVAL_OK;
+
+#ifdef __linux__
+        /* batches may be submitted from poller threads concurrently */
+        if (m_batch_fd >= 0 &&
+            !__atomic_load_n(&m_batch_disabled, __ATOMIC_RELAXED)) {
+                int unsupported;
+
+                if (msr_batch_submit_ioctl(batch, &unsupported) ==
+                    MACHINE_RETVAL_OK)
+                        return MACHINE_RETVAL_OK;
+                /**
+                 * Nothing was executed, run operations one by one.
+                 * Errors of single operations (allowlist, offline CPU)
+                 * fall back for this batch only.
+                 */
+                if (unsupported &&
+                    !__atomic_exchange_n(&m_batch_disabled, 1,
+                                         __ATOMIC_RELAXED))
+                        LOG_WARN("MSR batch ioctl failed, "
+                                 "falling back to MSR driver\n");
+        }
+#endif
+
+        for (i = 0; i < batch->num_ops; i++) {
+                struct msr_batch_op *op = &batch->ops[i];
+
+                if (op->write)
+                        op->err = msr_write(op->lcore, op->reg, op->value);
+                else
+                        op->err = msr_read(op->lcore, op->reg, &op->value);
+                if (op->err != MACHINE_RETVAL_OK)
+                        ret = MACHINE_RETVAL_ERROR;
+        }
+        return ret;
+}
@@ -126,6 +126,96 @@ msr_write(const unsigned lcore,
           const uint32_t reg,
           const uint64_t value);
 
+/**
+ * MSR operation queued in a batch
+ */
+struct msr_batch_op {
+        unsigned lcore;                 /**< logical core id */
+        uint32_t reg;                   /**< MSR address */
+        int write;                      /**< 1 for WRMSR, 0 for RDMSR */
+        int err;                        /**< MACHINE_RETVAL_* of this
+                                             operation after submit */
+        uint64_t value;                 /**< value to write or value read */
+};
+
+/**
+ * Queue of MSR operations executed by msr_batch_submit()
+ */
+struct msr_batch {
+        struct msr_batch_op *ops;       /**< queued operations */
+        unsigned num_ops;               /**< number of queued operations */
+        unsigned max_ops;               /**< size of the tables */
+        void *sys_ops;                  /**< driver batch table */
+};
+
+/**
+ * @brief Initializes empty MSR batch
+ * @param [out] batch batch to initialize
+ */
+void msr_batch_init(struct msr_batch *batch);
+
+/**
+ * @brief Frees memory of MSR batch
+ * @param [in] batch batch to free
+ */
+void msr_batch_fini(struct msr_batch *batch);
+
+/**
+ * @brief Removes all operations from the batch, memory is kept for reuse
+ * @param [in] batch batch to clear
+ */
+void msr_batch_clear(struct msr_batch *batch);
+
+/**
+ * @brief Queues RDMSR of \a reg on \a lcore
+ *
+ * Read value is available in batch->ops[index].value after
+ * msr_batch_submit().
+ *
+ * @param [in] batch batch to add operation to
+ * @param [in] lcore logical core id
+ * @param [in] reg MSR to read from
+ * @return Index of the operation in batch->ops
+ * @retval -1 on error
+ */
+int
+msr_batch_read(struct msr_batch *batch,
+               const unsigned lcore,
+               const uint32_t reg);
+
+/**
+ * @brief Queues WRMSR of \a value into \a reg on \a lcore
+ *
+ * The write is dropped if the same value is already the last one queued
+ * for \a reg on \a lcore.
+ *
+ * @param [in] batch batch to add operation to
+ * @param [in] lcore logical core id
+ * @param [in] reg MSR to write to
+ * @param [in] value to be written into \a reg
+ * @return Operation status
+ * @retval MACHINE_RETVAL_OK on success
+ */
+int
+msr_batch_write(struct msr_batch *batch,
+                const unsigned lcore,
+                const uint32_t reg,
+                const uint64_t value);
+
+/**
+ * @brief Executes all queued operations
+ *
+ * Operations on the same logical core are executed in queue order.
+ * The msr-safe batch device executes the whole queue in a single ioctl
+ * when it is available, otherwise operations are executed one by one.
+ *
+ * @param [in] batch batch to execute
+ * @return Operation status
+ * @retval MACHINE_RETVAL_OK if all operations succeeded
+ * @retval MACHINE_RETVAL_ERROR if any operation failed, see ops[].err
+ */
+int msr_batch_submit(struct msr_batch *batch);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,7 @@
 #include <pthread.h>
 #include <dirent.h>
 #include <stdbool.h>
+#include <time.h>
 
 #include "pqos.h"
 #include "cap.h"
@@ -50,6 +51,7 @@
 #include "os_monitoring.h"
 
 #include "machine.h"
+#include "poller.h"
 #include "types.h"
 #include "log.h"
 
@@ -131,12 +133,67 @@
  */
 #define MBM_MAX_VALUE (1 << 24)
 
+/**
+ * Minimum time between background checks of RMIDs in limbo
+ */
+#define RMID_LIMBO_CHECK_MS 100
+
 /**
  * ---------------------------------------
  * Local data types
  * ---------------------------------------
  */
 
+/**
+ * State of an RMID in the pool of its cluster
+ */
+enum rmid_state {
+        RMID_FOREIGN = 0,       /**< associated by another process or RMID0 */
+        RMID_FREE,              /**< on the free list */
+        RMID_USED,              /**< owned by a monitoring group */
+        RMID_LIMBO,             /**< released, stale occupancy not drained */
+};
+
+/**
+ * RMID released by a monitoring group and waiting for its LLC occupancy
+ * to drop before reuse
+ */
+struct rmid_limbo {
+        pqos_rmid_t rmid;               /**< resource monitoring id */
+        uint64_t occupancy;             /**< raw occupancy at last check */
+};
+
+/**
+ * RMIDs of one L3 cluster
+ */
+struct rmid_pool {
+        unsigned cluster;               /**< L3 cluster id */
+        unsigned lcore;                 /**< core used for occupancy reads */
+        unsigned char *state;           /**< enum rmid_state of each RMID */
+        pqos_rmid_t *free;              /**< free RMIDs, ascending */
+        unsigned num_free;              /**< number of free RMIDs */
+        struct rmid_limbo *limbo;       /**< RMIDs in limbo */
+        unsigned num_limbo;             /**< number of RMIDs in limbo */
+};
+
+/**
+ * RMID multiplexing state of a monitoring group
+ */
+struct pqos_mon_mux {
+        struct pqos_mon_data *group;    /**< multiplexed group */
+        int scheduled;                  /**< cores associated with own RMIDs */
+        unsigned samples;               /**< measured polls in this turn */
+        uint64_t since;                 /**< start of turn or wait (us) */
+        uint64_t last_poll;             /**< time of previous poll (us) */
+        uint64_t measured;              /**< end of last measured window */
+        uint64_t window;                /**< length of last measured window */
+        double rate_local;              /**< local bandwidth, bytes per us */
+        double rate_total;              /**< total bandwidth, bytes per us */
+        int llc_clean;                  /**< RMIDs of the turn were drained */
+        uint64_t llc;                   /**< last valid occupancy */
+        uint64_t llc_measured;          /**< time of last valid occupancy */
+};
+
 /**
  * ---------------------------------------
  * Local data structures
@@ -147,6 +204,49 @@ static const struct pqos_cap *m_cap = NULL; /**< capabilities structure
 static const struct pqos_cpuinfo *m_cpu = NULL; /**< cpu topology passed
                                                    from cap */
 static unsigned m_rmid_max = 0;         /**< max RMID */
+static struct msr_batch m_poll_batch;   /**< MSR operations of a poll */
+static struct rmid_pool *m_rmid_pools = NULL; /**< pool per L3 cluster */
+static unsigned m_rmid_pools_num = 0;   /**< number of RMID pools */
+static int m_limbo_occup = 0;           /**< LLC occupancy readable */
+static uint64_t m_limbo_threshold = 0;  /**< raw occupancy of drained RMID */
+static uint64_t m_limbo_check = 0;      /**< time of last limbo check (us) */
+static unsigned m_mux_samples = 0;      /**< measured polls per turn of
+                                           multiplexed group, 0 - off */
+static struct pqos_mon_mux **m_mux = NULL; /**< multiplexed groups */
+static unsigned m_mux_num = 0;          /**< number of multiplexed groups */
+
+/**
+ * RMID events read by a poll, index of totals in struct mon_poll_part
+ */
+static const enum pqos_mon_event m_rmid_events[] = {
+        PQOS_MON_EVENT_L3_OCCUP,
+        PQOS_MON_EVENT_LMEM_BW,
+        PQOS_MON_EVENT_TMEM_BW,
+};
+
+/**
+ * Counter sums of a monitoring group read on one or all L3 clusters
+ */
+struct mon_poll_part {
+        int ret;                        /**< read status */
+        uint64_t totals[DIM(m_rmid_events)]; /**< RMID event sums */
+        uint64_t retired;               /**< instructions retired */
+        uint64_t unhalted;              /**< unhalted reference cycles */
+        uint64_t missed;                /**< LLC misses */
+};
+
+/**
+ * Groups polled in parallel by the poller pool
+ */
+struct mon_poll_job {
+        struct pqos_mon_data **groups;  /**< groups to poll */
+        unsigned num_groups;            /**< number of groups */
+        struct mon_poll_part *parts;    /**< num_groups x workers parts */
+};
+
+static struct msr_batch *m_worker_batch = NULL; /**< batch per worker */
+static struct mon_poll_part *m_poll_parts = NULL; /**< parallel poll parts */
+static unsigned m_poll_parts_num = 0;   /**< size of m_poll_parts */
 #ifdef __linux__
 static int m_interface = PQOS_INTER_MSR;
 #endif
@@ -173,11 +273,37 @@ mon_read(const unsigned lcore,
 static int
 pqos_core_poll(struct pqos_mon_data *group);
 
+static int
+mon_poller_init(const struct pqos_cpuinfo *cpu);
+
+static void
+mon_poller_fini(void);
+
 static int
 rmid_alloc(const unsigned cluster,
            const enum pqos_mon_event event,
            pqos_rmid_t *rmid);
 
+static void
+rmid_release(const unsigned cluster,
+             const pqos_rmid_t rmid,
+             const int limbo);
+
+static void
+rmid_limbo_check(void);
+
+static void
+rmid_pool_reset(void);
+
+static void
+rmid_pool_fini(void);
+
+static void
+mon_mux_rotate(void);
+
+static void
+mon_mux_fini(void);
+
 static unsigned
 get_event_id(const enum pqos_mon_event event);
 
@@ -204,6 +330,7 @@ pqos_mon_init(const struct pqos_cpuinfo *cpu,
             const struct pqos_config *cfg)
 {
         const struct pqos_capability *item = NULL;
+        unsigned i;
         int ret;
 
 	ASSERT(cfg != NULL);
@@ -226,6 +353,26 @@ pqos_mon_init(const struct pqos_cpuinfo *cpu,
         }
 
         LOG_DEBUG("Max RMID per monitoring cluster is %u\n", m_rmid_max);
+        if (cfg->interface == PQOS_INTER_MSR)
+                m_mux_samples = cfg->mon_multiplex;
+
+        /**
+         * Released RMID is considered drained once its occupancy drops
+         * to a fair share of the LLC
+         */
+        m_limbo_occup = 0;
+        m_limbo_threshold = 0;
+        for (i = 0; i < item->u.mon->num_events; i++) {
+                const struct pqos_monitor *pmon = &item->u.mon->events[i];
+
+                if (pmon->type != PQOS_MON_EVENT_L3_OCCUP ||
+                    pmon->scale_factor == 0)
+                        continue;
+                m_limbo_occup = 1;
+                if (cpu->l3.detected)
+                        m_limbo_threshold = cpu->l3.total_size / m_rmid_max /
+                                pmon->scale_factor;
+        }
 #ifdef __linux__
         if (cfg->interface == PQOS_INTER_OS)
                 ret = os_mon_init(cpu, cap);
@@ -237,18 +384,72 @@ pqos_mon_init(const struct pqos_cpuinfo *cpu,
         m_cap = cap;
 #ifdef __linux__
         m_interface = cfg->interface;
-#else
-        UNUSED_PARAM(cfg);
 #endif
+        if (ret == PQOS_RETVAL_OK && cfg->parallel_poll &&
+            cfg->interface == PQOS_INTER_MSR)
+                ret = mon_poller_init(cpu);
         return ret;
 }
 
+/**
+ * @brief Starts poller pool and allocates MSR batch of each worker
+ *
+ * @param cpu cpu topology structure
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+static int
+mon_poller_init(const struct pqos_cpuinfo *cpu)
+{
+        unsigned i;
+        int ret;
+
+        ret = poller_init(cpu);
+        if (ret != PQOS_RETVAL_OK || poller_num_workers() == 0)
+                return ret;
+
+        m_worker_batch = calloc(poller_num_workers(),
+                                sizeof(m_worker_batch[0]));
+        if (m_worker_batch == NULL) {
+                poller_fini();
+                return PQOS_RETVAL_RESOURCE;
+        }
+        for (i = 0; i < poller_num_workers(); i++)
+                msr_batch_init(&m_worker_batch[i]);
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Stops poller pool and frees memory of parallel polling
+ */
+static void
+mon_poller_fini(void)
+{
+        unsigned i;
+
+        if (m_worker_batch != NULL) {
+                for (i = 0; i < poller_num_workers(); i++)
+                        msr_batch_fini(&m_worker_batch[i]);
+                free(m_worker_batch);
+                m_worker_batch = NULL;
+        }
+        poller_fini();
+        free(m_poll_parts);
+        m_poll_parts = NULL;
+        m_poll_parts_num = 0;
+}
+
 int
 pqos_mon_fini(void)
 {
         int ret = PQOS_RETVAL_OK;
 
+        mon_mux_fini();
+        rmid_pool_fini();
         m_rmid_max = 0;
+        mon_poller_fini();
+        msr_batch_fini(&m_poll_batch);
 #ifdef __linux__
         if (m_interface == PQOS_INTER_OS)
                 ret = os_mon_fini();
@@ -270,30 +471,295 @@ pqos_mon_fini(void)
  */
 
 /**
- * @brief Allocates RMID for given \a event
+ * @brief Returns monotonic time in microseconds
+ */
+static uint64_t
+mon_time_us(void)
+{
+        struct timespec ts;
+
+        if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+                return 0;
+        return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief Puts \a rmid on the free list of \a pool keeping it sorted
  *
- * @param [in] cluster CPU cluster id
- * @param [in] event Monitoring event type
+ * @param pool RMID pool
+ * @param rmid resource monitoring id
+ */
+static void
+rmid_free_push(struct rmid_pool *pool, const pqos_rmid_t rmid)
+{
+        unsigned i = pool->num_free;
+
+        ASSERT(pool->num_free < m_rmid_max);
+        while (i > 0 && pool->free[i - 1] > rmid) {
+                pool->free[i] = pool->free[i - 1];
+                i--;
+        }
+        pool->free[i] = rmid;
+        pool->num_free++;
+        pool->state[rmid] = RMID_FREE;
+}
+
+/**
+ * @brief Rebuilds free list of \a pool from current core associations
+ *
+ * RMIDs owned by this process or in limbo are left untouched. Remaining
+ * ones are free unless a core of the cluster is associated with them.
+ *
+ * @param pool RMID pool
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+rmid_pool_scan(struct rmid_pool *pool)
+{
+        unsigned *core_list = NULL;
+        unsigned char *seen = NULL;
+        unsigned i, core_count = 0;
+        int ret = PQOS_RETVAL_OK;
+
+        core_list = pqos_cpu_get_cores_l3id(m_cpu, pool->cluster, &core_count);
+        if (core_list == NULL)
+                return PQOS_RETVAL_ERROR;
+        ASSERT(core_count > 0);
+
+        seen = calloc(m_rmid_max, sizeof(seen[0]));
+        if (seen == NULL) {
+                ret = PQOS_RETVAL_RESOURCE;
+                goto rmid_pool_scan_exit;
+        }
+
+        for (i = 0; i < core_count; i++) {
+                pqos_rmid_t rmid;
+
+                ret = mon_assoc_get(core_list[i], &rmid);
+                if (ret != PQOS_RETVAL_OK)
+                        goto rmid_pool_scan_exit;
+                if (rmid < m_rmid_max)
+                        seen[rmid] = 1;
+        }
+        pool->lcore = core_list[0];
+
+        pool->num_free = 0;
+        for (i = RMID0 + 1; i < m_rmid_max; i++) {
+                if (pool->state[i] == RMID_USED ||
+                    pool->state[i] == RMID_LIMBO)
+                        continue;
+                if (seen[i])
+                        pool->state[i] = RMID_FOREIGN;
+                else
+                        pool->free[pool->num_free++] = i;
+        }
+        for (i = 0; i < pool->num_free; i++)
+                pool->state[pool->free[i]] = RMID_FREE;
+
+ rmid_pool_scan_exit:
+        free(seen);
+        free(core_list);
+        return ret;
+}
+
+/**
+ * @brief Finds RMID pool of \a cluster, creates it on first use
+ *
+ * Creating the pool is the only time all core associations of the
+ * cluster are read.
+ *
+ * @param cluster L3 cluster id
+ *
+ * @return RMID pool
+ * @retval NULL on error
+ */
+static struct rmid_pool *
+rmid_pool_get(const unsigned cluster)
+{
+        struct rmid_pool *pools, *pool;
+        unsigned i;
+
+        for (i = 0; i < m_rmid_pools_num; i++)
+                if (m_rmid_pools[i].cluster == cluster)
+                        return &m_rmid_pools[i];
+
+        pools = realloc(m_rmid_pools,
+                        (m_rmid_pools_num + 1) * sizeof(m_rmid_pools[0]));
+        if (pools == NULL)
+                return NULL;
+        m_rmid_pools = pools;
+
+        pool = &m_rmid_pools[m_rmid_pools_num];
+        memset(pool, 0, sizeof(*pool));
+        pool->cluster = cluster;
+        pool->state = calloc(m_rmid_max, sizeof(pool->state[0]));
+        pool->free = calloc(m_rmid_max, sizeof(pool->free[0]));
+        pool->limbo = calloc(m_rmid_max, sizeof(pool->limbo[0]));
+        if (pool->state == NULL || pool->free == NULL || pool->limbo == NULL ||
+            rmid_pool_scan(pool) != PQOS_RETVAL_OK) {
+                free(pool->state);
+                free(pool->free);
+                free(pool->limbo);
+                return NULL;
+        }
+        m_rmid_pools_num++;
+
+        LOG_DEBUG("RMID pool of cluster %u: %u free\n",
+                  cluster, pool->num_free);
+        return pool;
+}
+
+/**
+ * @brief Moves RMIDs of \a pool that have drained from limbo to free list
+ *
+ * An RMID is drained once its LLC occupancy is at or below the threshold,
+ * i.e. it no longer carries lines of the group that released it.
+ *
+ * @param pool RMID pool
+ */
+static void
+rmid_limbo_drain(struct rmid_pool *pool)
+{
+        const unsigned event = get_event_id(PQOS_MON_EVENT_L3_OCCUP);
+        unsigned i = 0;
+
+        while (i < pool->num_limbo) {
+                struct rmid_limbo *l = &pool->limbo[i];
+                uint64_t occupancy = 0;
+
+                if (m_limbo_occup &&
+                    mon_read(pool->lcore, l->rmid, event,
+                             &occupancy) == PQOS_RETVAL_OK &&
+                    occupancy > m_limbo_threshold) {
+                        l->occupancy = occupancy;
+                        i++;
+                        continue;
+                }
+                rmid_free_push(pool, l->rmid);
+                *l = pool->limbo[--pool->num_limbo];
+        }
+}
+
+/**
+ * @brief Drains RMIDs in limbo of all clusters
+ *
+ * Called from polling so that released RMIDs become free in the
+ * background, at most every RMID_LIMBO_CHECK_MS.
+ */
+static void
+rmid_limbo_check(void)
+{
+        uint64_t now;
+        unsigned i;
+
+        for (i = 0; i < m_rmid_pools_num; i++)
+                if (m_rmid_pools[i].num_limbo > 0)
+                        break;
+        if (i >= m_rmid_pools_num)
+                return;
+
+        now = mon_time_us();
+        if (now - m_limbo_check < RMID_LIMBO_CHECK_MS * 1000)
+                return;
+        m_limbo_check = now;
+
+        for (i = 0; i < m_rmid_pools_num; i++)
+                rmid_limbo_drain(&m_rmid_pools[i]);
+}
+
+/**
+ * @brief Takes highest free RMID of \a pool below \a max_rmid
+ *
+ * High RMIDs go first in order to preserve low RMID values
+ * for overlapping RMID ranges for future events.
+ *
+ * @param pool RMID pool
+ * @param max_rmid max RMID supported by requested events
+ * @param [out] rmid resource monitoring id
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_ERROR no free RMID
+ */
+static int
+rmid_free_pop(struct rmid_pool *pool,
+              const unsigned max_rmid,
+              pqos_rmid_t *rmid)
+{
+        unsigned i;
+
+        for (i = pool->num_free; i > 0; i--)
+                if (pool->free[i - 1] < max_rmid)
+                        break;
+        if (i == 0)
+                return PQOS_RETVAL_ERROR;
+
+        *rmid = pool->free[i - 1];
+        for (; i < pool->num_free; i++)
+                pool->free[i - 1] = pool->free[i];
+        pool->num_free--;
+        pool->state[*rmid] = RMID_USED;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Takes RMID with the lowest occupancy out of limbo
+ *
+ * Last resort when the cluster runs out of RMIDs.
+ *
+ * @param pool RMID pool
+ * @param max_rmid max RMID supported by requested events
  * @param [out] rmid resource monitoring id
  *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_ERROR no RMID in limbo
+ */
+static int
+rmid_limbo_steal(struct rmid_pool *pool,
+                 const unsigned max_rmid,
+                 pqos_rmid_t *rmid)
+{
+        unsigned i, best = pool->num_limbo;
+
+        for (i = 0; i < pool->num_limbo; i++) {
+                if (pool->limbo[i].rmid >= max_rmid)
+                        continue;
+                if (best == pool->num_limbo ||
+                    pool->limbo[i].occupancy < pool->limbo[best].occupancy)
+                        best = i;
+        }
+        if (best == pool->num_limbo)
+                return PQOS_RETVAL_ERROR;
+
+        *rmid = pool->limbo[best].rmid;
+        LOG_INFO("Reusing RMID%u of cluster %u before its occupancy "
+                 "drained\n", (unsigned) *rmid, pool->cluster);
+        pool->limbo[best] = pool->limbo[--pool->num_limbo];
+        pool->state[*rmid] = RMID_USED;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Finds max RMID supported by all of \a event
+ *
+ * @param [in] event Monitoring event type
+ * @param [out] max_rmid max RMID
+ *
  * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_ERROR if any of \a event is not supported
  */
 static int
-rmid_alloc(const unsigned cluster,
-           const enum pqos_mon_event event,
-           pqos_rmid_t *rmid)
+rmid_event_max(const enum pqos_mon_event event, unsigned *max_rmid)
 {
         const struct pqos_capability *item = NULL;
         const struct pqos_cap_mon *mon = NULL;
-        int ret = PQOS_RETVAL_OK;
-        unsigned max_rmid = 0;
         unsigned mask_found = 0;
-        unsigned i, core_count;
-        unsigned *core_list = NULL;
-        pqos_rmid_t *rmid_list = NULL;
-
-        if (rmid == NULL)
-                return PQOS_RETVAL_PARAM;
+        unsigned i;
+        int ret;
 
         /**
          * This is not so straight forward as it appears to be.
@@ -311,64 +777,486 @@ rmid_alloc(const unsigned cluster,
         ASSERT(item != NULL);
         mon = item->u.mon;
 
-        /* Find which events are supported vs requested */
-        max_rmid = m_rmid_max;
-        for (i = 0; i < mon->num_events; i++)
-                if (event & mon->events[i].type) {
-                        mask_found |= mon->events[i].type;
-                        max_rmid = (max_rmid > mon->events[i].max_rmid) ?
-                                    mon->events[i].max_rmid : max_rmid;
+        /* Find which events are supported vs requested */
+        *max_rmid = m_rmid_max;
+        for (i = 0; i < mon->num_events; i++)
+                if (event & mon->events[i].type) {
+                        mask_found |= mon->events[i].type;
+                        *max_rmid = (*max_rmid > mon->events[i].max_rmid) ?
+                                    mon->events[i].max_rmid : *max_rmid;
+                }
+
+        /**
+         * Check if all of the events are supported
+         */
+        if (event != mask_found || *max_rmid == 0)
+                return PQOS_RETVAL_ERROR;
+        ASSERT(m_rmid_max >= *max_rmid);
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Allocates RMID for given \a event
+ *
+ * RMIDs are taken from the pool of the cluster. Core associations are
+ * only re-read when the pool runs out, to pick up RMIDs released by
+ * other processes.
+ *
+ * @param [in] cluster CPU cluster id
+ * @param [in] event Monitoring event type
+ * @param [out] rmid resource monitoring id
+ *
+ * @return Operations status
+ */
+static int
+rmid_alloc(const unsigned cluster,
+           const enum pqos_mon_event event,
+           pqos_rmid_t *rmid)
+{
+        struct rmid_pool *pool = NULL;
+        unsigned max_rmid = 0;
+        int ret;
+
+        if (rmid == NULL)
+                return PQOS_RETVAL_PARAM;
+
+        ret = rmid_event_max(event, &max_rmid);
+        if (ret != PQOS_RETVAL_OK)
+                return ret;
+
+        pool = rmid_pool_get(cluster);
+        if (pool == NULL)
+                return PQOS_RETVAL_ERROR;
+
+        if (rmid_free_pop(pool, max_rmid, rmid) == PQOS_RETVAL_OK)
+                return PQOS_RETVAL_OK;
+
+        /**
+         * Out of free RMIDs:
+         * - check limbo now rather than waiting for the next poll
+         * - look for RMIDs released by other processes
+         * - reuse RMID with the least stale occupancy
+         */
+        rmid_limbo_drain(pool);
+        if (rmid_free_pop(pool, max_rmid, rmid) == PQOS_RETVAL_OK)
+                return PQOS_RETVAL_OK;
+
+        ret = rmid_pool_scan(pool);
+        if (ret != PQOS_RETVAL_OK)
+                return ret;
+        if (rmid_free_pop(pool, max_rmid, rmid) == PQOS_RETVAL_OK)
+                return PQOS_RETVAL_OK;
+
+        return rmid_limbo_steal(pool, max_rmid, rmid);
+}
+
+/**
+ * @brief Returns \a rmid to the pool of \a cluster
+ *
+ * @param [in] cluster CPU cluster id
+ * @param [in] rmid resource monitoring id
+ * @param [in] limbo if not zero RMID has been counting and its occupancy
+ *             has to drain before reuse
+ */
+static void
+rmid_release(const unsigned cluster,
+             const pqos_rmid_t rmid,
+             const int limbo)
+{
+        struct rmid_pool *pool;
+        unsigned i;
+
+        for (i = 0; i < m_rmid_pools_num; i++)
+                if (m_rmid_pools[i].cluster == cluster)
+                        break;
+        if (i >= m_rmid_pools_num)
+                return;
+        pool = &m_rmid_pools[i];
+
+        if (rmid >= m_rmid_max || pool->state[rmid] != RMID_USED)
+                return;
+
+        if (limbo && m_limbo_occup) {
+                pool->limbo[pool->num_limbo].rmid = rmid;
+                pool->limbo[pool->num_limbo].occupancy = UINT64_MAX;
+                pool->num_limbo++;
+                pool->state[rmid] = RMID_LIMBO;
+        } else
+                rmid_free_push(pool, rmid);
+}
+
+/**
+ * @brief Returns RMIDs used by other processes to limbo after reset
+ */
+static void
+rmid_pool_reset(void)
+{
+        unsigned i, j;
+
+        for (i = 0; i < m_rmid_pools_num; i++) {
+                struct rmid_pool *pool = &m_rmid_pools[i];
+
+                for (j = RMID0 + 1; j < m_rmid_max; j++) {
+                        if (pool->state[j] != RMID_FOREIGN)
+                                continue;
+                        pool->state[j] = RMID_USED;
+                        rmid_release(pool->cluster, j, 1);
+                }
+        }
+}
+
+/**
+ * @brief Frees RMID pools of all clusters
+ */
+static void
+rmid_pool_fini(void)
+{
+        unsigned i;
+
+        for (i = 0; i < m_rmid_pools_num; i++) {
+                free(m_rmid_pools[i].state);
+                free(m_rmid_pools[i].free);
+                free(m_rmid_pools[i].limbo);
+        }
+        free(m_rmid_pools);
+        m_rmid_pools = NULL;
+        m_rmid_pools_num = 0;
+}
+
+int
+hw_mon_rmid_avail(const unsigned l3_id,
+                  unsigned *num_free,
+                  unsigned *num_limbo)
+{
+        struct rmid_pool *pool;
+
+        ASSERT(m_cpu != NULL);
+        if (num_free == NULL)
+                return PQOS_RETVAL_PARAM;
+
+        pool = rmid_pool_get(l3_id);
+        if (pool == NULL)
+                return PQOS_RETVAL_PARAM;
+
+        *num_free = pool->num_free;
+        if (num_limbo != NULL)
+                *num_limbo = pool->num_limbo;
+        return PQOS_RETVAL_OK;
+}
+
+/*
+ * =======================================
+ * =======================================
+ *
+ * RMID multiplexing
+ *
+ * =======================================
+ * =======================================
+ */
+
+/**
+ * @brief Tells if \a lcore belongs to a multiplexed group
+ *
+ * Cores of groups waiting for their turn stay with RMID0, so
+ * association check alone doesn't find them.
+ *
+ * @param lcore logical core id
+ *
+ * @return 1 if it does, 0 otherwise
+ */
+static int
+mon_mux_core_used(const unsigned lcore)
+{
+        unsigned i, j;
+
+        for (i = 0; i < m_mux_num; i++) {
+                const struct pqos_mon_data *p = m_mux[i]->group;
+
+                for (j = 0; j < p->num_cores; j++)
+                        if (p->cores[j] == lcore)
+                                return 1;
+        }
+        return 0;
+}
+
+/**
+ * @brief Adds \a group to multiplexed groups
+ *
+ * @param group monitoring group
+ * @param scheduled if not zero group cores use own RMIDs already
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+mon_mux_add(struct pqos_mon_data *group, const int scheduled)
+{
+        struct pqos_mon_mux **mux;
+
+        mux = realloc(m_mux, (m_mux_num + 1) * sizeof(m_mux[0]));
+        if (mux == NULL)
+                return PQOS_RETVAL_RESOURCE;
+        m_mux = mux;
+
+        group->mux = calloc(1, sizeof(*group->mux));
+        if (group->mux == NULL)
+                return PQOS_RETVAL_RESOURCE;
+        group->mux->group = group;
+        group->mux->scheduled = scheduled;
+        group->mux->llc_clean = scheduled;
+        group->mux->since = mon_time_us();
+        m_mux[m_mux_num++] = group->mux;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Removes \a group from multiplexed groups
+ *
+ * @param group monitoring group
+ */
+static void
+mon_mux_del(struct pqos_mon_data *group)
+{
+        unsigned i;
+
+        for (i = 0; i < m_mux_num; i++)
+                if (m_mux[i] == group->mux) {
+                        m_mux[i] = m_mux[--m_mux_num];
+                        break;
+                }
+        free(group->mux);
+        group->mux = NULL;
+}
+
+/**
+ * @brief Frees state of all multiplexed groups
+ */
+static void
+mon_mux_fini(void)
+{
+        unsigned i;
+
+        for (i = 0; i < m_mux_num; i++)
+                free(m_mux[i]);
+        free(m_mux);
+        m_mux = NULL;
+        m_mux_num = 0;
+        m_mux_samples = 0;
+}
+
+/**
+ * @brief Takes group \a p off its RMIDs
+ *
+ * Cores go back to RMID0 and RMIDs go to limbo. The next group may
+ * take them before they drain, its occupancy is then not valid.
+ *
+ * @param p monitoring group
+ * @param now current time (us)
+ */
+static void
+mon_mux_evict(struct pqos_mon_data *p, const uint64_t now)
+{
+        unsigned i;
+
+        for (i = 0; i < p->num_cores; i++)
+                (void) mon_assoc_set(p->cores[i], RMID0);
+        for (i = 0; i < p->num_poll_ctx; i++) {
+                rmid_release(p->poll_ctx[i].cluster, p->poll_ctx[i].rmid, 1);
+                p->poll_ctx[i].rmid = RMID0;
+        }
+        p->mux->scheduled = 0;
+        p->mux->since = now;
+}
+
+/**
+ * @brief Gives group \a p RMIDs in all of its clusters
+ *
+ * The first poll of a new turn is a baseline, its bandwidth
+ * is extrapolated. Drained RMIDs are preferred, occupancy read
+ * from RMIDs taken out of limbo still counts lines of their previous
+ * owner and is not reported.
+ *
+ * @param p monitoring group
+ * @param now current time (us)
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_RESOURCE not enough free RMIDs
+ */
+static int
+mon_mux_schedule(struct pqos_mon_data *p, const uint64_t now)
+{
+        const enum pqos_mon_event event =
+                p->event & (~(PQOS_PERF_EVENT_IPC | PQOS_PERF_EVENT_LLC_MISS));
+        unsigned max_rmid = 0;
+        unsigned i, j;
+        int clean = 1;
+
+        if (rmid_event_max(event, &max_rmid) != PQOS_RETVAL_OK)
+                return PQOS_RETVAL_ERROR;
+
+        for (i = 0; i < p->num_poll_ctx; i++) {
+                struct pqos_mon_poll_ctx *ctx = &p->poll_ctx[i];
+                struct rmid_pool *pool = rmid_pool_get(ctx->cluster);
+
+                if (pool == NULL)
+                        break;
+                if (rmid_free_pop(pool, max_rmid, &ctx->rmid) ==
+                    PQOS_RETVAL_OK)
+                        continue;
+                rmid_limbo_drain(pool);
+                if (rmid_free_pop(pool, max_rmid, &ctx->rmid) ==
+                    PQOS_RETVAL_OK)
+                        continue;
+                if (rmid_limbo_steal(pool, max_rmid, &ctx->rmid) !=
+                    PQOS_RETVAL_OK)
+                        break;
+                clean = 0;
+        }
+        if (i < p->num_poll_ctx) {
+                for (j = 0; j < i; j++) {
+                        rmid_release(p->poll_ctx[j].cluster,
+                                     p->poll_ctx[j].rmid, 0);
+                        p->poll_ctx[j].rmid = RMID0;
                 }
+                return PQOS_RETVAL_RESOURCE;
+        }
 
-        /**
-         * Check if all of the events are supported
-         */
-        if (event != mask_found || max_rmid == 0)
-                return PQOS_RETVAL_ERROR;
-        ASSERT(m_rmid_max >= max_rmid);
+        p->mux->scheduled = 1;
+        for (i = 0; i < p->num_cores; i++) {
+                unsigned cluster = 0;
 
-        /**
-         * Check for free RMID in the cluster by reading current associations.
-         * Do it backwards (from max to 0) in order to preserve low RMID values
-         * for overlapping RMID ranges for future events.
-         */
-        core_list = pqos_cpu_get_cores_l3id(m_cpu, cluster, &core_count);
-        if (core_list == NULL)
+                if (pqos_cpu_get_clusterid(m_cpu, p->cores[i],
+                                           &cluster) != PQOS_RETVAL_OK)
+                        break;
+                for (j = 0; j < p->num_poll_ctx; j++)
+                        if (p->poll_ctx[j].cluster == cluster)
+                                break;
+                if (j >= p->num_poll_ctx ||
+                    mon_assoc_set(p->cores[i], p->poll_ctx[j].rmid) !=
+                    PQOS_RETVAL_OK)
+                        break;
+        }
+        if (i < p->num_cores) {
+                mon_mux_evict(p, now);
                 return PQOS_RETVAL_ERROR;
-        ASSERT(core_count > 0);
-        rmid_list = (pqos_rmid_t *)malloc(sizeof(rmid_list[0]) * core_count);
-        if (rmid_list == NULL) {
-                ret = PQOS_RETVAL_RESOURCE;
-                goto rmid_alloc_error;
         }
 
-        for (i = 0; i < core_count; i++) {
-                ret = mon_assoc_get(core_list[i], &rmid_list[i]);
+        p->mux->samples = 0;
+        p->mux->since = now;
+        p->mux->llc_clean = clean;
+        p->valid_mbm_read = 0;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Hands RMIDs over from groups that completed their turn
+ *
+ * Groups waiting longest go first. A group is only evicted after
+ * it has been measured for the configured number of polls.
+ */
+static void
+mon_mux_rotate(void)
+{
+        const uint64_t now = mon_time_us();
+        unsigned i;
+
+        for (;;) {
+                struct pqos_mon_mux *wait = NULL;
+                int ret;
+
+                /**
+                 * Groups evicted in this rotation have since == now
+                 * and wait for the next one
+                 */
+                for (i = 0; i < m_mux_num; i++)
+                        if (!m_mux[i]->scheduled && m_mux[i]->since < now &&
+                            (wait == NULL || m_mux[i]->since < wait->since))
+                                wait = m_mux[i];
+                if (wait == NULL)
+                        return;
+
+                while ((ret = mon_mux_schedule(wait->group, now)) ==
+                       PQOS_RETVAL_RESOURCE) {
+                        struct pqos_mon_mux *victim = NULL;
+
+                        for (i = 0; i < m_mux_num; i++)
+                                if (m_mux[i]->scheduled &&
+                                    m_mux[i]->samples >= m_mux_samples &&
+                                    (victim == NULL ||
+                                     m_mux[i]->since < victim->since))
+                                        victim = m_mux[i];
+                        if (victim == NULL)
+                                return;
+                        mon_mux_evict(victim->group, now);
+                }
                 if (ret != PQOS_RETVAL_OK)
-                        goto rmid_alloc_error;
+                        wait->since = now;
         }
+}
 
-        ret = PQOS_RETVAL_ERROR;
-        for (i = max_rmid; i > 0; i--) {
-                const unsigned tmp_rmid = i - 1;
-                unsigned j = 0;
+/**
+ * @brief Updates sampling window of multiplexed group \a p
+ *
+ * Bandwidth measured during the turn of the group gives its rate.
+ * Outside of the turn bandwidth is extrapolated from the last rate,
+ * occupancy keeps the last valid value, as it does during a turn on
+ * RMIDs that had not drained. Confidence drops with time passed since
+ * the last measured window or valid occupancy.
+ *
+ * @param p monitoring group
+ * @param baseline first read of the turn, deltas are not valid
+ */
+static void
+mon_mux_update(struct pqos_mon_data *p, const int baseline)
+{
+        struct pqos_mon_mux *mux = p->mux;
+        struct pqos_event_values *pv = &p->values;
+        const uint64_t now = mon_time_us();
+        const uint64_t elapsed = mux->last_poll ? now - mux->last_poll : 0;
+
+        mux->last_poll = now;
+        if (mux->scheduled && mux->llc_clean) {
+                mux->llc = pv->llc;
+                mux->llc_measured = now;
+                pv->llc_confidence = 1.0;
+        } else {
+                pv->llc = mux->llc;
+                if (mux->llc_measured == 0 || mux->window == 0)
+                        pv->llc_confidence = 0.0;
+                else
+                        pv->llc_confidence = (double)mux->window /
+                                (double)(mux->window + now -
+                                         mux->llc_measured);
+        }
 
-                for (j = 0; j < core_count; j++)
-                        if (tmp_rmid == rmid_list[j])
-                                break;
-                if (j >= core_count) {
-                        ret = PQOS_RETVAL_OK;
-                        *rmid = tmp_rmid;
-                        break;
+        if (mux->scheduled && !baseline) {
+                if (elapsed > 0) {
+                        mux->rate_local =
+                                (double)pv->mbm_local_delta / elapsed;
+                        mux->rate_total =
+                                (double)pv->mbm_total_delta / elapsed;
+                        mux->window = elapsed;
+                        mux->measured = now;
                 }
+                mux->samples++;
+                pv->confidence = 1.0;
+                return;
         }
 
- rmid_alloc_error:
-        if (rmid_list != NULL)
-                free(rmid_list);
-        if (core_list != NULL)
-                free(core_list);
-        return ret;
+        pv->mbm_local_delta = (uint64_t)(mux->rate_local * elapsed);
+        pv->mbm_total_delta = (uint64_t)(mux->rate_total * elapsed);
+        pv->mbm_remote_delta = 0;
+        if ((p->event & PQOS_MON_EVENT_RMEM_BW) &&
+            pv->mbm_total_delta > pv->mbm_local_delta)
+                pv->mbm_remote_delta =
+                        pv->mbm_total_delta - pv->mbm_local_delta;
+
+        if (mux->window == 0)
+                pv->confidence = 0.0;
+        else
+                pv->confidence = (double)mux->window /
+                        (double)(mux->window + now - mux->measured);
 }
 
 /*
@@ -515,6 +1403,7 @@ int hw_mon_reset(void)
                 if (retval != PQOS_RETVAL_OK)
                         ret = retval;
         }
+        rmid_pool_reset();
 
  pqos_mon_reset_error:
         return ret;
@@ -585,80 +1474,255 @@ mon_read(const unsigned lcore,
 }
 
 /**
- * @brief Reads monitoring event data from given core
+ * @brief Queues selection and read of \a event for \a rmid on \a lcore
  *
- * @param p pointer to monitoring structure
+ * @param b MSR batch
+ * @param lcore logical core id
+ * @param rmid RMID to be read
+ * @param event monitoring event
  *
  * @return Operation status
  * @retval PQOS_RETVAL_OK on success
  */
 static int
-pqos_core_poll(struct pqos_mon_data *p)
+mon_read_queue(struct msr_batch *b,
+               const unsigned lcore,
+               const pqos_rmid_t rmid,
+               const enum pqos_mon_event event)
 {
-        struct pqos_event_values *pv = &p->values;
-        int retval = PQOS_RETVAL_OK;
-        unsigned i;
+        uint64_t val;
+
+        val = ((uint64_t)rmid) & PQOS_MSR_MON_EVTSEL_RMID_MASK;
+        val <<= PQOS_MSR_MON_EVTSEL_RMID_SHIFT;
+        val |= ((uint64_t)get_event_id(event)) &
+                PQOS_MSR_MON_EVTSEL_EVTID_MASK;
+        if (msr_batch_write(b, lcore, PQOS_MSR_MON_EVTSEL, val) !=
+            MACHINE_RETVAL_OK)
+                return PQOS_RETVAL_ERROR;
+        if (msr_batch_read(b, lcore, PQOS_MSR_MON_QMC) < 0)
+                return PQOS_RETVAL_ERROR;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Returns next read operation of submitted batch
+ *
+ * @param b MSR batch
+ * @param pos position to search from, updated past returned operation
+ *
+ * @return Read operation
+ */
+static const struct msr_batch_op *
+mon_next_read(const struct msr_batch *b, unsigned *pos)
+{
+        while (*pos < b->num_ops && b->ops[*pos].write)
+                (*pos)++;
+        ASSERT(*pos < b->num_ops);
+        return &b->ops[(*pos)++];
+}
+
+/**
+ * @brief Decodes event counter read by a batch queued with mon_read_queue()
+ *
+ * Counter reported as unavailable is re-read with mon_read().
+ *
+ * @param op QMC read operation
+ * @param rmid RMID that was read
+ * @param event monitoring event that was read
+ * @param value place to store event value
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+mon_read_result(const struct msr_batch_op *op,
+                const pqos_rmid_t rmid,
+                const enum pqos_mon_event event,
+                uint64_t *value)
+{
+        if (op->err != MACHINE_RETVAL_OK ||
+            (op->value & PQOS_MSR_MON_QMC_ERROR) != 0ULL) {
+                LOG_WARN("Error reading event %u on core %u (RMID%u)!\n",
+                         get_event_id(event), op->lcore, (unsigned) rmid);
+                return PQOS_RETVAL_ERROR;
+        }
+        if ((op->value & PQOS_MSR_MON_QMC_UNAVAILABLE) != 0ULL)
+                return mon_read(op->lcore, rmid, get_event_id(event), value);
+
+        *value = op->value & PQOS_MSR_MON_QMC_DATA_MASK;
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Tells if \a lcore belongs to L3 \a cluster
+ *
+ * @param lcore logical core id
+ * @param cluster L3 cluster id, negative value matches all cores
+ *
+ * @return 1 if it does, 0 otherwise
+ */
+static int
+mon_core_in_cluster(const unsigned lcore, const int cluster)
+{
+        unsigned id = 0;
+
+        if (cluster < 0)
+                return 1;
+        if (pqos_cpu_get_clusterid(m_cpu, lcore, &id) != PQOS_RETVAL_OK)
+                return 0;
+        return id == (unsigned)cluster;
+}
+
+/**
+ * @brief Returns RMID events that have to be read for group \a p
+ */
+static unsigned
+mon_read_events(const struct pqos_mon_data *p)
+{
+        unsigned read_events = 0;
 
+        /* group waiting for its turn has no RMIDs to read */
+        if (p->mux != NULL && !p->mux->scheduled)
+                return 0;
         //此监测项包含LLC缓存占用
-        if (p->event & PQOS_MON_EVENT_L3_OCCUP) {
-                uint64_t total = 0;
+        if (p->event & PQOS_MON_EVENT_L3_OCCUP)
+                read_events |= PQOS_MON_EVENT_L3_OCCUP;
+        if (p->event & (PQOS_MON_EVENT_LMEM_BW | PQOS_MON_EVENT_RMEM_BW))
+                read_events |= PQOS_MON_EVENT_LMEM_BW;
+        if (p->event & (PQOS_MON_EVENT_TMEM_BW | PQOS_MON_EVENT_RMEM_BW))
+                read_events |= PQOS_MON_EVENT_TMEM_BW;
+        return read_events;
+}
+
+/**
+ * @brief Reads counters of group \a p located in L3 \a cluster
+ *
+ * All MSR operations are queued into \a b and submitted together.
+ *
+ * @param p pointer to monitoring structure
+ * @param b MSR batch to use
+ * @param cluster L3 cluster id, negative value reads whole group
+ * @param part place to store counter sums
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+mon_poll_part_read(const struct pqos_mon_data *p,
+                   struct msr_batch *b,
+                   const int cluster,
+                   struct mon_poll_part *part)
+{
+        const unsigned read_events = mon_read_events(p);
+        unsigned pos = 0;
+        unsigned e, i;
+
+        memset(part, 0, sizeof(*part));
+
+        /**
+         * Queue all reads
+         */
+        msr_batch_clear(b);
+        for (e = 0; e < DIM(m_rmid_events); e++) {
+                if (!(read_events & m_rmid_events[e]))
+                        continue;
                 //这里的num_poll_ctx就是core数目
                 for (i = 0; i < p->num_poll_ctx; i++) {
-                        uint64_t tmp = 0;
-                        int ret;
-
-                        ret = mon_read(p->poll_ctx[i].lcore,
-                                       p->poll_ctx[i].rmid,
-                                       get_event_id(PQOS_MON_EVENT_L3_OCCUP),
-                                       &tmp); //读取MSR的主方法
-                        if (ret != PQOS_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        total += tmp;
+                        if (cluster >= 0 &&
+                            p->poll_ctx[i].cluster != (unsigned)cluster)
+                                continue;
+                        if (mon_read_queue(b, p->poll_ctx[i].lcore,
+                                           p->poll_ctx[i].rmid,
+                                           m_rmid_events[e]) !=
+                            PQOS_RETVAL_OK)
+                                return PQOS_RETVAL_ERROR;
                 }
-                pv->llc = scale_event(PQOS_MON_EVENT_L3_OCCUP, total);
         }
-        if (p->event & (PQOS_MON_EVENT_LMEM_BW | PQOS_MON_EVENT_RMEM_BW)) {
-                uint64_t total = 0, old_value = pv->mbm_local;
+        for (i = 0; i < p->num_cores; i++) {
+                if (!(p->event & (PQOS_PERF_EVENT_IPC |
+                                  PQOS_PERF_EVENT_LLC_MISS)))
+                        break;
+                if (!mon_core_in_cluster(p->cores[i], cluster))
+                        continue;
+                //以逻辑核为粒度的测量
+                //quxm changed: use CPU_CLK_Unhalted.Ref instead. 2018.5.7
+                if ((p->event & PQOS_PERF_EVENT_IPC) &&
+                    (msr_batch_read(b, p->cores[i],
+                                    IA32_MSR_INST_RETIRED_ANY) < 0 ||
+                     msr_batch_read(b, p->cores[i],
+                                    IA32_MSR_CPU_UNHALTED_REF) < 0))
+                        return PQOS_RETVAL_ERROR;
+                if ((p->event & PQOS_PERF_EVENT_LLC_MISS) &&
+                    msr_batch_read(b, p->cores[i], IA32_MSR_PMC0) < 0)
+                        return PQOS_RETVAL_ERROR;
+        }
 
+        /* failed operations are reported below */
+        (void) msr_batch_submit(b);
+
+        /**
+         * Accumulate results in the order they were queued
+         */
+        for (e = 0; e < DIM(m_rmid_events); e++) {
+                if (!(read_events & m_rmid_events[e]))
+                        continue;
                 for (i = 0; i < p->num_poll_ctx; i++) {
                         uint64_t tmp = 0;
-                        int ret;
-
-                        ret = mon_read(p->poll_ctx[i].lcore,
-                                       p->poll_ctx[i].rmid,
-                                       get_event_id(PQOS_MON_EVENT_LMEM_BW),
-                                       &tmp);
-                        if (ret != PQOS_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        total += tmp;
+
+                        if (cluster >= 0 &&
+                            p->poll_ctx[i].cluster != (unsigned)cluster)
+                                continue;
+                        if (mon_read_result(mon_next_read(b, &pos),
+                                            p->poll_ctx[i].rmid,
+                                            m_rmid_events[e], &tmp) !=
+                            PQOS_RETVAL_OK)
+                                return PQOS_RETVAL_ERROR;
+                        part->totals[e] += tmp;
                 }
-                pv->mbm_local = total;
+        }
+        for (i = pos; i < b->num_ops; i++) {
+                const struct msr_batch_op *op = &b->ops[i];
+
+                if (op->err != MACHINE_RETVAL_OK)
+                        return PQOS_RETVAL_ERROR;
+                if (op->reg == IA32_MSR_INST_RETIRED_ANY)
+                        part->retired += op->value;
+                else if (op->reg == IA32_MSR_CPU_UNHALTED_REF)
+                        part->unhalted += op->value;
+                else if (op->reg == IA32_MSR_PMC0)
+                        part->missed += op->value;
+        }
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Updates event values of group \a p from counter sums
+ *
+ * @param p pointer to monitoring structure
+ * @param part counter sums of the whole group
+ */
+static void
+mon_poll_update(struct pqos_mon_data *p, const struct mon_poll_part *part)
+{
+        struct pqos_event_values *pv = &p->values;
+        const unsigned read_events = mon_read_events(p);
+        const int baseline = !p->valid_mbm_read;
+
+        if (read_events & PQOS_MON_EVENT_L3_OCCUP)
+                pv->llc = scale_event(PQOS_MON_EVENT_L3_OCCUP,
+                                      part->totals[0]);
+        if (read_events & PQOS_MON_EVENT_LMEM_BW) {
+                uint64_t old_value = pv->mbm_local;
+
+                pv->mbm_local = part->totals[1];
                 pv->mbm_local_delta = get_delta(old_value, pv->mbm_local);
                 pv->mbm_local_delta = scale_event(PQOS_MON_EVENT_LMEM_BW,
                                                   pv->mbm_local_delta);
         }
-        if (p->event & (PQOS_MON_EVENT_TMEM_BW | PQOS_MON_EVENT_RMEM_BW)) {
-                uint64_t total = 0, old_value = pv->mbm_total;
+        if (read_events & PQOS_MON_EVENT_TMEM_BW) {
+                uint64_t old_value = pv->mbm_total;
 
-                for (i = 0; i < p->num_poll_ctx; i++) {
-                        uint64_t tmp = 0;
-                        int ret;
-
-                        ret = mon_read(p->poll_ctx[i].lcore,
-                                       p->poll_ctx[i].rmid,
-                                       get_event_id(PQOS_MON_EVENT_TMEM_BW),
-                                       &tmp);
-                        if (ret != PQOS_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        total += tmp;
-                }
-                pv->mbm_total = total;
+                pv->mbm_total = part->totals[2];
                 pv->mbm_total_delta = get_delta(old_value, pv->mbm_total);
                 pv->mbm_total_delta = scale_event(PQOS_MON_EVENT_TMEM_BW,
                                                   pv->mbm_total_delta);
@@ -675,76 +1739,21 @@ pqos_core_poll(struct pqos_mon_data *p)
         if (p->event & PQOS_PERF_EVENT_IPC) {
                 /**
                  * If multiple cores monitored in one group
-                 * then we have to accumulate the values in the group.
+                 * then the values are accumulated in the group.
                  */
-                //changed by quxm:perf_event_open is used. 2018.6.10
-                uint64_t unhalted = 0, retired = 0;
-                unsigned n;
-                //以逻辑核为粒度的测量：
-                for (n = 0; n < p->num_cores; n++) {
-                        uint64_t tmp = 0;
-                        int ret = msr_read(p->cores[n],
-                                           IA32_MSR_INST_RETIRED_ANY, &tmp);
-                        if (ret != MACHINE_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        retired += tmp;
-
-                        //ret = msr_read(p->cores[n],
-                        //               IA32_MSR_CPU_UNHALTED_THREAD, &tmp);
-                        //quxm changed: use CPU_CLK_Unhalted.Ref instead. 2018.5.7
-                        ret = msr_read(p->cores[n],
-                                   IA32_MSR_CPU_UNHALTED_REF, &tmp);
-                        if (ret != MACHINE_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        unhalted += tmp;
-                }
-
-                pv->ipc_unhalted_delta = unhalted - pv->ipc_unhalted;
-                pv->ipc_retired_delta = retired - pv->ipc_retired;
-                pv->ipc_unhalted = unhalted;
-                pv->ipc_retired = retired;
+                pv->ipc_unhalted_delta = part->unhalted - pv->ipc_unhalted;
+                pv->ipc_retired_delta = part->retired - pv->ipc_retired;
+                pv->ipc_unhalted = part->unhalted;
+                pv->ipc_retired = part->retired;
                 if (pv->ipc_unhalted_delta == 0)
                         pv->ipc = 0.0;
                 else
                         pv->ipc = (double) pv->ipc_retired_delta /
                                 (double) pv->ipc_unhalted_delta;
-
-                uint64_t retired_pid = 0;
-
-                //下面读取instructions使用了PMU的perf_event_open得到的fd
-                //即以pid为粒度的测量
-                long long count;
-
-                read(pv->fd_ins, &count, sizeof(long long));
-                retired_pid = count;
-                pv->ipc_retired_delta_pid = retired_pid - pv->ipc_retired_pid;
-                pv->ipc_retired_pid = retired_pid;
         }
         if (p->event & PQOS_PERF_EVENT_LLC_MISS) {
-                /**
-                 * If multiple cores monitored in one group
-                 * then we have to accumulate the values in the group.
-                 */
-                uint64_t missed = 0;
-                unsigned n;
-
-                for (n = 0; n < p->num_cores; n++) {
-                        uint64_t tmp = 0;
-                        int ret = msr_read(p->cores[n],
-                                           IA32_MSR_PMC0, &tmp);
-                        if (ret != MACHINE_RETVAL_OK) {
-                                retval = PQOS_RETVAL_ERROR;
-                                goto pqos_core_poll__exit;
-                        }
-                        missed += tmp;
-                }
-
-                pv->llc_misses_delta = missed - pv->llc_misses;
-                pv->llc_misses = missed;
+                pv->llc_misses_delta = part->missed - pv->llc_misses;
+                pv->llc_misses = part->missed;
         }
         if (!p->valid_mbm_read) {
                 /* Report zero memory bandwidth with first read */
@@ -753,10 +1762,114 @@ pqos_core_poll(struct pqos_mon_data *p)
                 pv->mbm_total_delta = 0;
                 p->valid_mbm_read = 1;
         }
+        if (p->mux != NULL)
+                mon_mux_update(p, baseline);
+}
+
+/**
+ * @brief Reads monitoring event data from given core
+ *
+ * @param p pointer to monitoring structure
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+pqos_core_poll(struct pqos_mon_data *p)
+{
+        struct mon_poll_part part;
+        int ret;
+
+        ret = mon_poll_part_read(p, &m_poll_batch, -1, &part);
+        if (ret != PQOS_RETVAL_OK)
+                return ret;
+        mon_poll_update(p, &part);
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Poller pool work function, reads cluster local part of all groups
+ *
+ * @param arg poll job
+ * @param worker worker index
+ * @param cluster L3 cluster id of the worker
+ */
+static void
+mon_poll_worker(void *arg, const unsigned worker, const unsigned cluster)
+{
+        const struct mon_poll_job *job = (const struct mon_poll_job *)arg;
+        const unsigned num_workers = poller_num_workers();
+        unsigned i;
+
+        for (i = 0; i < job->num_groups; i++) {
+                struct mon_poll_part *part =
+                        &job->parts[i * num_workers + worker];
+
+                part->ret = mon_poll_part_read(job->groups[i],
+                                               &m_worker_batch[worker],
+                                               (int)cluster, part);
+        }
+}
+
+/**
+ * @brief Polls \a groups on poller pool workers in parallel
+ *
+ * Each worker reads counters of its L3 cluster, partial sums are merged
+ * per group afterwards. A group fails if any of its parts failed.
+ *
+ * @param groups table of monitoring groups
+ * @param num_groups number of groups
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+mon_poll_parallel(struct pqos_mon_data **groups, const unsigned num_groups)
+{
+        const unsigned num_workers = poller_num_workers();
+        struct mon_poll_job job;
+        unsigned i, w, e;
+
+        if (m_poll_parts_num < num_groups * num_workers) {
+                struct mon_poll_part *parts =
+                        realloc(m_poll_parts, num_groups * num_workers *
+                                sizeof(m_poll_parts[0]));
+
+                if (parts == NULL)
+                        return PQOS_RETVAL_RESOURCE;
+                m_poll_parts = parts;
+                m_poll_parts_num = num_groups * num_workers;
+        }
 
+        job.groups = groups;
+        job.num_groups = num_groups;
+        job.parts = m_poll_parts;
+        if (poller_run(mon_poll_worker, &job) != PQOS_RETVAL_OK)
+                return PQOS_RETVAL_ERROR;
 
- pqos_core_poll__exit:
-        return retval;
+        for (i = 0; i < num_groups; i++) {
+                const struct mon_poll_part *parts =
+                        &m_poll_parts[i * num_workers];
+                struct mon_poll_part sum;
+
+                memset(&sum, 0, sizeof(sum));
+                for (w = 0; w < num_workers; w++) {
+                        if (parts[w].ret != PQOS_RETVAL_OK)
+                                break;
+                        for (e = 0; e < DIM(sum.totals); e++)
+                                sum.totals[e] += parts[w].totals[e];
+                        sum.retired += parts[w].retired;
+                        sum.unhalted += parts[w].unhalted;
+                        sum.missed += parts[w].missed;
+                }
+                if (w < num_workers) {
+                        LOG_WARN("Failed to read event on "
+                                 "core %u\n", groups[i]->cores[0]);
+                        continue;
+                }
+                mon_poll_update(groups[i], &sum);
+        }
+        return PQOS_RETVAL_OK;
 }
 
 /**
@@ -911,6 +2024,7 @@ hw_mon_start(const unsigned num_cores,
         struct pqos_mon_poll_ctx ctxs[num_cores];
         unsigned num_ctxs = 0;
         unsigned i = 0;
+        int waiting = 0;
         int ret = PQOS_RETVAL_OK;
         int retval = PQOS_RETVAL_OK;
 
@@ -971,6 +2085,12 @@ hw_mon_start(const unsigned num_cores,
                         retval = PQOS_RETVAL_RESOURCE;
                         goto pqos_mon_start_error1;
                 }
+                if (mon_mux_core_used(lcore)) {
+                        LOG_INFO("Core %u is already monitored by "
+                                 "multiplexed group.\n", lcore);
+                        retval = PQOS_RETVAL_RESOURCE;
+                        goto pqos_mon_start_error1;
+                }
 
                 ret = pqos_cpu_get_clusterid(m_cpu, lcore, &cluster);
                 if (ret != PQOS_RETVAL_OK) {
@@ -997,7 +2117,11 @@ hw_mon_start(const unsigned num_cores,
                                          event & (~(PQOS_PERF_EVENT_IPC |
                                                     PQOS_PERF_EVENT_LLC_MISS)),
                                          &ctxs[num_ctxs].rmid);
-                        if (ret != PQOS_RETVAL_OK) {
+                        if (ret != PQOS_RETVAL_OK && m_mux_samples > 0) {
+                                /* wait for a turn of multiplexed RMIDs */
+                                ctxs[num_ctxs].rmid = RMID0;
+                                waiting = 1;
+                        } else if (ret != PQOS_RETVAL_OK) {
                                 retval = ret;
                                 goto pqos_mon_start_error1;
                         }
@@ -1006,6 +2130,14 @@ hw_mon_start(const unsigned num_cores,
                 }
         }
 
+        /**
+         * Group waiting for its turn doesn't hold any RMIDs
+         */
+        for (i = 0; waiting && i < num_ctxs; i++) {
+                rmid_release(ctxs[i].cluster, ctxs[i].rmid, 0);
+                ctxs[i].rmid = RMID0;
+        }
+
         /**
          * Fill in the monitoring group structure
          */
@@ -1049,6 +2181,8 @@ hw_mon_start(const unsigned num_cores,
                 rmid = ctxs[j].rmid;
 
                 group->cores[i] = cores[i];
+                if (waiting)
+                        continue;
                 ret = mon_assoc_set(cores[i], rmid);
                 if (ret != PQOS_RETVAL_OK) {
                         retval = ret;
@@ -1062,12 +2196,23 @@ hw_mon_start(const unsigned num_cores,
 
         group->event = event;
         group->context = context;
+        group->values.confidence = waiting ? 0.0 : 1.0;
+        group->values.llc_confidence = group->values.confidence;
+
+        if (m_mux_samples > 0) {
+                ret = mon_mux_add(group, !waiting);
+                if (ret != PQOS_RETVAL_OK)
+                        retval = ret;
+        }
 
  pqos_mon_start_error2:
         if (retval != PQOS_RETVAL_OK) {
                 for (i = 0; i < num_cores; i++)
                         (void) mon_assoc_set(cores[i], RMID0);
 
+                if (group->mux != NULL)
+                        mon_mux_del(group);
+
                 if (group->poll_ctx != NULL)
                         free(group->poll_ctx);
 
@@ -1075,6 +2220,9 @@ hw_mon_start(const unsigned num_cores,
                         free(group->cores);
         }
  pqos_mon_start_error1:
+        if (retval != PQOS_RETVAL_OK)
+                for (i = 0; i < num_ctxs; i++)
+                        rmid_release(ctxs[i].cluster, ctxs[i].rmid, 0);
 
         return retval;
 }
@@ -1130,6 +2278,15 @@ hw_mon_stop(struct pqos_mon_data *group)
         if (ret != PQOS_RETVAL_OK)
                 retval = PQOS_RETVAL_RESOURCE;
 
+        /**
+         * Put RMIDs in limbo until their occupancy drains
+         */
+        for (i = 0; i < group->num_poll_ctx; i++)
+                rmid_release(group->poll_ctx[i].cluster,
+                             group->poll_ctx[i].rmid, 1);
+        if (group->mux != NULL)
+                mon_mux_del(group);
+
         /**
          * Free poll contexts, core list and clear the group structure
          */
@@ -1140,6 +2297,12 @@ hw_mon_stop(struct pqos_mon_data *group)
         return retval;
 }
 
+int
+hw_mon_poll_assoc(void)
+{
+        return m_mux_samples != 0;
+}
+
 int
 hw_mon_poll(struct pqos_mon_data **groups,
               const unsigned num_groups)
@@ -1150,12 +2313,21 @@ hw_mon_poll(struct pqos_mon_data **groups,
         ASSERT(groups != NULL);
         ASSERT(num_groups > 0);
 
+        if (poller_num_workers() > 0) {
+                ret = mon_poll_parallel(groups, num_groups);
+                mon_mux_rotate();
+                rmid_limbo_check();
+                return ret;
+        }
+
         for (i = 0; i < num_groups; i++) {
                 ret = pqos_core_poll(groups[i]);
                 if (ret != PQOS_RETVAL_OK)
                         LOG_WARN("Failed to read event on "
                                  "core %u\n", groups[i]->cores[0]);
 	}
+        mon_mux_rotate();
+        rmid_limbo_check();
         return PQOS_RETVAL_OK;
 }
 /*
@@ -105,6 +105,21 @@ int hw_mon_reset(void);
 int hw_mon_assoc_get(const unsigned lcore,
                      pqos_rmid_t *rmid);
 
+/**
+ * @brief Hardware interface to report RMIDs left in L3 cluster \a l3_id
+ *
+ * @param [in] l3_id L3 cluster id
+ * @param [out] num_free number of RMIDs ready for allocation
+ * @param [out] num_limbo number of released RMIDs with occupancy not
+ *              drained yet, may be NULL
+ *
+ * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int hw_mon_rmid_avail(const unsigned l3_id,
+                      unsigned *num_free,
+                      unsigned *num_limbo);
+
 /**
  * @brief Hardware interface to start resource monitoring on selected
  * group of cores
@@ -154,6 +169,15 @@ int hw_mon_stop(struct pqos_mon_data *group);
 int hw_mon_poll(struct pqos_mon_data **groups,
                 const unsigned num_groups);
 
+/**
+ * @brief Tells if \a hw_mon_poll may change core associations
+ *
+ * Polling rotates RMIDs of multiplexed groups.
+ *
+ * @return 1 if associations may change, 0 otherwise
+ */
+int hw_mon_poll_assoc(void);
+
 /*
  * =======================================
  * Allocation Technology
@@ -218,6 +218,8 @@ os_alloc_fini(void)
 {
         int ret = PQOS_RETVAL_OK;
 
+        resctrl_alloc_schemata_cache_fini();
+        resctrl_alloc_task_index_fini();
         m_cap = NULL;
         m_cpu = NULL;
         return ret;
@@ -260,6 +262,52 @@ os_alloc_assoc_set(const unsigned lcore,
 	return ret;
 }
 
+int
+os_alloc_assoc_set_many(const unsigned *cores,
+                        const unsigned num_cores,
+                        const unsigned class_id)
+{
+	int ret;
+	unsigned num_l2_cos = 0, num_l3_cos = 0, i;
+	struct resctrl_alloc_cpumask mask;
+
+	ASSERT(cores != NULL);
+	ASSERT(m_cpu != NULL);
+	for (i = 0; i < num_cores; i++) {
+		ret = pqos_cpu_check_core(m_cpu, cores[i]);
+		if (ret != PQOS_RETVAL_OK)
+			return PQOS_RETVAL_PARAM;
+	}
+
+	ASSERT(m_cap != NULL);
+	ret = pqos_l3ca_get_cos_num(m_cap, &num_l3_cos);
+	if (ret != PQOS_RETVAL_OK && ret != PQOS_RETVAL_RESOURCE)
+		return ret;
+
+	ret = pqos_l2ca_get_cos_num(m_cap, &num_l2_cos);
+	if (ret != PQOS_RETVAL_OK && ret != PQOS_RETVAL_RESOURCE)
+		return ret;
+
+	if (class_id >= num_l3_cos && class_id >= num_l2_cos)
+		/* class_id is out of bounds */
+		return PQOS_RETVAL_PARAM;
+
+	ret = resctrl_alloc_cpumask_read(class_id, &mask);
+	if (ret != PQOS_RETVAL_OK)
+		return ret;
+
+	for (i = 0; i < num_cores; i++)
+		resctrl_alloc_cpumask_set(cores[i], &mask);
+
+	/**
+	 * Kernel removes the cores from the cpus of their previous COS,
+	 * only the new COS is written
+	 */
+	ret = resctrl_alloc_cpumask_write(class_id, &mask);
+
+	return ret;
+}
+
 int
 os_alloc_assoc_get(const unsigned lcore,
                    unsigned *class_id)
@@ -496,8 +544,11 @@ os_alloc_reset(const enum pqos_cdp_config l3_cdp_cfg)
         }
 
         /**
-         * Umount resctrl to reset schemata
+         * Umount resctrl to reset schemata,
+         * open schemata files would keep it busy
          */
+        resctrl_alloc_schemata_cache_fini();
+        resctrl_alloc_task_index_fini();
         ret = umount2(RESCTRL_ALLOC_PATH, 0);
         if (ret != 0) {
                 LOG_ERROR("Umount OS interface error!\n");
@@ -1098,6 +1149,18 @@ os_alloc_assoc_get_pid(const pid_t task,
         return resctrl_alloc_task_search(class_id, m_cap, task);
 }
 
+int
+os_alloc_assoc_get_pids(const pid_t *tasks,
+                        const unsigned num_tasks,
+                        unsigned *class_ids)
+{
+        ASSERT(tasks != NULL);
+        ASSERT(class_ids != NULL);
+
+        return resctrl_alloc_task_search_many(class_ids, m_cap, tasks,
+                                              num_tasks);
+}
+
 int
 os_alloc_assign_pid(const unsigned technology,
                     const pid_t *task_array,
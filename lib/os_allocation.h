@@ -281,6 +281,20 @@ int os_mba_get(const unsigned socket,
 int os_alloc_assoc_set(const unsigned lcore,
                        const unsigned class_id);
 
+/**
+ * @brief OS interface to associate \a cores
+ *        with given class of service
+ *
+ * @param [in] cores table of CPU logical core id's
+ * @param [in] num_cores number of cores in the table
+ * @param [in] class_id class of service
+ *
+ * @return Operations status
+ */
+int os_alloc_assoc_set_many(const unsigned *cores,
+                            const unsigned num_cores,
+                            const unsigned class_id);
+
 /**
  * @brief OS interface to read association
  *        of \a lcore with class of service
@@ -332,6 +346,22 @@ int os_alloc_assoc_set_pid(const pid_t task,
 int os_alloc_assoc_get_pid(const pid_t task,
                            unsigned *class_id);
 
+/**
+ * @brief OS interface to read association
+ *        of \a tasks with class of service
+ *
+ * @param [in] tasks task id's to find association
+ * @param [in] num_tasks number of task id's
+ * @param [out] class_ids class of service of each task,
+ *              UINT_MAX if not associated
+ *
+ * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int os_alloc_assoc_get_pids(const pid_t *tasks,
+                            const unsigned num_tasks,
+                            unsigned *class_ids);
+
 #ifdef __cplusplus
 }
 #endif
@@ -36,6 +36,7 @@
 #include <string.h>
 #include <unistd.h>             /**< pid_t */
 #include <dirent.h>             /**< scandir() */
+#include <fcntl.h>
 #include <linux/perf_event.h>
 
 #include "pqos.h"
@@ -44,6 +45,7 @@
 #include "types.h"
 #include "os_monitoring.h"
 #include "perf.h"
+#include "resctrl_mon.h"
 
 /**
  * Event indexes in table of supported events
@@ -57,6 +59,12 @@
 #define OS_MON_EVT_IDX_IPC       6
 #define OS_MON_EVT_IDX_LLC_MISS  7
 
+/**
+ * Events counted with RMIDs
+ */
+#define OS_MON_RDT_EVENTS (PQOS_MON_EVENT_L3_OCCUP | PQOS_MON_EVENT_LMEM_BW | \
+                           PQOS_MON_EVENT_TMEM_BW | PQOS_MON_EVENT_RMEM_BW)
+
 /**
  * ---------------------------------------
  * Local data structures
@@ -83,6 +91,12 @@ static int os_mon_type = 0;
  */
 static enum pqos_mon_event all_evt_mask = 0;
 
+/**
+ * RMID events are read from resctrl monitoring groups
+ * instead of intel_cqm perf PMU
+ */
+static int m_resctrl = 0;
+
 /**
  * Paths to RDT perf event info
  */
@@ -443,6 +457,57 @@ set_mon_events(void)
         return ret;
 }
 
+/**
+ * @brief Function to detect RMID events of resctrl monitoring
+ *        and update events table
+ *
+ * Kernels since 4.14 report RMID events through resctrl file system
+ * only, intel_cqm perf PMU has been removed.
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+set_resctrl_events(void)
+{
+        enum pqos_mon_event events = 0;
+        unsigned i;
+        int ret;
+
+        if (!resctrl_mon_is_supported())
+                return PQOS_RETVAL_RESOURCE;
+
+        ret = resctrl_mon_get_events(&events);
+        if (ret != PQOS_RETVAL_OK)
+                return ret;
+
+        for (i = 0; i < DIM(events_tab); i++)
+                if (events_tab[i].event & events & OS_MON_RDT_EVENTS) {
+                        events_tab[i].supported = 1;
+                        events_tab[i].scale = 1;
+                }
+        /**
+         * If both local and total MBM are supported
+         * then remote MBM is also supported
+         */
+        if (events_tab[OS_MON_EVT_IDX_LMBM].supported &&
+            events_tab[OS_MON_EVT_IDX_TMBM].supported) {
+                events_tab[OS_MON_EVT_IDX_RMBM].supported = 1;
+                events |= events_tab[OS_MON_EVT_IDX_RMBM].event;
+        }
+        if (events == 0) {
+                LOG_ERROR("Failed to find resctrl monitoring events!\n");
+                return PQOS_RETVAL_RESOURCE;
+        }
+
+        (void) set_arch_event_attrs(&events);
+
+        all_evt_mask |= events;
+        m_resctrl = 1;
+
+        return PQOS_RETVAL_OK;
+}
+
 /**
  * @brief Update monitoring capability structure with supported events
  *
@@ -530,10 +595,16 @@ start_perf_counters(const struct pqos_mon_data *group,
         for (i = 0; i < num_ctrs; i++) {
                 int ret;
                 /**
+                 * If monitoring a cgroup, count its tasks on each core
                  * If monitoring cores, pass core list
                  * Otherwise, pass list of TID's
                  */
-                if (group->num_cores > 0)
+                if (group->cgroup != NULL)
+                        ret = perf_setup_counter(&se->attrs, group->cgroup_fd,
+                                                 group->cores[i], -1,
+                                                 PERF_FLAG_PID_CGROUP,
+                                                 &ctr_fds[i]);
+                else if (group->num_cores > 0)
                         ret = perf_setup_counter(&se->attrs, -1,
                                                  group->cores[i],
                                                  -1, 0, &ctr_fds[i]);
@@ -544,6 +615,8 @@ start_perf_counters(const struct pqos_mon_data *group,
                 if (ret != PQOS_RETVAL_OK) {
                         LOG_ERROR("Failed to start perf "
                                   "counters for %s\n", se->desc);
+                        while (i-- > 0)
+                                perf_shutdown_counter(ctr_fds[i]);
                         free(ctr_fds);
                         return PQOS_RETVAL_ERROR;
                 }
@@ -609,37 +682,44 @@ stop_events(struct pqos_mon_data *group,
 {
         int ret;
         enum pqos_mon_event stopped_evts = 0;
+        enum pqos_mon_event perf_evts = events;
 
         ASSERT(group != NULL);
         ASSERT(events != 0);
+
+        /* RMID events of resctrl monitoring group have no counters */
+        if (group->resctrl_mon != NULL) {
+                stopped_evts = events & OS_MON_RDT_EVENTS;
+                perf_evts &= ~OS_MON_RDT_EVENTS;
+        }
         /**
          * Determine events, close associated
          * fd's and free associated memory
          */
-        if (events & PQOS_MON_EVENT_L3_OCCUP) {
+        if (perf_evts & PQOS_MON_EVENT_L3_OCCUP) {
                 ret = stop_perf_counters(group, &group->fds_llc);
                 if (ret == PQOS_RETVAL_OK)
                         stopped_evts |= PQOS_MON_EVENT_L3_OCCUP;
         }
-        if  (events & PQOS_MON_EVENT_LMEM_BW) {
+        if  (perf_evts & PQOS_MON_EVENT_LMEM_BW) {
                 ret = stop_perf_counters(group, &group->fds_mbl);
                 if (ret == PQOS_RETVAL_OK)
                         stopped_evts |= PQOS_MON_EVENT_LMEM_BW;
         }
-        if  (events & PQOS_MON_EVENT_TMEM_BW) {
+        if  (perf_evts & PQOS_MON_EVENT_TMEM_BW) {
                 ret = stop_perf_counters(group, &group->fds_mbt);
                 if (ret == PQOS_RETVAL_OK)
                         stopped_evts |= PQOS_MON_EVENT_TMEM_BW;
         }
-        if (events & PQOS_MON_EVENT_RMEM_BW) {
+        if (perf_evts & PQOS_MON_EVENT_RMEM_BW) {
                 int ret2;
 
-                if (!(events & PQOS_MON_EVENT_LMEM_BW))
+                if (!(perf_evts & PQOS_MON_EVENT_LMEM_BW))
                         ret = stop_perf_counters(group, &group->fds_mbl);
                 else
                         ret = PQOS_RETVAL_OK;
 
-                if (!(events & PQOS_MON_EVENT_TMEM_BW))
+                if (!(perf_evts & PQOS_MON_EVENT_TMEM_BW))
                         ret2 = stop_perf_counters(group, &group->fds_mbt);
                 else
                         ret2 = PQOS_RETVAL_OK;
@@ -684,12 +764,19 @@ start_events(struct pqos_mon_data *group)
         int ret = PQOS_RETVAL_OK;
         struct os_supported_event *se;
         enum pqos_mon_event started_evts = 0;
+        enum pqos_mon_event perf_evts = group->event;
 
         ASSERT(group != NULL);
+
+        /* RMID events of resctrl monitoring group need no counters */
+        if (group->resctrl_mon != NULL) {
+                started_evts = group->event & OS_MON_RDT_EVENTS;
+                perf_evts &= ~OS_MON_RDT_EVENTS;
+        }
          /**
          * Determine selected events and start Perf counters
          */
-        if (group->event & PQOS_MON_EVENT_L3_OCCUP) {
+        if (perf_evts & PQOS_MON_EVENT_L3_OCCUP) {
                 if (!is_event_supported(PQOS_MON_EVENT_L3_OCCUP))
                         return PQOS_RETVAL_ERROR;
                 se = get_supported_event(PQOS_MON_EVENT_L3_OCCUP);
@@ -699,7 +786,7 @@ start_events(struct pqos_mon_data *group)
 
                 started_evts |= PQOS_MON_EVENT_L3_OCCUP;
         }
-        if (group->event & PQOS_MON_EVENT_LMEM_BW) {
+        if (perf_evts & PQOS_MON_EVENT_LMEM_BW) {
                 if (!is_event_supported(PQOS_MON_EVENT_LMEM_BW))
                         return PQOS_RETVAL_ERROR;
                 se = get_supported_event(PQOS_MON_EVENT_LMEM_BW);
@@ -709,7 +796,7 @@ start_events(struct pqos_mon_data *group)
 
                 started_evts |= PQOS_MON_EVENT_LMEM_BW;
         }
-        if (group->event & PQOS_MON_EVENT_TMEM_BW) {
+        if (perf_evts & PQOS_MON_EVENT_TMEM_BW) {
                 if (!is_event_supported(PQOS_MON_EVENT_TMEM_BW))
                         return PQOS_RETVAL_ERROR;
                 se = get_supported_event(PQOS_MON_EVENT_TMEM_BW);
@@ -719,7 +806,7 @@ start_events(struct pqos_mon_data *group)
 
                 started_evts |= PQOS_MON_EVENT_TMEM_BW;
         }
-        if (group->event & PQOS_MON_EVENT_RMEM_BW) {
+        if (perf_evts & PQOS_MON_EVENT_RMEM_BW) {
                 if (!is_event_supported(PQOS_MON_EVENT_LMEM_BW) ||
                     !is_event_supported(PQOS_MON_EVENT_TMEM_BW)) {
                         ret = PQOS_RETVAL_ERROR;
@@ -830,6 +917,31 @@ read_perf_counters(struct pqos_mon_data *group,
         return PQOS_RETVAL_OK;
 }
 
+/**
+ * @brief Function to read RMID event counters
+ *
+ * Reads resctrl monitoring group of the group if there is one,
+ * perf counters otherwise
+ *
+ * @param group monitoring structure
+ * @param event RMID event to read
+ * @param value destination to store value
+ * @param fds array of fd's
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+read_rdt_counters(struct pqos_mon_data *group,
+                  const enum pqos_mon_event event,
+                  uint64_t *value, int *fds)
+{
+        if (group->resctrl_mon != NULL)
+                return resctrl_mon_group_read(group->resctrl_mon, event,
+                                              value);
+        return read_perf_counters(group, value, fds);
+}
+
 /**
  * @brief Gives the difference between two values with regard to the possible
  *        overrun
@@ -855,15 +967,19 @@ os_mon_init(const struct pqos_cpuinfo *cpu, const struct pqos_cap *cap)
 	if (cpu == NULL || cap == NULL)
 		return PQOS_RETVAL_PARAM;
 
-        /* Set RDT perf attribute type */
-	ret = set_mon_type();
-        if (ret != PQOS_RETVAL_OK)
-                return ret;
+        /* Prefer resctrl monitoring, fall back to RDT perf events */
+        ret = set_resctrl_events();
+        if (ret != PQOS_RETVAL_OK) {
+                /* Set RDT perf attribute type */
+                ret = set_mon_type();
+                if (ret != PQOS_RETVAL_OK)
+                        return ret;
 
-        /* Detect and set events */
-        ret = set_mon_events();
-        if (ret != PQOS_RETVAL_OK)
-                return ret;
+                /* Detect and set events */
+                ret = set_mon_events();
+                if (ret != PQOS_RETVAL_OK)
+                        return ret;
+        }
 
         /* Update capabilities structure with perf supported events */
         ret = set_mon_caps(cap);
@@ -881,10 +997,43 @@ os_mon_fini(void)
 {
         m_cap = NULL;
         m_cpu = NULL;
+        m_resctrl = 0;
 
         return PQOS_RETVAL_OK;
 }
 
+/**
+ * @brief Removes resctrl monitoring group of a monitoring group
+ *
+ * Tasks of resctrl monitoring group return to the parent resctrl group.
+ *
+ * @param group monitoring structure
+ */
+static void
+release_resctrl_mon(struct pqos_mon_data *group)
+{
+        if (group->resctrl_mon == NULL)
+                return;
+        (void) resctrl_mon_group_remove(group->resctrl_mon);
+        group->resctrl_mon = NULL;
+}
+
+/**
+ * @brief Releases cgroup resources of a monitoring group
+ *
+ * @param group monitoring structure
+ */
+static void
+release_cgroup(struct pqos_mon_data *group)
+{
+        release_resctrl_mon(group);
+        if (group->cgroup_fd >= 0)
+                close(group->cgroup_fd);
+        group->cgroup_fd = -1;
+        free(group->cgroup);
+        group->cgroup = NULL;
+}
+
 int
 os_mon_stop(struct pqos_mon_data *group)
 {
@@ -907,6 +1056,10 @@ os_mon_stop(struct pqos_mon_data *group)
                 free(group->tid_map);
                 group->tid_map = NULL;
         }
+        if (group->cgroup != NULL)
+                release_cgroup(group);
+        else
+                release_resctrl_mon(group);
         memset(group, 0, sizeof(*group));
 
         return ret;
@@ -961,6 +1114,8 @@ os_mon_start(const unsigned num_cores,
         memset(group, 0, sizeof(*group));
         group->event = event;
         group->context = context;
+        group->values.confidence = 1.0;
+        group->values.llc_confidence = 1.0;
         group->cores = (unsigned *) malloc(sizeof(group->cores[0]) * num_cores);
         if (group->cores == NULL)
                 return PQOS_RETVAL_RESOURCE;
@@ -969,9 +1124,24 @@ os_mon_start(const unsigned num_cores,
         for (i = 0; i < num_cores; i++)
                 group->cores[i] = cores[i];
 
+        /**
+         * RMID events count tasks running on the cores
+         * through cpus of resctrl monitoring group
+         */
+        if (m_resctrl && (event & OS_MON_RDT_EVENTS)) {
+                ret = resctrl_mon_group_create_cpus(m_cap, cores, num_cores,
+                                                    &group->resctrl_mon);
+                if (ret != PQOS_RETVAL_OK) {
+                        free(group->cores);
+                        return ret;
+                }
+        }
+
         ret = start_events(group);
-        if (ret != PQOS_RETVAL_OK && group->cores != NULL)
+        if (ret != PQOS_RETVAL_OK) {
+                release_resctrl_mon(group);
                 free(group->cores);
+        }
 
         return ret;
 }
@@ -1030,10 +1200,146 @@ os_mon_start_pid(struct pqos_mon_data *group)
                 group->tid_map[0] = pid;
         }
 
+        /**
+         * RMID events count tasks of resctrl monitoring group,
+         * threads created later inherit it
+         */
+        if (m_resctrl && (group->event & OS_MON_RDT_EVENTS)) {
+                ret = resctrl_mon_group_create_tasks(m_cap, group->tid_map,
+                                                     group->tid_nr,
+                                                     &group->resctrl_mon);
+                if (ret != PQOS_RETVAL_OK) {
+                        release_resctrl_mon(group);
+                        free(group->tid_map);
+                        return ret;
+                }
+        }
+
         ret = start_events(group);
-        if (ret != PQOS_RETVAL_OK && group->tid_map != NULL)
+        if (ret != PQOS_RETVAL_OK) {
+                release_resctrl_mon(group);
                 free(group->tid_map);
+        }
+
+        return ret;
+}
+
+/**
+ * @brief Reads task ID's of cgroup \a dir
+ *
+ * @param dir cgroup directory
+ * @param count place to store number of tasks
+ *
+ * @return Allocated task ID table
+ * @retval NULL on error
+ */
+static pid_t *
+read_cgroup_tasks(const char *dir, unsigned *count)
+{
+        /* cgroup v2 lists threads in cgroup.threads, v1 in tasks */
+        static const char * const files[] = { "cgroup.threads", "tasks" };
+        pid_t *tasks = NULL;
+        unsigned i, num = 0, max = 0;
+        FILE *fd = NULL;
+        char buf[512];
+        int tid;
+
+        for (i = 0; i < DIM(files) && fd == NULL; i++) {
+                snprintf(buf, sizeof(buf), "%s/%s", dir, files[i]);
+                fd = fopen(buf, "r");
+        }
+        if (fd == NULL) {
+                LOG_ERROR("Failed to read tasks of cgroup %s!\n", dir);
+                return NULL;
+        }
+
+        while (fscanf(fd, "%d", &tid) == 1) {
+                if (num == max) {
+                        pid_t *t;
+
+                        max = max ? max * 2 : 64;
+                        t = realloc(tasks, max * sizeof(tasks[0]));
+                        if (t == NULL) {
+                                free(tasks);
+                                fclose(fd);
+                                return NULL;
+                        }
+                        tasks = t;
+                }
+                tasks[num++] = (pid_t)tid;
+        }
+        fclose(fd);
+
+        /* empty cgroup is valid, its future tasks are monitored */
+        if (tasks == NULL)
+                tasks = malloc(sizeof(tasks[0]));
+        *count = num;
+        return tasks;
+}
+
+int
+os_mon_start_cgroup(struct pqos_mon_data *group)
+{
+        pid_t *tasks = NULL;
+        unsigned i, num_tasks = 0;
+        int ret;
+
+        ASSERT(group != NULL);
+        ASSERT(group->cgroup != NULL);
+        ASSERT(m_cpu != NULL);
+
+        group->cgroup_fd = open(group->cgroup, O_RDONLY | O_DIRECTORY);
+        if (group->cgroup_fd < 0) {
+                LOG_ERROR("Cgroup %s does not exist!\n", group->cgroup);
+                return PQOS_RETVAL_PARAM;
+        }
+
+        /**
+         * Perf counts cgroup tasks per core, tasks joining the cgroup
+         * later are counted without any rescan
+         */
+        group->cores = malloc(sizeof(group->cores[0]) * m_cpu->num_cores);
+        if (group->cores == NULL) {
+                ret = PQOS_RETVAL_RESOURCE;
+                goto os_mon_start_cgroup_exit;
+        }
+        group->num_cores = m_cpu->num_cores;
+        for (i = 0; i < m_cpu->num_cores; i++)
+                group->cores[i] = m_cpu->cores[i].lcore;
 
+        /**
+         * RMID events come from resctrl monitoring group where available.
+         * Tasks forked by the moved ones inherit the monitoring group,
+         * tasks attached to the cgroup or moved to another COS later
+         * are moved by os_mon_poll().
+         */
+        if (m_resctrl && (group->event & OS_MON_RDT_EVENTS)) {
+                tasks = read_cgroup_tasks(group->cgroup, &num_tasks);
+                if (tasks == NULL) {
+                        ret = PQOS_RETVAL_ERROR;
+                        goto os_mon_start_cgroup_exit;
+                }
+                ret = resctrl_mon_group_create_tasks(m_cap, tasks, num_tasks,
+                                                     &group->resctrl_mon);
+                if (ret != PQOS_RETVAL_OK)
+                        goto os_mon_start_cgroup_exit;
+                /* without watches task lists are re-read on each poll */
+                if (resctrl_mon_group_watch(m_cap, group->resctrl_mon,
+                                            group->cgroup) != PQOS_RETVAL_OK)
+                        LOG_WARN("Failed to watch tasks of cgroup %s\n",
+                                 group->cgroup);
+        }
+
+        ret = start_events(group);
+
+ os_mon_start_cgroup_exit:
+        free(tasks);
+        if (ret != PQOS_RETVAL_OK) {
+                free(group->cores);
+                group->cores = NULL;
+                group->num_cores = 0;
+                release_cgroup(group);
+        }
         return ret;
 }
 
@@ -1057,39 +1363,47 @@ poll_perf_counters(struct pqos_mon_data *group)
          * Read and store counter values
          * for each event
          */
+        /**
+         * RMID events of a resctrl counter that isn't ready keep
+         * previous sample values, the next read covers both intervals
+         */
         if (group->event & PQOS_MON_EVENT_L3_OCCUP) {
-                ret = read_perf_counters(group,
-                                         &group->values.llc,
-                                         group->fds_llc);
-                if (ret != PQOS_RETVAL_OK)
+                ret = read_rdt_counters(group, PQOS_MON_EVENT_L3_OCCUP,
+                                        &group->values.llc,
+                                        group->fds_llc);
+                if (ret != PQOS_RETVAL_OK && ret != PQOS_RETVAL_BUSY)
                         return PQOS_RETVAL_ERROR;
 
-                group->values.llc = group->values.llc *
-                        events_tab[OS_MON_EVT_IDX_LLC].scale;
+                /* resctrl reports bytes already */
+                if (group->resctrl_mon == NULL)
+                        group->values.llc = group->values.llc *
+                                events_tab[OS_MON_EVT_IDX_LLC].scale;
         }
         if ((group->event & PQOS_MON_EVENT_LMEM_BW) ||
             (group->event & PQOS_MON_EVENT_RMEM_BW)) {
                 uint64_t old_value = group->values.mbm_local;
 
-                ret = read_perf_counters(group,
-                                         &group->values.mbm_local,
-                                         group->fds_mbl);
-                if (ret != PQOS_RETVAL_OK)
+                ret = read_rdt_counters(group, PQOS_MON_EVENT_LMEM_BW,
+                                        &group->values.mbm_local,
+                                        group->fds_mbl);
+                if (ret == PQOS_RETVAL_OK)
+                        group->values.mbm_local_delta =
+                                get_delta(old_value, group->values.mbm_local);
+                else if (ret != PQOS_RETVAL_BUSY)
                         return PQOS_RETVAL_ERROR;
-                group->values.mbm_local_delta =
-                        get_delta(old_value, group->values.mbm_local);
         }
         if ((group->event & PQOS_MON_EVENT_TMEM_BW) ||
             (group->event & PQOS_MON_EVENT_RMEM_BW)) {
                 uint64_t old_value = group->values.mbm_total;
 
-                ret = read_perf_counters(group,
-                                         &group->values.mbm_total,
-                                         group->fds_mbt);
-                if (ret != PQOS_RETVAL_OK)
+                ret = read_rdt_counters(group, PQOS_MON_EVENT_TMEM_BW,
+                                        &group->values.mbm_total,
+                                        group->fds_mbt);
+                if (ret == PQOS_RETVAL_OK)
+                        group->values.mbm_total_delta =
+                                get_delta(old_value, group->values.mbm_total);
+                else if (ret != PQOS_RETVAL_BUSY)
                         return PQOS_RETVAL_ERROR;
-                group->values.mbm_total_delta =
-                        get_delta(old_value, group->values.mbm_total);
         }
         if (group->event & PQOS_MON_EVENT_RMEM_BW) {
                 group->values.mbm_remote_delta = 0;
@@ -1146,6 +1460,39 @@ poll_perf_counters(struct pqos_mon_data *group)
         return PQOS_RETVAL_OK;
 }
 
+/**
+ * @brief Moves tasks attached to a monitored cgroup since the last poll
+ *        into its resctrl monitoring group
+ *
+ * Perf follows cgroup tasks by itself, resctrl only follows tasks
+ * forked by the ones already moved. Processes attached later,
+ * e.g. by a write to cgroup.procs, and tasks the kernel removed from
+ * the group on a COS move have to be moved here. Tasks are re-read
+ * only after a write to the watched task lists.
+ *
+ * @param group monitoring structure
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+update_cgroup_tasks(struct pqos_mon_data *group)
+{
+        unsigned num_tasks = 0;
+        pid_t *tasks;
+        int ret;
+
+        if (!resctrl_mon_group_changed(group->resctrl_mon))
+                return PQOS_RETVAL_OK;
+        tasks = read_cgroup_tasks(group->cgroup, &num_tasks);
+        if (tasks == NULL)
+                return PQOS_RETVAL_ERROR;
+        ret = resctrl_mon_group_update_tasks(m_cap, group->resctrl_mon,
+                                             tasks, num_tasks);
+        free(tasks);
+        return ret;
+}
+
 int
 os_mon_poll(struct pqos_mon_data **groups,
               const unsigned num_groups)
@@ -1157,6 +1504,11 @@ os_mon_poll(struct pqos_mon_data **groups,
         ASSERT(num_groups > 0);
 
         for (i = 0; i < num_groups; i++) {
+                if (groups[i]->cgroup != NULL &&
+                    groups[i]->resctrl_mon != NULL &&
+                    update_cgroup_tasks(groups[i]) != PQOS_RETVAL_OK)
+                        LOG_WARN("Failed to follow tasks of cgroup %s\n",
+                                 groups[i]->cgroup);
                 /**
                  * If monitoring core/PID then read
                  * counter values
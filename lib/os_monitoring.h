@@ -125,6 +125,20 @@ os_mon_poll(struct pqos_mon_data **groups,
 int
 os_mon_start_pid(struct pqos_mon_data *group);
 
+/**
+ * @brief This function starts all counters for a cgroup
+ *
+ * IPC and LLC misses are counted by perf in cgroup mode on every core.
+ * RMID events use a resctrl monitoring group where available.
+ *
+ * @param group monitoring structure with cgroup directory set
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int
+os_mon_start_cgroup(struct pqos_mon_data *group);
+
 #ifdef __cplusplus
 }
 #endif
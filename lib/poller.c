@@ -0,0 +1,246 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Monitoring poller pool
+ *
+ * Workers sleep on a condition variable until poller_run() publishes a new
+ * work generation, run the work function for their cluster and report
+ * back. Workers block all signals so they never steal the application's
+ * signal handling.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "pqos.h"
+#include "poller.h"
+#include "log.h"
+#include "types.h"
+
+/**
+ * Worker thread of the pool
+ */
+struct poller_worker {
+        pthread_t thread;               /**< thread handle */
+        unsigned index;                 /**< worker index */
+        unsigned cluster;               /**< L3 cluster id */
+};
+
+static struct poller_worker *m_workers = NULL;
+static unsigned m_num_workers = 0;
+static pthread_mutex_t m_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t m_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t m_done = PTHREAD_COND_INITIALIZER;
+static unsigned m_generation = 0;       /**< incremented by poller_run() */
+static unsigned m_pending = 0;          /**< workers still running */
+static int m_stop = 0;
+static void (*m_fn)(void *, const unsigned, const unsigned) = NULL;
+static void *m_arg = NULL;
+
+/**
+ * @brief Worker thread main loop
+ */
+static void *
+poller_worker_main(void *arg)
+{
+        const struct poller_worker *w = (const struct poller_worker *)arg;
+        unsigned seen = 0;
+
+        pthread_mutex_lock(&m_lock);
+        for (;;) {
+                void (*fn)(void *, const unsigned, const unsigned);
+                void *fn_arg;
+
+                while (!m_stop && m_generation == seen)
+                        pthread_cond_wait(&m_start, &m_lock);
+                if (m_stop)
+                        break;
+                seen = m_generation;
+                fn = m_fn;
+                fn_arg = m_arg;
+                pthread_mutex_unlock(&m_lock);
+
+                fn(fn_arg, w->index, w->cluster);
+
+                pthread_mutex_lock(&m_lock);
+                if (--m_pending == 0)
+                        pthread_cond_signal(&m_done);
+        }
+        pthread_mutex_unlock(&m_lock);
+        return NULL;
+}
+
+/**
+ * @brief Starts worker \a w pinned to cores of its cluster
+ */
+static int
+poller_worker_start(const struct pqos_cpuinfo *cpu, struct poller_worker *w)
+{
+        pthread_attr_t attr;
+        int ret = 0;
+#ifdef __linux__
+        cpu_set_t cpuset;
+        unsigned i;
+
+        CPU_ZERO(&cpuset);
+        for (i = 0; i < cpu->num_cores; i++)
+                if (cpu->cores[i].l3_id == w->cluster)
+                        CPU_SET(cpu->cores[i].lcore, &cpuset);
+#else
+        UNUSED_PARAM(cpu);
+#endif
+
+        if (pthread_attr_init(&attr) != 0)
+                return PQOS_RETVAL_ERROR;
+#ifdef __linux__
+        ret = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+#endif
+        if (ret == 0)
+                ret = pthread_create(&w->thread, &attr,
+                                     poller_worker_main, w);
+        pthread_attr_destroy(&attr);
+
+        return ret == 0 ? PQOS_RETVAL_OK : PQOS_RETVAL_ERROR;
+}
+
+int
+poller_init(const struct pqos_cpuinfo *cpu)
+{
+        sigset_t all, old;
+        unsigned i, j;
+        int ret = PQOS_RETVAL_OK;
+
+        ASSERT(cpu != NULL);
+        if (cpu == NULL)
+                return PQOS_RETVAL_PARAM;
+        if (m_workers != NULL)
+                return PQOS_RETVAL_OK;
+
+        m_workers = calloc(cpu->num_cores, sizeof(m_workers[0]));
+        if (m_workers == NULL)
+                return PQOS_RETVAL_RESOURCE;
+
+        /**
+         * One worker per distinct L3 cluster
+         */
+        for (i = 0; i < cpu->num_cores; i++) {
+                for (j = 0; j < m_num_workers; j++)
+                        if (m_workers[j].cluster == cpu->cores[i].l3_id)
+                                break;
+                if (j < m_num_workers)
+                        continue;
+                m_workers[m_num_workers].index = m_num_workers;
+                m_workers[m_num_workers].cluster = cpu->cores[i].l3_id;
+                m_num_workers++;
+        }
+
+        /* nothing to parallelize on single cluster systems */
+        if (m_num_workers < 2) {
+                free(m_workers);
+                m_workers = NULL;
+                m_num_workers = 0;
+                return PQOS_RETVAL_OK;
+        }
+
+        m_stop = 0;
+        m_generation = 0;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        for (i = 0; i < m_num_workers; i++) {
+                ret = poller_worker_start(cpu, &m_workers[i]);
+                if (ret != PQOS_RETVAL_OK)
+                        break;
+        }
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+        if (ret != PQOS_RETVAL_OK) {
+                LOG_ERROR("Failed to start monitoring poller thread\n");
+                m_num_workers = i;
+                poller_fini();
+                return ret;
+        }
+        LOG_INFO("Started %u monitoring poller threads\n", m_num_workers);
+        return PQOS_RETVAL_OK;
+}
+
+void
+poller_fini(void)
+{
+        unsigned i;
+
+        if (m_workers == NULL)
+                return;
+
+        pthread_mutex_lock(&m_lock);
+        m_stop = 1;
+        pthread_cond_broadcast(&m_start);
+        pthread_mutex_unlock(&m_lock);
+
+        for (i = 0; i < m_num_workers; i++)
+                pthread_join(m_workers[i].thread, NULL);
+
+        free(m_workers);
+        m_workers = NULL;
+        m_num_workers = 0;
+}
+
+unsigned
+poller_num_workers(void)
+{
+        return m_num_workers;
+}
+
+int
+poller_run(void (*fn)(void *, const unsigned, const unsigned), void *arg)
+{
+        ASSERT(fn != NULL);
+        if (fn == NULL || m_num_workers == 0)
+                return PQOS_RETVAL_PARAM;
+
+        pthread_mutex_lock(&m_lock);
+        m_fn = fn;
+        m_arg = arg;
+        m_pending = m_num_workers;
+        m_generation++;
+        pthread_cond_broadcast(&m_start);
+        while (m_pending > 0)
+                pthread_cond_wait(&m_done, &m_lock);
+        pthread_mutex_unlock(&m_lock);
+
+        return PQOS_RETVAL_OK;
+}
@@ -0,0 +1,91 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Internal header file of the monitoring poller pool
+ *
+ * One worker thread per L3 cluster, pinned to a core of the cluster, so
+ * MSRs of a cluster are accessed locally and clusters are read in
+ * parallel.
+ */
+
+#ifndef __PQOS_POLLER_H__
+#define __PQOS_POLLER_H__
+
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts one worker per L3 cluster of \a cpu
+ *
+ * @param cpu cpu topology structure
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+int poller_init(const struct pqos_cpuinfo *cpu);
+
+/**
+ * @brief Stops workers started by poller_init()
+ */
+void poller_fini(void);
+
+/**
+ * @brief Returns number of running workers, 0 if the pool is not started
+ */
+unsigned poller_num_workers(void);
+
+/**
+ * @brief Runs \a fn on all workers and waits for them to finish
+ *
+ * \a fn is called with \a arg, worker index and L3 cluster id served by
+ * the worker. Not reentrant, callers serialize with the API lock.
+ *
+ * @param fn work function
+ * @param arg argument of \a fn
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+int poller_run(void (*fn)(void *, const unsigned, const unsigned),
+               void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQOS_POLLER_H__ */
@@ -57,7 +57,7 @@ extern "C" {
  * =======================================
  */
 
-#define PQOS_VERSION       10200        /**< version 1.2.0 */
+#define PQOS_VERSION       20000        /**< version 2.0.0 */
 #define PQOS_MAX_L3CA_COS  16           /**< 16 x COS */
 #define PQOS_MAX_L2CA_COS  16           /**< 16 x COS */
 
@@ -106,6 +106,7 @@ enum pqos_cdp_config {
  *                        when receiving the callback
  *         const size_t - the size of the log message
  *         const char * - the log message
+ *        The callback is called from a library thread.
  * @param context_log application specific data that is provided
  *                    to the callback function. It can be NULL if application
  *                    doesn't require it.
@@ -118,6 +119,16 @@ enum pqos_cdp_config {
  * @param interface preference
  *         PQOS_INTER_MSR      - MSR interface or nothing
  *         PQOS_INTER_OS       - OS interface or nothing
+ * @param parallel_poll if not zero, pqos_mon_poll() reads counters of
+ *        each L3 cluster on a worker thread pinned to that cluster
+ *        (MSR interface only)
+ * @param mon_multiplex if not zero, pqos_mon_start() doesn't fail once
+ *        an L3 cluster runs out of RMIDs; groups take RMIDs in turns of
+ *        this many measured polls and memory bandwidth of groups waiting
+ *        for their turn is extrapolated (MSR interface only)
+ * @param snapshot if not zero, CPU topology and hardware capabilities
+ *        are loaded from a snapshot taken on the same platform and
+ *        the snapshot is saved after discovery
  */
 struct pqos_config {
         int fd_log;
@@ -125,6 +136,9 @@ struct pqos_config {
         void *context_log;
         int verbose;
         int interface;
+        int parallel_poll;
+        unsigned mon_multiplex;
+        int snapshot;
 };
 
 /**
@@ -355,8 +369,8 @@ struct pqos_event_values {
     //quxm add:原指令数测量保持不变，以core为粒度，新增以pid为粒度的测量
     uint64_t ipc_retired;           /**< instructions retired - reading of core*/
     uint64_t ipc_retired_delta;     /**< instructions retired - delta of core*/
-    uint64_t ipc_retired_pid;           /**< instructions retired - reading of pid*/
-    uint64_t ipc_retired_delta_pid;     /**< instructions retired - delta of pid*/
+    uint64_t ipc_retired_pid;           /**< instructions retired - reading of cgroup, filled by application*/
+    uint64_t ipc_retired_delta_pid;     /**< instructions retired - delta of cgroup, filled by application*/
     uint64_t ipc_unhalted;          /**< unhalted cycles - reading */
     uint64_t ipc_unhalted_delta;    /**< unhalted cycles - delta */
     double ipc;                     /**< retired instructions / cycles */
@@ -371,13 +385,28 @@ struct pqos_event_values {
     double cpu_usage;
     long int mem_vmrss;
 
-    //quxm add instructions fd.2018.6.10
-    int fd_ins;
-
     //quxm add server threads
     int thread_count;
+
+	double confidence;              /**< share of memory bandwidth values
+                                           measured rather than extrapolated,
+                                           from 0 to 1 */
+	double llc_confidence;          /**< 1 if cache occupancy was read
+                                           from RMIDs drained of lines of
+                                           their previous owner, lower
+                                           for an older value, 0 if none */
 };
 
+/**
+ * RMID multiplexing state of a monitoring group
+ */
+struct pqos_mon_mux;
+
+/**
+ * resctrl monitoring group
+ */
+struct resctrl_mon_group;
+
 /**
  * Core monitoring poll context
  */
@@ -422,8 +451,18 @@ struct pqos_mon_data {
         unsigned *cores;                /**< list of cores in the group */
         unsigned num_cores;             /**< number of cores in the group */
         int valid_mbm_read;             /**< flag to discard 1st invalid read */
+        struct pqos_mon_mux *mux;       /**< RMID multiplexing state,
+                                           NULL if RMIDs are dedicated */
 
-        int perf_pid_ipc_enable;   //add by quxm, recognize whether use perf_event_open to get ipc or not.2018.6.10
+        /**
+         * Cgroup specific section
+         */
+        char *cgroup;                   /**< cgroup directory, NULL if
+                                           group doesn't track a cgroup */
+        int cgroup_fd;                  /**< cgroup directory fd */
+        struct resctrl_mon_group *resctrl_mon; /**< resctrl monitoring
+                                           group, NULL if RMID events
+                                           are counted by perf */
 };
 
 /**
@@ -446,6 +485,24 @@ int pqos_mon_reset(void);
 int pqos_mon_assoc_get(const unsigned lcore,
                        pqos_rmid_t *rmid);
 
+/**
+ * @brief Reports RMIDs left for monitoring groups in L3 cluster \a l3_id
+ *
+ * RMIDs released by pqos_mon_stop() stay in limbo until their LLC
+ * occupancy drains. Limbo is checked while polling and when the free
+ * RMIDs run out.
+ *
+ * @param [in] l3_id L3 cluster id
+ * @param [out] num_free number of RMIDs ready for allocation
+ * @param [out] num_limbo number of RMIDs in limbo, may be NULL
+ *
+ * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int pqos_mon_rmid_avail(const unsigned l3_id,
+                        unsigned *num_free,
+                        unsigned *num_limbo);
+
 /**
  * @brief Starts resource monitoring on selected group of cores
  *
@@ -491,6 +548,33 @@ int pqos_mon_start_pid(const pid_t pid,
                        void *context,
                        struct pqos_mon_data *group);
 
+/**
+ * @brief Starts resource monitoring of all tasks of a cgroup
+ *
+ * IPC and LLC misses are counted by perf in cgroup mode, so tasks
+ * joining the cgroup later are followed without rescanning it.
+ * CMT/MBM events use a resctrl monitoring group where available;
+ * tasks already in the cgroup are moved there and tasks they create
+ * inherit it. Tasks attached to the cgroup later, or moved to another
+ * COS, are moved there by pqos_mon_poll(), so their CMT/MBM is counted
+ * from the first poll after they are attached. Task lists are re-read
+ * only when a cgroup or COS task list was written.
+ *
+ * @param [in] cgroup cgroup directory, in perf_event hierarchy for
+ *             cgroup v1
+ * @param [in] event monitoring event id
+ * @param [in] context a pointer for application's convenience
+ *             (unused by the library)
+ * @param [in,out] group a pointer to monitoring structure
+ *
+ * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int pqos_mon_start_cgroup(const char *cgroup,
+                          const enum pqos_mon_event event,
+                          void *context,
+                          struct pqos_mon_data *group);
+
 /**
  * @brief Stops resource monitoring data for selected monitoring group
  *
@@ -530,6 +614,22 @@ int pqos_mon_poll(struct pqos_mon_data **groups,
 int pqos_alloc_assoc_set(const unsigned lcore,
                          const unsigned class_id);
 
+/**
+ * @brief Associates \a cores with given class of service
+ *
+ * Equivalent of calling pqos_alloc_assoc_set() for each core
+ * at the cost of a single update.
+ *
+ * @param [in] cores table of CPU logical core id's
+ * @param [in] num_cores number of cores in the table
+ * @param [in] class_id class of service
+ *
+ * @return Operations status
+ */
+int pqos_alloc_assoc_set_many(const unsigned *cores,
+                              const unsigned num_cores,
+                              const unsigned class_id);
+
 /**
  * @brief Reads association of \a lcore with class of service
  *
@@ -568,6 +668,24 @@ int pqos_alloc_assoc_set_pid(const pid_t task,
 int pqos_alloc_assoc_get_pid(const pid_t task,
                              unsigned *class_id);
 
+/**
+ * @brief OS interface to read association
+ *        of \a tasks with class of service
+ *
+ * All tasks are looked up with a single pass over resctrl tasks files.
+ *
+ * @param [in] tasks table of task ID's
+ * @param [in] num_tasks number of task ID's
+ * @param [out] class_ids class of service of each task,
+ *              UINT_MAX for tasks not found
+ *
+ * @return Operations status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int pqos_alloc_assoc_get_pids(const pid_t *tasks,
+                              const unsigned num_tasks,
+                              unsigned *class_ids);
+
 /**
  * @brief Assign first available COS to cores in \a core_array
  *
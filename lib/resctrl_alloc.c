@@ -36,6 +36,8 @@
 #include <string.h>
 #include <ctype.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "log.h"
 #include "types.h"
@@ -137,6 +139,34 @@ strtouint64(const char *s, int base, uint64_t *value)
 	return PQOS_RETVAL_OK;
 }
 
+/**
+ * @brief Builds path of COS file in resctl filesystem
+ *
+ * @param [in] class_id COS id
+ * @param [in] name File name
+ * @param [out] buf place to store the path
+ * @param [in] size size of \a buf
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_alloc_path(const unsigned class_id, const char *name,
+		   char *buf, const size_t size)
+{
+	int result;
+
+	if (class_id == 0)
+		result = snprintf(buf, size, "%s/%s", RESCTRL_ALLOC_PATH, name);
+	else
+		result = snprintf(buf, size, "%s/COS%u/%s",
+				  RESCTRL_ALLOC_PATH, class_id, name);
+
+	if (result < 0 || (size_t)result >= size)
+		return PQOS_RETVAL_ERROR;
+	return PQOS_RETVAL_OK;
+}
+
 /**
  * @brief Opens COS file in resctl filesystem
  *
@@ -153,20 +183,12 @@ resctrl_alloc_fopen(const unsigned class_id, const char *name, const char *mode)
 {
 	FILE *fd;
 	char buf[128];
-	int result;
 
 	ASSERT(name != NULL);
 	ASSERT(mode != NULL);
 
-	memset(buf, 0, sizeof(buf));
-	if (class_id == 0)
-		result = snprintf(buf, sizeof(buf) - 1,
-				  "%s/%s", RESCTRL_ALLOC_PATH, name);
-	else
-		result = snprintf(buf, sizeof(buf) - 1, "%s/COS%u/%s",
-				  RESCTRL_ALLOC_PATH, class_id, name);
-
-	if (result < 0)
+	if (resctrl_alloc_path(class_id, name, buf, sizeof(buf)) !=
+	    PQOS_RETVAL_OK)
 		return NULL;
 
 	fd = fopen(buf, mode);
@@ -335,6 +357,134 @@ resctrl_alloc_cpumask_read(const unsigned class_id,
  * ---------------------------------------
  */
 
+/**
+ * Schemata file of a COS kept open together with its last known content
+ */
+struct resctrl_alloc_schemata_cache {
+	int fd;                                 /**< schemata file, -1 if
+						   not open */
+	int valid;                              /**< last holds file
+						   content */
+	struct resctrl_alloc_schemata last;     /**< last read or written
+						   schemata */
+};
+
+static struct resctrl_alloc_schemata_cache *m_schemata_cache = NULL;
+static unsigned m_schemata_cache_num = 0;
+
+/**
+ * @brief Gets schemata cache of \a class_id with schemata file open
+ *
+ * @param [in] class_id COS id
+ *
+ * @return Schemata cache
+ * @retval NULL on error
+ */
+static struct resctrl_alloc_schemata_cache *
+resctrl_alloc_schemata_cache_get(const unsigned class_id)
+{
+	struct resctrl_alloc_schemata_cache *cache;
+	char buf[128];
+
+	if (class_id >= m_schemata_cache_num) {
+		unsigned i;
+
+		cache = realloc(m_schemata_cache,
+				(class_id + 1) * sizeof(cache[0]));
+		if (cache == NULL)
+			return NULL;
+		for (i = m_schemata_cache_num; i <= class_id; i++) {
+			memset(&cache[i], 0, sizeof(cache[i]));
+			cache[i].fd = -1;
+		}
+		m_schemata_cache = cache;
+		m_schemata_cache_num = class_id + 1;
+	}
+
+	cache = &m_schemata_cache[class_id];
+	if (cache->fd >= 0)
+		return cache;
+
+	if (resctrl_alloc_path(class_id, rctl_schemata, buf, sizeof(buf)) !=
+	    PQOS_RETVAL_OK)
+		return NULL;
+
+	cache->fd = open(buf, O_RDWR);
+	if (cache->fd < 0) {
+		LOG_ERROR("Could not open %s file %s for COS %u\n",
+			  rctl_schemata, buf, class_id);
+		return NULL;
+	}
+	cache->valid = 0;
+	return cache;
+}
+
+/**
+ * @brief Stores copy of \a schemata as last known content of the file
+ *
+ * @param [in] cache schemata cache
+ * @param [in] schemata schemata to store
+ */
+static void
+resctrl_alloc_schemata_cache_set(struct resctrl_alloc_schemata_cache *cache,
+				 const struct resctrl_alloc_schemata *schemata)
+{
+	struct resctrl_alloc_schemata *last = &cache->last;
+
+	if (last->l2ca_num != schemata->l2ca_num ||
+	    last->l3ca_num != schemata->l3ca_num ||
+	    last->mba_num != schemata->mba_num) {
+		resctrl_alloc_schemata_fini(last);
+		memset(last, 0, sizeof(*last));
+		if (schemata->l2ca_num > 0)
+			last->l2ca = malloc(schemata->l2ca_num *
+					    sizeof(last->l2ca[0]));
+		if (schemata->l3ca_num > 0)
+			last->l3ca = malloc(schemata->l3ca_num *
+					    sizeof(last->l3ca[0]));
+		if (schemata->mba_num > 0)
+			last->mba = malloc(schemata->mba_num *
+					   sizeof(last->mba[0]));
+		last->l2ca_num = schemata->l2ca_num;
+		last->l3ca_num = schemata->l3ca_num;
+		last->mba_num = schemata->mba_num;
+		if ((last->l2ca_num > 0 && last->l2ca == NULL) ||
+		    (last->l3ca_num > 0 && last->l3ca == NULL) ||
+		    (last->mba_num > 0 && last->mba == NULL)) {
+			resctrl_alloc_schemata_fini(last);
+			memset(last, 0, sizeof(*last));
+			cache->valid = 0;
+			return;
+		}
+	}
+
+	if (last->l2ca_num > 0)
+		memcpy(last->l2ca, schemata->l2ca,
+		       last->l2ca_num * sizeof(last->l2ca[0]));
+	if (last->l3ca_num > 0)
+		memcpy(last->l3ca, schemata->l3ca,
+		       last->l3ca_num * sizeof(last->l3ca[0]));
+	if (last->mba_num > 0)
+		memcpy(last->mba, schemata->mba,
+		       last->mba_num * sizeof(last->mba[0]));
+	cache->valid = 1;
+}
+
+void
+resctrl_alloc_schemata_cache_fini(void)
+{
+	unsigned i;
+
+	for (i = 0; i < m_schemata_cache_num; i++) {
+		if (m_schemata_cache[i].fd >= 0)
+			close(m_schemata_cache[i].fd);
+		resctrl_alloc_schemata_fini(&m_schemata_cache[i].last);
+	}
+	free(m_schemata_cache);
+	m_schemata_cache = NULL;
+	m_schemata_cache_num = 0;
+}
+
 void
 resctrl_alloc_schemata_fini(struct resctrl_alloc_schemata *schemata)
 {
@@ -547,26 +697,34 @@ resctrl_alloc_schemata_read(const unsigned class_id,
 			    struct resctrl_alloc_schemata *schemata)
 {
 	int ret = PQOS_RETVAL_OK;
-	FILE *fd;
+	struct resctrl_alloc_schemata_cache *cache;
 	int type = RESCTRL_ALLOC_SCHEMATA_TYPE_NONE;
 	char buf[16 * 1024];
+	char *line = NULL, *lineptr = NULL;
 	char *p = NULL, *q = NULL, *saveptr = NULL;
+	ssize_t len;
 
 	ASSERT(schemata != NULL);
 
-	fd = resctrl_alloc_fopen(class_id, rctl_schemata, "r");
-	if (fd == NULL)
+	if ((schemata->l3ca_num > 0 && schemata->l3ca == NULL)
+	    || (schemata->l2ca_num > 0 && schemata->l2ca == NULL))
 		return PQOS_RETVAL_ERROR;
 
-	if ((schemata->l3ca_num > 0 && schemata->l3ca == NULL)
-	    || (schemata->l2ca_num > 0 && schemata->l2ca == NULL)) {
-		ret = PQOS_RETVAL_ERROR;
-		goto resctrl_alloc_schemata_read_exit;
+	cache = resctrl_alloc_schemata_cache_get(class_id);
+	if (cache == NULL)
+		return PQOS_RETVAL_ERROR;
+
+	/* Kernel regenerates the file content on read from offset 0 */
+	len = pread(cache->fd, buf, sizeof(buf) - 1, 0);
+	if (len < 0) {
+		LOG_ERROR("Failed to read schemata of COS %u\n", class_id);
+		return PQOS_RETVAL_ERROR;
 	}
+	buf[len] = '\0';
 
-	memset(buf, 0, sizeof(buf));
-	while (fgets(buf, sizeof(buf), fd) != NULL) {
-		q = buf;
+	for (line = strtok_r(buf, "\n", &lineptr); line != NULL;
+	     line = strtok_r(NULL, "\n", &lineptr)) {
+		q = line;
 		/**
 		 * Trim white spaces
 		 */
@@ -583,6 +741,7 @@ resctrl_alloc_schemata_read(const unsigned class_id,
 		}
 		*p = '\0';
 		type = resctrl_alloc_schemata_type_get(q);
+		saveptr = NULL;
 
 		/* Skip unknown label */
 		if (type == RESCTRL_ALLOC_SCHEMATA_TYPE_NONE)
@@ -627,93 +786,169 @@ resctrl_alloc_schemata_read(const unsigned class_id,
 	}
 
  resctrl_alloc_schemata_read_exit:
-	/* check if error occured */
-	if (ret != PQOS_RETVAL_OK)
-		resctrl_alloc_fclose(fd);
+	/* file content is the baseline for the next write */
+	if (ret == PQOS_RETVAL_OK)
+		resctrl_alloc_schemata_cache_set(cache, schemata);
 	else
-		ret = resctrl_alloc_fclose(fd);
+		cache->valid = 0;
 
 	return ret;
 }
 
-int
-resctrl_alloc_schemata_write(const unsigned class_id,
-                             const struct resctrl_alloc_schemata *schemata)
+/**
+ * @brief Formats schemata file lines of \a schemata
+ *
+ * @param [in] schemata schemata to format
+ * @param [in] old last known file content, only domains changed since
+ *             then are formatted; NULL formats all domains
+ * @param [out] buf buffer to store the lines
+ * @param [in] size size of \a buf
+ *
+ * @return Length of the lines
+ * @retval -1 buffer too small
+ */
+static long
+resctrl_alloc_schemata_format(const struct resctrl_alloc_schemata *schemata,
+			      const struct resctrl_alloc_schemata *old,
+			      char *buf, const size_t size)
 {
-	int ret = PQOS_RETVAL_OK;
-	unsigned i;
+	unsigned i, n;
+	long len;
 	FILE *fd;
-	char buf[16 * 1024];
-
-	ASSERT(schemata != NULL);
 
-	fd = resctrl_alloc_fopen(class_id, rctl_schemata, "w");
+	fd = fmemopen(buf, size, "w");
 	if (fd == NULL)
-		return PQOS_RETVAL_ERROR;
-
-	/* Enable fully buffered output. File won't be flushed until 16kB
-	 * buffer is full */
-	if (setvbuf(fd, buf, _IOFBF, sizeof(buf)) != 0) {
-		resctrl_alloc_fclose(fd);
-		return PQOS_RETVAL_ERROR;
-	}
+		return -1;
 
 	/* L2 */
-	if (schemata->l2ca_num > 0) {
-		fprintf(fd, "L2:");
-		for (i = 0; i < schemata->l2ca_num; i++) {
-			if (i > 0)
-				fprintf(fd, ";");
-			fprintf(fd, "%u=%x", i, schemata->l2ca[i].ways_mask);
-		}
-		fprintf(fd, "\n");
+	for (i = 0, n = 0; i < schemata->l2ca_num; i++) {
+		if (old != NULL && old->l2ca[i].ways_mask ==
+		    schemata->l2ca[i].ways_mask)
+			continue;
+		fprintf(fd, n++ == 0 ? "L2:%u=%x" : ";%u=%x", i,
+			schemata->l2ca[i].ways_mask);
 	}
+	if (n > 0)
+		fprintf(fd, "\n");
 
 	/* L3 without CDP */
 	if (schemata->l3ca_num > 0 && !schemata->l3ca[0].cdp) {
-		fprintf(fd, "L3:");
-		for (i = 0; i < schemata->l3ca_num; i++) {
-			if (i > 0)
-				fprintf(fd, ";");
-			fprintf(fd, "%u=%llx", i, (unsigned long long)
+		for (i = 0, n = 0; i < schemata->l3ca_num; i++) {
+			if (old != NULL && old->l3ca[i].u.ways_mask ==
+			    schemata->l3ca[i].u.ways_mask)
+				continue;
+			fprintf(fd, n++ == 0 ? "L3:%u=%llx" : ";%u=%llx", i,
+				(unsigned long long)
 				schemata->l3ca[i].u.ways_mask);
 		}
-		fprintf(fd, "\n");
+		if (n > 0)
+			fprintf(fd, "\n");
 	}
 
 	/* L3 with CDP */
 	if (schemata->l3ca_num > 0 && schemata->l3ca[0].cdp) {
-		fprintf(fd, "L3CODE:");
-		for (i = 0; i < schemata->l3ca_num; i++) {
-			if (i > 0)
-				fprintf(fd, ";");
-			fprintf(fd, "%u=%llx", i, (unsigned long long)
+		for (i = 0, n = 0; i < schemata->l3ca_num; i++) {
+			if (old != NULL && old->l3ca[i].u.s.code_mask ==
+			    schemata->l3ca[i].u.s.code_mask)
+				continue;
+			fprintf(fd, n++ == 0 ? "L3CODE:%u=%llx" : ";%u=%llx",
+				i, (unsigned long long)
 				schemata->l3ca[i].u.s.code_mask);
 		}
-		fprintf(fd, "\nL3DATA:");
-		for (i = 0; i < schemata->l3ca_num; i++) {
-			if (i > 0)
-				fprintf(fd, ";");
-			fprintf(fd, "%u=%llx", i, (unsigned long long)
+		if (n > 0)
+			fprintf(fd, "\n");
+		for (i = 0, n = 0; i < schemata->l3ca_num; i++) {
+			if (old != NULL && old->l3ca[i].u.s.data_mask ==
+			    schemata->l3ca[i].u.s.data_mask)
+				continue;
+			fprintf(fd, n++ == 0 ? "L3DATA:%u=%llx" : ";%u=%llx",
+				i, (unsigned long long)
 				schemata->l3ca[i].u.s.data_mask);
 		}
-		fprintf(fd, "\n");
+		if (n > 0)
+			fprintf(fd, "\n");
 	}
 
 	/* MBA */
-	if (schemata->mba_num > 0) {
-		fprintf(fd, "MB:");
-		for (i = 0; i < schemata->mba_num; i++) {
-			if (i > 0)
-				fprintf(fd, ";");
-			fprintf(fd, "%u=%u", i, schemata->mba[i].mb_rate);
-		}
+	for (i = 0, n = 0; i < schemata->mba_num; i++) {
+		if (old != NULL && old->mba[i].mb_rate ==
+		    schemata->mba[i].mb_rate)
+			continue;
+		fprintf(fd, n++ == 0 ? "MB:%u=%u" : ";%u=%u", i,
+			schemata->mba[i].mb_rate);
+	}
+	if (n > 0)
 		fprintf(fd, "\n");
+
+	len = ftell(fd);
+	if (fclose(fd) != 0 || len < 0 || (size_t)len >= size)
+		return -1;
+
+	return len;
+}
+
+int
+resctrl_alloc_schemata_write(const unsigned class_id,
+                             const struct resctrl_alloc_schemata *schemata)
+{
+	struct resctrl_alloc_schemata_cache *cache;
+	const struct resctrl_alloc_schemata *old = NULL;
+	long len;
+	char buf[16 * 1024];
+
+	ASSERT(schemata != NULL);
+
+	cache = resctrl_alloc_schemata_cache_get(class_id);
+	if (cache == NULL)
+		return PQOS_RETVAL_ERROR;
+
+	/**
+	 * Domains missing from a line keep their value, so only entries
+	 * changed since the last known content are written
+	 */
+	if (cache->valid && cache->last.l2ca_num == schemata->l2ca_num &&
+	    cache->last.l3ca_num == schemata->l3ca_num &&
+	    cache->last.mba_num == schemata->mba_num &&
+	    (schemata->l3ca_num == 0 ||
+	     cache->last.l3ca[0].cdp == schemata->l3ca[0].cdp))
+		old = &cache->last;
+
+	len = resctrl_alloc_schemata_format(schemata, old, buf, sizeof(buf));
+	if (len < 0) {
+		LOG_ERROR("Schemata of COS %u too long\n", class_id);
+		return PQOS_RETVAL_ERROR;
 	}
 
-	ret = resctrl_alloc_fclose(fd);
+	/* Nothing changed */
+	if (len == 0)
+		return PQOS_RETVAL_OK;
 
-	return ret;
+	/* All lines in one write, kernel applies them together */
+	if (pwrite(cache->fd, buf, len, 0) == len) {
+		resctrl_alloc_schemata_cache_set(cache, schemata);
+		return PQOS_RETVAL_OK;
+	}
+
+	/**
+	 * Kernel may reject partial lines, e.g. if the cached content
+	 * went stale, retry once with all domains
+	 */
+	cache->valid = 0;
+	if (old != NULL) {
+		LOG_DEBUG("Partial schemata write of COS %u failed: %s, "
+			  "writing all domains\n", class_id, strerror(errno));
+		len = resctrl_alloc_schemata_format(schemata, NULL, buf,
+						    sizeof(buf));
+		if (len > 0 && pwrite(cache->fd, buf, len, 0) == len) {
+			resctrl_alloc_schemata_cache_set(cache, schemata);
+			return PQOS_RETVAL_OK;
+		}
+	}
+
+	/* next access reads the file content again */
+	LOG_ERROR("Failed to write schemata of COS %u: %s\n",
+		  class_id, strerror(errno));
+	return PQOS_RETVAL_ERROR;
 }
 
 /**
@@ -722,6 +957,28 @@ resctrl_alloc_schemata_write(const unsigned class_id,
  * ---------------------------------------
  */
 
+/**
+ * Task to COS index entry
+ */
+struct resctrl_alloc_task_entry {
+	pid_t task;                     /**< task ID, 0 marks free entry */
+	unsigned class_id;              /**< COS of the task */
+};
+
+/**
+ * Task to COS index built from all COS tasks files,
+ * open addressing hash table with linear probing.
+ * Tasks can be moved by other processes, the index only serves
+ * lookups of the pass it was built for.
+ */
+static struct {
+	struct resctrl_alloc_task_entry *tab;
+	unsigned size;                  /**< table size, power of 2 */
+	unsigned num;                   /**< number of tasks in the table */
+	char *buf;                      /**< tasks file read buffer */
+	size_t buf_size;                /**< size of the buffer */
+} m_task_index;
+
 int
 resctrl_alloc_task_validate(const pid_t task)
 {
@@ -764,69 +1021,288 @@ resctrl_alloc_task_write(const unsigned class_id, const pid_t task)
 	return ret;
 }
 
-unsigned *
-resctrl_alloc_task_read(unsigned class_id, unsigned *count)
+/**
+ * @brief Reads whole tasks file of \a class_id into task index buffer
+ *
+ * @param [in] class_id COS id
+ *
+ * @return Task index buffer holding the file
+ * @retval NULL on error
+ */
+static char *
+resctrl_alloc_task_load(const unsigned class_id)
 {
-	FILE *fd;
-	unsigned *tasks = NULL, idx = 0;
-	int ret;
-	char buf[128];
-	struct linked_list {
-		uint64_t task_id;
-		struct linked_list *next;
-	} head, *current = NULL;
+	char path[128];
+	size_t len = 0;
+	int fd;
 
-	/* Open resctrl tasks file */
-	fd = resctrl_alloc_fopen(class_id, rctl_tasks, "r");
-	if (fd == NULL)
+	if (resctrl_alloc_path(class_id, rctl_tasks, path, sizeof(path)) !=
+	    PQOS_RETVAL_OK)
 		return NULL;
 
-	head.next = NULL;
-	current = &head;
-	memset(buf, 0, sizeof(buf));
-	while (fgets(buf, sizeof(buf), fd) != NULL) {
-		uint64_t tmp;
-		struct linked_list *p = NULL;
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		LOG_ERROR("Could not open %s file %s for COS %u\n",
+			  rctl_tasks, path, class_id);
+		return NULL;
+	}
+
+	for (;;) {
+		ssize_t n;
+
+		if (m_task_index.buf_size - len < 4096) {
+			size_t size = m_task_index.buf_size ?
+				m_task_index.buf_size * 2 : 64 * 1024;
+			char *buf = realloc(m_task_index.buf, size);
+
+			if (buf == NULL) {
+				close(fd);
+				return NULL;
+			}
+			m_task_index.buf = buf;
+			m_task_index.buf_size = size;
+		}
+		n = read(fd, m_task_index.buf + len,
+			 m_task_index.buf_size - len - 1);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0) {
+			LOG_ERROR("Failed to read %s\n", path);
+			close(fd);
+			return NULL;
+		}
+		if (n == 0)
+			break;
+		len += n;
+	}
+	close(fd);
+
+	m_task_index.buf[len] = '\0';
+	return m_task_index.buf;
+}
+
+/**
+ * @brief Finds index table entry of \a task
+ *
+ * @param [in] tab hash table
+ * @param [in] size table size, power of 2
+ * @param [in] task task ID
+ *
+ * @return Entry holding \a task or free entry where it belongs
+ */
+static struct resctrl_alloc_task_entry *
+resctrl_alloc_task_entry(struct resctrl_alloc_task_entry *tab,
+			 const unsigned size, const pid_t task)
+{
+	unsigned h = ((unsigned)task * 2654435761u) & (size - 1);
+
+	while (tab[h].task != 0 && tab[h].task != task)
+		h = (h + 1) & (size - 1);
+	return &tab[h];
+}
+
+/**
+ * @brief Adds \a task to the task index, grows the table as needed
+ *
+ * @param [in] task task ID
+ * @param [in] class_id COS of the task
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_alloc_task_index_add(const pid_t task, const unsigned class_id)
+{
+	struct resctrl_alloc_task_entry *e;
+
+	/* keep load factor below 1/2 */
+	if ((m_task_index.num + 1) * 2 > m_task_index.size) {
+		const unsigned size = m_task_index.size ?
+			m_task_index.size * 2 : 4096;
+		struct resctrl_alloc_task_entry *tab;
+		unsigned i;
+
+		tab = calloc(size, sizeof(tab[0]));
+		if (tab == NULL)
+			return PQOS_RETVAL_RESOURCE;
+		for (i = 0; i < m_task_index.size; i++)
+			if (m_task_index.tab[i].task != 0)
+				*resctrl_alloc_task_entry(tab, size,
+					m_task_index.tab[i].task) =
+					m_task_index.tab[i];
+		free(m_task_index.tab);
+		m_task_index.tab = tab;
+		m_task_index.size = size;
+	}
+
+	e = resctrl_alloc_task_entry(m_task_index.tab, m_task_index.size,
+				     task);
+	if (e->task == 0)
+		m_task_index.num++;
+	e->task = task;
+	e->class_id = class_id;
+
+	return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Builds task index with one pass over all COS tasks files
+ *
+ * Task found in more than one file is indexed with the highest COS.
+ *
+ * @param [in] cap platform QoS capabilities structure
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_alloc_task_index_build(const struct pqos_cap *cap)
+{
+	unsigned i, max_cos = 0;
+	int ret;
+
+	ret = resctrl_alloc_get_grps_num(cap, &max_cos);
+	if (ret != PQOS_RETVAL_OK)
+		return ret;
+
+	m_task_index.num = 0;
+	if (m_task_index.tab != NULL)
+		memset(m_task_index.tab, 0,
+		       m_task_index.size * sizeof(m_task_index.tab[0]));
+
+	for (i = 0; i < max_cos; i++) {
+		char *p = resctrl_alloc_task_load(i), *end;
 
-		ret = strtouint64(buf, 10, &tmp);
-		if (ret != PQOS_RETVAL_OK)
-			goto resctrl_alloc_task_read_exit_clean;
-		p = malloc(sizeof(head));
 		if (p == NULL)
-			goto resctrl_alloc_task_read_exit_clean;
-		p->task_id = tmp;
-		p->next = NULL;
-		current->next = p;
-		current = p;
-		idx++;
+			return PQOS_RETVAL_ERROR;
+
+		for (;;) {
+			const unsigned long tid = strtoul(p, &end, 10);
+
+			if (end == p)
+				break;
+			p = end;
+			if (tid == 0)
+				continue;
+			ret = resctrl_alloc_task_index_add((pid_t)tid, i);
+			if (ret != PQOS_RETVAL_OK)
+				return ret;
+		}
 	}
 
+	LOG_DEBUG("Indexed %u tasks in %u COS\n", m_task_index.num, max_cos);
+
+	return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Looks \a task up in the task index
+ *
+ * @param [in] task task ID
+ * @param [out] class_id COS of the task
+ *
+ * @return 1 if found, 0 otherwise
+ */
+static int
+resctrl_alloc_task_index_find(const pid_t task, unsigned *class_id)
+{
+	const struct resctrl_alloc_task_entry *e;
+
+	if (m_task_index.num == 0 || task <= 0)
+		return 0;
+
+	e = resctrl_alloc_task_entry(m_task_index.tab, m_task_index.size,
+				     task);
+	if (e->task == 0)
+		return 0;
+	*class_id = e->class_id;
+	return 1;
+}
+
+void
+resctrl_alloc_task_index_fini(void)
+{
+	free(m_task_index.tab);
+	free(m_task_index.buf);
+	memset(&m_task_index, 0, sizeof(m_task_index));
+}
+
+unsigned *
+resctrl_alloc_task_read(unsigned class_id, unsigned *count)
+{
+	unsigned *tasks = NULL, idx = 0, num = 0;
+	char *buf, *p, *end;
+
+	buf = resctrl_alloc_task_load(class_id);
+	if (buf == NULL)
+		return NULL;
+
+	/* one task ID per line */
+	for (p = buf; *p != '\0'; p++)
+		if (*p == '\n')
+			num++;
+
 	/* if no pids found then allocate empty buffer to be returned */
-	if (idx == 0)
-		tasks = (unsigned *) calloc(1, sizeof(tasks[0]));
-	else
-		tasks = (unsigned *) malloc(idx * sizeof(tasks[0]));
+	tasks = (unsigned *) calloc(num > 0 ? num : 1, sizeof(tasks[0]));
 	if (tasks == NULL)
-		goto resctrl_alloc_task_read_exit_clean;
+		return NULL;
 
-	*count = idx;
-	current = head.next;
-	idx = 0;
-	while (current != NULL) {
-		tasks[idx++] = current->task_id;
-		current = current->next;
+	for (p = buf; idx < num; p = end) {
+		const unsigned long tid = strtoul(p, &end, 10);
+
+		if (end == p)
+			break;
+		tasks[idx++] = (unsigned)tid;
 	}
 
- resctrl_alloc_task_read_exit_clean:
-	resctrl_alloc_fclose(fd);
-	current = head.next;
-	while (current != NULL) {
-		struct linked_list *tmp = current->next;
+	*count = idx;
+	return tasks;
+}
+
+/**
+ * @brief Reads COS of \a task from /proc/<pid>/cpu_resctrl_groups
+ *
+ * The file is only available with CONFIG_PROC_CPU_RESCTRL.
+ *
+ * @param [in] task task ID
+ * @param [out] class_id COS of the task
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_RESOURCE file not available or group unknown
+ */
+static int
+resctrl_alloc_task_proc(const pid_t task, unsigned *class_id)
+{
+	char buf[128];
+	FILE *fd;
+	int ret = PQOS_RETVAL_RESOURCE;
+
+	snprintf(buf, sizeof(buf), "/proc/%d/cpu_resctrl_groups", (int)task);
+	fd = fopen(buf, "r");
+	if (fd == NULL)
+		return PQOS_RETVAL_RESOURCE;
+
+	/* res:/ for default group, res:/COSn otherwise */
+	while (fgets(buf, sizeof(buf), fd) != NULL) {
+		unsigned cos;
+		char c;
 
-		free(current);
-		current = tmp;
+		if (strncmp(buf, "res:", 4) != 0)
+			continue;
+		if (strcmp(buf + 4, "/\n") == 0 || strcmp(buf + 4, "/") == 0) {
+			*class_id = 0;
+			ret = PQOS_RETVAL_OK;
+		} else if (sscanf(buf + 4, "/COS%u%c", &cos, &c) == 2 &&
+			   c == '\n') {
+			*class_id = cos;
+			ret = PQOS_RETVAL_OK;
+		}
+		break;
 	}
-	return tasks;
+	fclose(fd);
+
+	return ret;
 }
 
 int
@@ -834,8 +1310,6 @@ resctrl_alloc_task_search(unsigned *class_id,
                           const struct pqos_cap *cap,
                           const pid_t task)
 {
-	FILE *fd;
-	unsigned i, max_cos = 0;
 	int ret;
 
 	/* Check if task exists */
@@ -843,46 +1317,48 @@ resctrl_alloc_task_search(unsigned *class_id,
 	if (ret != PQOS_RETVAL_OK)
 		return PQOS_RETVAL_PARAM;
 
-	/* Get number of COS */
-	ret = resctrl_alloc_get_grps_num(cap, &max_cos);
-	if (ret != PQOS_RETVAL_OK)
-		return ret;
-
 	/**
-	 * Starting at highest COS - search all COS tasks files for task ID
+	 * Tasks may be moved by other processes at any time,
+	 * answer comes from the kernel or from a fresh index
 	 */
-	for (i = (max_cos - 1); (int)i >= 0; i--) {
-		uint64_t tid = 0;
-		char buf[128];
-
-		/* Open resctrl tasks file */
-		fd = resctrl_alloc_fopen(i, rctl_tasks, "r");
-		if (fd == NULL)
-			return PQOS_RETVAL_ERROR;
-
-		/* Search tasks file for specified task ID */
-		memset(buf, 0, sizeof(buf));
-		while (fgets(buf, sizeof(buf), fd) != NULL) {
-			ret = strtouint64(buf, 10, &tid);
-			if (ret != PQOS_RETVAL_OK)
-				continue;
+	if (resctrl_alloc_task_proc(task, class_id) == PQOS_RETVAL_OK)
+		return PQOS_RETVAL_OK;
 
-			if (task == (pid_t)tid) {
-				*class_id = i;
-				if (resctrl_alloc_fclose(fd) != PQOS_RETVAL_OK)
-					return PQOS_RETVAL_ERROR;
+	ret = resctrl_alloc_task_index_build(cap);
+	if (ret != PQOS_RETVAL_OK)
+		return ret;
+	if (resctrl_alloc_task_index_find(task, class_id))
+		return PQOS_RETVAL_OK;
 
-				return PQOS_RETVAL_OK;
-			}
-		}
-		if (resctrl_alloc_fclose(fd) != PQOS_RETVAL_OK)
-			return PQOS_RETVAL_ERROR;
-	}
 	/* If not found in any COS group - return error */
 	LOG_ERROR("Failed to get association for task %d!\n", (int)task);
 	return PQOS_RETVAL_ERROR;
 }
 
+int
+resctrl_alloc_task_search_many(unsigned *class_ids,
+                               const struct pqos_cap *cap,
+                               const pid_t *tasks,
+                               const unsigned num_tasks)
+{
+	unsigned i;
+	int ret;
+
+	ASSERT(class_ids != NULL);
+	ASSERT(tasks != NULL);
+
+	/* Fresh index, one pass over tasks files serves all lookups */
+	ret = resctrl_alloc_task_index_build(cap);
+	if (ret != PQOS_RETVAL_OK)
+		return ret;
+
+	for (i = 0; i < num_tasks; i++)
+		if (!resctrl_alloc_task_index_find(tasks[i], &class_ids[i]))
+			class_ids[i] = UINT_MAX;
+
+	return PQOS_RETVAL_OK;
+}
+
 int
 resctrl_alloc_task_file_check(const unsigned class_id, unsigned *found)
 {
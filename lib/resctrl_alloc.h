@@ -178,6 +178,9 @@ int resctrl_alloc_schemata_read(const unsigned class_id,
 /**
  * @brief Write resctrl schemata to file
  *
+ * Only entries changed since the file was last read or written
+ * are written.
+ *
  * @param [in] class_id COS id
  * @param [in] schemata Schemata to write
  *
@@ -187,6 +190,13 @@ int resctrl_alloc_schemata_read(const unsigned class_id,
 int resctrl_alloc_schemata_write(const unsigned class_id,
 	                         const struct resctrl_alloc_schemata *schemata);
 
+/**
+ * @brief Closes schemata files kept open by schemata read and write
+ *
+ * Has to be called before resctrl file system is unmounted.
+ */
+void resctrl_alloc_schemata_cache_fini(void);
+
 /**
  * @brief Function to validate if \a task is a valid task ID
  *
@@ -223,6 +233,9 @@ unsigned *resctrl_alloc_task_read(unsigned class_id, unsigned *count);
 /**
  * @brief Function to search a COS tasks file for a task ID
  *
+ * COS is read from /proc/<pid>/cpu_resctrl_groups if the kernel
+ * provides it, otherwise from a task index built from all tasks files.
+ *
  * @param [out] class_id COS containing task ID
  * @param [in] cap platform QoS capabilities structure
  *                 returned by \a pqos_cap_get
@@ -235,6 +248,28 @@ int resctrl_alloc_task_search(unsigned *class_id,
                               const struct pqos_cap *cap,
                               const pid_t task);
 
+/**
+ * @brief Function to search COS tasks files for many task ID's
+ *
+ * @param [out] class_ids COS of each task, UINT_MAX if not found
+ * @param [in] cap platform QoS capabilities structure
+ *                 returned by \a pqos_cap_get
+ * @param [in] tasks task ID's to search for
+ * @param [in] num_tasks number of task ID's
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int resctrl_alloc_task_search_many(unsigned *class_ids,
+                                   const struct pqos_cap *cap,
+                                   const pid_t *tasks,
+                                   const unsigned num_tasks);
+
+/**
+ * @brief Frees task to COS index
+ */
+void resctrl_alloc_task_index_fini(void);
+
 /**
  * @brief Function to search a COS tasks file and check if this file is blank
  *
@@ -0,0 +1,805 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/inotify.h>
+
+#include "log.h"
+#include "types.h"
+#include "resctrl_alloc.h"
+#include "resctrl_mon.h"
+
+/*
+ * Monitoring group file names on resctrl file system
+ */
+static const char *rctl_mon_groups = "mon_groups";
+static const char *rctl_mon_data = "mon_data";
+static const char *rctl_tasks = "tasks";
+static const char *rctl_cpus_list = "cpus_list";
+
+/**
+ * RMID events and their mon_data file names
+ */
+static const struct {
+	enum pqos_mon_event event;
+	const char *name;
+} rctl_events[] = {
+	{ PQOS_MON_EVENT_L3_OCCUP, "llc_occupancy" },
+	{ PQOS_MON_EVENT_LMEM_BW, "mbm_local_bytes" },
+	{ PQOS_MON_EVENT_TMEM_BW, "mbm_total_bytes" },
+};
+
+/**
+ * Monitoring group spanning one directory per parent control group.
+ * Event files of all L3 domains stay open for the lifetime of the group
+ * so that each poll costs one pread() per file.
+ */
+struct resctrl_mon_group {
+	unsigned num_dirs;
+	char **dirs;                            /**< group directories */
+	unsigned *class_ids;                    /**< parent COS of each dir */
+	int watch_fd;                           /**< inotify on task lists,
+						   -1 if not watched */
+	int stale;                              /**< resync on next check */
+	unsigned num_fds[DIM(rctl_events)];
+	int *fds[DIM(rctl_events)];             /**< open event files */
+};
+
+/**
+ * Sequence number making monitoring group names unique in the process
+ */
+static unsigned m_group_seq = 0;
+
+int
+resctrl_mon_is_supported(void)
+{
+	struct stat st;
+	char buf[128];
+
+	snprintf(buf, sizeof(buf), "%s/info/L3_MON", RESCTRL_ALLOC_PATH);
+	if (stat(buf, &st) != 0 || !S_ISDIR(st.st_mode))
+		return 0;
+	snprintf(buf, sizeof(buf), "%s/%s", RESCTRL_ALLOC_PATH,
+		 rctl_mon_groups);
+	if (stat(buf, &st) != 0 || !S_ISDIR(st.st_mode))
+		return 0;
+	return 1;
+}
+
+int
+resctrl_mon_get_events(enum pqos_mon_event *events)
+{
+	char buf[128];
+	FILE *fd;
+
+	ASSERT(events != NULL);
+
+	snprintf(buf, sizeof(buf), "%s/info/L3_MON/mon_features",
+		 RESCTRL_ALLOC_PATH);
+	fd = fopen(buf, "r");
+	if (fd == NULL) {
+		LOG_ERROR("Could not open %s\n", buf);
+		return PQOS_RETVAL_ERROR;
+	}
+
+	*events = 0;
+	while (fgets(buf, sizeof(buf), fd) != NULL) {
+		unsigned i;
+
+		buf[strcspn(buf, "\n")] = '\0';
+		for (i = 0; i < DIM(rctl_events); i++)
+			if (strcmp(buf, rctl_events[i].name) == 0)
+				*events |= rctl_events[i].event;
+	}
+	fclose(fd);
+
+	return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Filters L3 domain directories of mon_data
+ */
+static int
+filter_l3(const struct dirent *dir)
+{
+	return strncmp(dir->d_name, "mon_L3_", 7) == 0;
+}
+
+/**
+ * @brief Opens event files of all L3 domains of \a path
+ *
+ * @param grp monitoring group to store file descriptors in
+ * @param path monitoring group directory
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_mon_open(struct resctrl_mon_group *grp, const char *path)
+{
+	struct dirent **namelist = NULL;
+	int i, num, ret = PQOS_RETVAL_OK;
+	char buf[1024];
+
+	snprintf(buf, sizeof(buf), "%s/%s", path, rctl_mon_data);
+	num = scandir(buf, &namelist, filter_l3, NULL);
+	if (num <= 0) {
+		LOG_ERROR("Failed to read %s\n", buf);
+		return PQOS_RETVAL_ERROR;
+	}
+
+	for (i = 0; i < num && ret == PQOS_RETVAL_OK; i++) {
+		unsigned j;
+
+		for (j = 0; j < DIM(rctl_events); j++) {
+			int *fds, fd;
+
+			snprintf(buf, sizeof(buf), "%s/%s/%s/%s", path,
+				 rctl_mon_data, namelist[i]->d_name,
+				 rctl_events[j].name);
+			/* event not supported by the platform */
+			fd = open(buf, O_RDONLY);
+			if (fd < 0)
+				continue;
+
+			fds = realloc(grp->fds[j], (grp->num_fds[j] + 1) *
+				      sizeof(fds[0]));
+			if (fds == NULL) {
+				close(fd);
+				ret = PQOS_RETVAL_RESOURCE;
+				break;
+			}
+			fds[grp->num_fds[j]++] = fd;
+			grp->fds[j] = fds;
+		}
+	}
+
+	for (i = 0; i < num; i++)
+		free(namelist[i]);
+	free(namelist);
+
+	return ret;
+}
+
+/**
+ * @brief Adds directory of monitoring group under control group \a class_id
+ *
+ * @param grp monitoring group
+ * @param class_id parent control group
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_mon_mkdir(struct resctrl_mon_group *grp, const unsigned class_id)
+{
+	char buf[256], **dirs;
+	unsigned *class_ids;
+	int result;
+
+	if (class_id == 0)
+		result = snprintf(buf, sizeof(buf), "%s/%s/pqos-%d-%u",
+				  RESCTRL_ALLOC_PATH, rctl_mon_groups,
+				  (int)getpid(), m_group_seq++);
+	else
+		result = snprintf(buf, sizeof(buf), "%s/COS%u/%s/pqos-%d-%u",
+				  RESCTRL_ALLOC_PATH, class_id,
+				  rctl_mon_groups, (int)getpid(),
+				  m_group_seq++);
+	if (result < 0 || (size_t)result >= sizeof(buf))
+		return PQOS_RETVAL_ERROR;
+
+	dirs = realloc(grp->dirs, (grp->num_dirs + 1) * sizeof(dirs[0]));
+	if (dirs == NULL)
+		return PQOS_RETVAL_RESOURCE;
+	grp->dirs = dirs;
+	class_ids = realloc(grp->class_ids,
+			    (grp->num_dirs + 1) * sizeof(class_ids[0]));
+	if (class_ids == NULL)
+		return PQOS_RETVAL_RESOURCE;
+	grp->class_ids = class_ids;
+
+	if (mkdir(buf, 0755) != 0) {
+		LOG_ERROR("Failed to create monitoring group %s: %s\n",
+			  buf, strerror(errno));
+		return errno == ENOSPC ? PQOS_RETVAL_RESOURCE :
+			PQOS_RETVAL_ERROR;
+	}
+
+	dirs[grp->num_dirs] = strdup(buf);
+	if (dirs[grp->num_dirs] == NULL) {
+		(void) rmdir(buf);
+		return PQOS_RETVAL_RESOURCE;
+	}
+	class_ids[grp->num_dirs] = class_id;
+	grp->num_dirs++;
+	LOG_DEBUG("Created monitoring group %s\n", buf);
+
+	return resctrl_mon_open(grp, buf);
+}
+
+/**
+ * @brief Writes \a cores to cpus_list file of \a path
+ *
+ * @param path monitoring group directory
+ * @param cores table of core ID's
+ * @param num_cores number of cores in the table
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_mon_cpus_write(const char *path,
+                       const unsigned *cores,
+                       const unsigned num_cores)
+{
+	char buf[512];
+	unsigned i;
+	FILE *fd;
+	int ret = PQOS_RETVAL_OK;
+
+	snprintf(buf, sizeof(buf), "%s/%s", path, rctl_cpus_list);
+	fd = fopen(buf, "w");
+	if (fd == NULL) {
+		LOG_ERROR("Could not open %s\n", buf);
+		return PQOS_RETVAL_ERROR;
+	}
+	for (i = 0; i < num_cores; i++)
+		fprintf(fd, i == 0 ? "%u" : ",%u", cores[i]);
+	fprintf(fd, "\n");
+	if (fclose(fd) != 0) {
+		LOG_ERROR("Failed to assign cores to %s: %s\n",
+			  path, strerror(errno));
+		ret = PQOS_RETVAL_ERROR;
+	}
+	return ret;
+}
+
+int
+resctrl_mon_group_create_cpus(const struct pqos_cap *cap,
+                              const unsigned *cores,
+                              const unsigned num_cores,
+                              struct resctrl_mon_group **grp)
+{
+	struct resctrl_mon_group *g;
+	unsigned *class_ids = NULL, *sel = NULL;
+	unsigned i, grps = 0, class_id;
+	int ret = PQOS_RETVAL_OK;
+
+	ASSERT(cap != NULL);
+	ASSERT(cores != NULL);
+	ASSERT(grp != NULL);
+
+	g = calloc(1, sizeof(*g));
+	class_ids = calloc(num_cores, sizeof(class_ids[0]));
+	sel = malloc(num_cores * sizeof(sel[0]));
+	if (g == NULL || class_ids == NULL || sel == NULL) {
+		ret = PQOS_RETVAL_RESOURCE;
+		goto resctrl_mon_group_create_cpus_exit;
+	}
+	g->watch_fd = -1;
+
+	/**
+	 * Monitoring group cpus have to be a subset of the parent control
+	 * group cpus. Find control group of each core, cores without
+	 * allocation support all belong to the default group.
+	 */
+	if (resctrl_alloc_get_grps_num(cap, &grps) != PQOS_RETVAL_OK)
+		grps = 0;
+	for (class_id = 1; class_id < grps; class_id++) {
+		struct resctrl_alloc_cpumask mask;
+
+		ret = resctrl_alloc_cpumask_read(class_id, &mask);
+		if (ret != PQOS_RETVAL_OK)
+			goto resctrl_mon_group_create_cpus_exit;
+		for (i = 0; i < num_cores; i++)
+			if (resctrl_alloc_cpumask_get(cores[i], &mask))
+				class_ids[i] = class_id;
+	}
+
+	/**
+	 * One directory per control group used by the cores
+	 */
+	for (class_id = 0; class_id < grps || class_id == 0; class_id++) {
+		unsigned num_sel = 0;
+
+		for (i = 0; i < num_cores; i++)
+			if (class_ids[i] == class_id)
+				sel[num_sel++] = cores[i];
+		if (num_sel == 0)
+			continue;
+
+		ret = resctrl_mon_mkdir(g, class_id);
+		if (ret != PQOS_RETVAL_OK)
+			goto resctrl_mon_group_create_cpus_exit;
+		ret = resctrl_mon_cpus_write(g->dirs[g->num_dirs - 1], sel,
+					     num_sel);
+		if (ret != PQOS_RETVAL_OK)
+			goto resctrl_mon_group_create_cpus_exit;
+	}
+
+ resctrl_mon_group_create_cpus_exit:
+	free(class_ids);
+	free(sel);
+	if (ret != PQOS_RETVAL_OK) {
+		if (g != NULL)
+			(void) resctrl_mon_group_remove(g);
+		return ret;
+	}
+	*grp = g;
+	return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Writes \a tasks to tasks file of \a path
+ *
+ * Tasks that exited in the meantime are skipped.
+ *
+ * @param path monitoring group directory
+ * @param tasks table of task ID's
+ * @param num_tasks number of tasks in the table
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_mon_tasks_write(const char *path,
+                        const pid_t *tasks,
+                        const unsigned num_tasks)
+{
+	char buf[512];
+	unsigned i, moved = 0;
+	FILE *fd;
+
+	if (snprintf(buf, sizeof(buf), "%s/%s", path, rctl_tasks) < 0)
+		return PQOS_RETVAL_ERROR;
+
+	/**
+	 * Kernel takes one task ID per write,
+	 * unbuffered stream reports failure of each of them
+	 */
+	fd = fopen(buf, "w");
+	if (fd == NULL) {
+		LOG_ERROR("Could not open %s\n", buf);
+		return PQOS_RETVAL_ERROR;
+	}
+	setvbuf(fd, NULL, _IONBF, 0);
+
+	for (i = 0; i < num_tasks; i++) {
+		if (fprintf(fd, "%d\n", (int)tasks[i]) < 0) {
+			if (errno == ESRCH)
+				continue;
+			LOG_ERROR("Failed to move task %d to %s: %s\n",
+				  (int)tasks[i], path, strerror(errno));
+			fclose(fd);
+			return PQOS_RETVAL_ERROR;
+		}
+		moved++;
+	}
+	fclose(fd);
+
+	LOG_DEBUG("Moved %u tasks to %s\n", moved, path);
+	return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Compares task ID's for qsort() and bsearch()
+ */
+static int
+resctrl_mon_task_cmp(const void *a, const void *b)
+{
+	const pid_t pa = *(const pid_t *)a;
+	const pid_t pb = *(const pid_t *)b;
+
+	return (pa > pb) - (pa < pb);
+}
+
+/**
+ * @brief Reads tasks currently in all directories of \a grp
+ *
+ * Kernel removes a task from the monitoring group when it is moved
+ * to another control group, so the membership is read back rather
+ * than remembered.
+ *
+ * @param grp monitoring group
+ * @param count place to store number of tasks
+ *
+ * @return Allocated and sorted task ID table
+ * @retval NULL on error
+ */
+static pid_t *
+resctrl_mon_tasks_read(const struct resctrl_mon_group *grp, unsigned *count)
+{
+	pid_t *tasks = NULL;
+	unsigned i, num = 0, max = 0;
+	char path[256];
+	int tid;
+
+	for (i = 0; i < grp->num_dirs; i++) {
+		FILE *fd;
+
+		snprintf(path, sizeof(path), "%s/%s", grp->dirs[i],
+			 rctl_tasks);
+		fd = fopen(path, "r");
+		if (fd == NULL) {
+			LOG_ERROR("Failed to read %s: %s\n", path,
+				  strerror(errno));
+			free(tasks);
+			return NULL;
+		}
+		while (fscanf(fd, "%d", &tid) == 1) {
+			if (num == max) {
+				pid_t *t;
+
+				max = max ? max * 2 : 64;
+				t = realloc(tasks, max * sizeof(tasks[0]));
+				if (t == NULL) {
+					free(tasks);
+					fclose(fd);
+					return NULL;
+				}
+				tasks = t;
+			}
+			tasks[num++] = (pid_t)tid;
+		}
+		fclose(fd);
+	}
+
+	if (tasks == NULL)
+		tasks = malloc(sizeof(tasks[0]));
+	else
+		qsort(tasks, num, sizeof(tasks[0]), resctrl_mon_task_cmp);
+	*count = num;
+	return tasks;
+}
+
+/**
+ * @brief Moves tasks of \a tasks not yet in \a grp into it
+ *
+ * Monitoring group has to be a child of the control group
+ * the tasks already belong to, otherwise moving them in would
+ * change their allocation. Tasks not found in any COS go
+ * to the default group. Directory for a control group is created
+ * when the first of its tasks is moved.
+ *
+ * @param cap platform QoS capabilities structure
+ * @param grp monitoring group
+ * @param tasks table of task ID's, sorted in place
+ * @param num_tasks number of tasks in the table
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+static int
+resctrl_mon_tasks_add(const struct pqos_cap *cap,
+                      struct resctrl_mon_group *grp,
+                      pid_t *tasks,
+                      const unsigned num_tasks)
+{
+	unsigned *class_ids = NULL;
+	pid_t *add = NULL, *sel = NULL, *known = NULL;
+	unsigned i, j, num_add = 0, num_known = 0;
+	int ret = PQOS_RETVAL_OK;
+
+	if (num_tasks > 0)
+		qsort(tasks, num_tasks, sizeof(tasks[0]),
+		      resctrl_mon_task_cmp);
+
+	add = malloc((num_tasks + 1) * sizeof(add[0]));
+	if (add == NULL) {
+		ret = PQOS_RETVAL_RESOURCE;
+		goto resctrl_mon_tasks_add_exit;
+	}
+	if (grp->num_dirs > 0) {
+		known = resctrl_mon_tasks_read(grp, &num_known);
+		if (known == NULL) {
+			ret = PQOS_RETVAL_ERROR;
+			goto resctrl_mon_tasks_add_exit;
+		}
+	}
+	for (i = 0; i < num_tasks; i++)
+		if (known == NULL ||
+		    bsearch(&tasks[i], known, num_known,
+			    sizeof(tasks[0]), resctrl_mon_task_cmp) == NULL)
+			add[num_add++] = tasks[i];
+	if (num_add == 0)
+		goto resctrl_mon_tasks_add_exit;
+
+	class_ids = calloc(num_add, sizeof(class_ids[0]));
+	sel = malloc(num_add * sizeof(sel[0]));
+	if (class_ids == NULL || sel == NULL) {
+		ret = PQOS_RETVAL_RESOURCE;
+		goto resctrl_mon_tasks_add_exit;
+	}
+	if (cap == NULL ||
+	    resctrl_alloc_task_search_many(class_ids, cap, add,
+					   num_add) != PQOS_RETVAL_OK)
+		memset(class_ids, 0, num_add * sizeof(class_ids[0]));
+	for (i = 0; i < num_add; i++)
+		if (class_ids[i] == UINT_MAX)
+			class_ids[i] = 0;
+
+	/* one write per control group used by the new tasks */
+	for (i = 0; i < num_add; i++) {
+		unsigned num_sel = 0, dir;
+
+		for (j = 0; j < i; j++)
+			if (class_ids[j] == class_ids[i])
+				break;
+		if (j < i)
+			continue;
+
+		for (j = i; j < num_add; j++)
+			if (class_ids[j] == class_ids[i])
+				sel[num_sel++] = add[j];
+
+		for (dir = 0; dir < grp->num_dirs; dir++)
+			if (grp->class_ids[dir] == class_ids[i])
+				break;
+		if (dir == grp->num_dirs) {
+			ret = resctrl_mon_mkdir(grp, class_ids[i]);
+			if (ret != PQOS_RETVAL_OK)
+				goto resctrl_mon_tasks_add_exit;
+		}
+		ret = resctrl_mon_tasks_write(grp->dirs[dir], sel, num_sel);
+		if (ret != PQOS_RETVAL_OK)
+			goto resctrl_mon_tasks_add_exit;
+	}
+
+ resctrl_mon_tasks_add_exit:
+	free(known);
+	free(class_ids);
+	free(sel);
+	free(add);
+	return ret;
+}
+
+int
+resctrl_mon_group_create_tasks(const struct pqos_cap *cap,
+                               const pid_t *tasks,
+                               const unsigned num_tasks,
+                               struct resctrl_mon_group **grp)
+{
+	struct resctrl_mon_group *g;
+	pid_t *sorted;
+	int ret;
+
+	ASSERT(tasks != NULL || num_tasks == 0);
+	ASSERT(grp != NULL);
+
+	g = calloc(1, sizeof(*g));
+	sorted = malloc((num_tasks + 1) * sizeof(sorted[0]));
+	if (g == NULL || sorted == NULL) {
+		free(g);
+		free(sorted);
+		return PQOS_RETVAL_RESOURCE;
+	}
+	g->watch_fd = -1;
+	if (num_tasks > 0)
+		memcpy(sorted, tasks, num_tasks * sizeof(sorted[0]));
+
+	ret = resctrl_mon_tasks_add(cap, g, sorted, num_tasks);
+	/* empty task list still gets a directory in the default group */
+	if (ret == PQOS_RETVAL_OK && g->num_dirs == 0)
+		ret = resctrl_mon_mkdir(g, 0);
+	free(sorted);
+	if (ret != PQOS_RETVAL_OK) {
+		(void) resctrl_mon_group_remove(g);
+		return ret;
+	}
+	*grp = g;
+	return PQOS_RETVAL_OK;
+}
+
+int
+resctrl_mon_group_update_tasks(const struct pqos_cap *cap,
+                               struct resctrl_mon_group *grp,
+                               pid_t *tasks,
+                               const unsigned num_tasks)
+{
+	ASSERT(grp != NULL);
+	ASSERT(tasks != NULL || num_tasks == 0);
+
+	return resctrl_mon_tasks_add(cap, grp, tasks, num_tasks);
+}
+
+int
+resctrl_mon_group_watch(const struct pqos_cap *cap,
+                        struct resctrl_mon_group *grp,
+                        const char *cgroup)
+{
+	static const char * const cg_files[] = {
+		"cgroup.procs", "cgroup.threads", "tasks"
+	};
+	unsigned i, grps_num = 0, num_watched = 0;
+	char path[PATH_MAX];
+	int ret;
+
+	ASSERT(cap != NULL);
+	ASSERT(grp != NULL);
+	ASSERT(cgroup != NULL);
+
+	grp->watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (grp->watch_fd < 0) {
+		LOG_ERROR("Failed to initialize inotify: %s\n",
+			  strerror(errno));
+		return PQOS_RETVAL_ERROR;
+	}
+
+	/* tasks attached to the cgroup */
+	for (i = 0; i < DIM(cg_files); i++) {
+		snprintf(path, sizeof(path), "%s/%s", cgroup, cg_files[i]);
+		if (inotify_add_watch(grp->watch_fd, path, IN_MODIFY) >= 0)
+			num_watched++;
+	}
+	if (num_watched == 0) {
+		LOG_ERROR("Failed to watch tasks of cgroup %s\n", cgroup);
+		ret = PQOS_RETVAL_ERROR;
+		goto resctrl_mon_group_watch_exit;
+	}
+
+	/* tasks moved to another COS leave the monitoring group */
+	ret = resctrl_alloc_get_grps_num(cap, &grps_num);
+	if (ret != PQOS_RETVAL_OK)
+		goto resctrl_mon_group_watch_exit;
+	for (i = 0; i < grps_num; i++) {
+		if (i == 0)
+			snprintf(path, sizeof(path), "%s/%s",
+				 RESCTRL_ALLOC_PATH, rctl_tasks);
+		else
+			snprintf(path, sizeof(path), "%s/COS%u/%s",
+				 RESCTRL_ALLOC_PATH, i, rctl_tasks);
+		if (inotify_add_watch(grp->watch_fd, path, IN_MODIFY) < 0 &&
+		    errno != ENOENT) {
+			LOG_ERROR("Failed to watch %s: %s\n", path,
+				  strerror(errno));
+			ret = PQOS_RETVAL_ERROR;
+			goto resctrl_mon_group_watch_exit;
+		}
+	}
+
+	/* tasks attached before the watches were added */
+	grp->stale = 1;
+
+ resctrl_mon_group_watch_exit:
+	if (ret != PQOS_RETVAL_OK) {
+		close(grp->watch_fd);
+		grp->watch_fd = -1;
+	}
+	return ret;
+}
+
+int
+resctrl_mon_group_changed(struct resctrl_mon_group *grp)
+{
+	char buf[4096]
+		__attribute__ ((aligned(__alignof__(struct inotify_event))));
+	int changed;
+
+	ASSERT(grp != NULL);
+
+	if (grp->watch_fd < 0)
+		return 1;
+
+	changed = grp->stale;
+	grp->stale = 0;
+	while (read(grp->watch_fd, buf, sizeof(buf)) > 0)
+		changed = 1;
+
+	return changed;
+}
+
+int
+resctrl_mon_group_read(const struct resctrl_mon_group *grp,
+                       const enum pqos_mon_event event,
+                       uint64_t *value)
+{
+	uint64_t total = 0;
+	unsigned i, j;
+
+	ASSERT(grp != NULL);
+	ASSERT(value != NULL);
+
+	for (j = 0; j < DIM(rctl_events); j++)
+		if (rctl_events[j].event == event)
+			break;
+	if (j == DIM(rctl_events))
+		return PQOS_RETVAL_PARAM;
+	if (grp->num_fds[j] == 0)
+		return PQOS_RETVAL_RESOURCE;
+
+	for (i = 0; i < grp->num_fds[j]; i++) {
+		char buf[32], *end;
+		ssize_t len = pread(grp->fds[j][i], buf, sizeof(buf) - 1, 0);
+		uint64_t val;
+
+		if (len < 0) {
+			LOG_ERROR("Failed to read %s: %s\n",
+				  rctl_events[j].name, strerror(errno));
+			return PQOS_RETVAL_ERROR;
+		}
+		buf[len] = '\0';
+		/**
+		 * "Unavailable" is reported while counter isn't ready,
+		 * skipping the domain would look like a counter wrap
+		 */
+		val = strtoull(buf, &end, 10);
+		if (end == buf)
+			return PQOS_RETVAL_BUSY;
+		total += val;
+	}
+
+	*value = total;
+	return PQOS_RETVAL_OK;
+}
+
+int
+resctrl_mon_group_remove(struct resctrl_mon_group *grp)
+{
+	int ret = PQOS_RETVAL_OK;
+	unsigned i, j;
+
+	ASSERT(grp != NULL);
+
+	for (j = 0; j < DIM(rctl_events); j++) {
+		for (i = 0; i < grp->num_fds[j]; i++)
+			close(grp->fds[j][i]);
+		free(grp->fds[j]);
+	}
+
+	for (i = 0; i < grp->num_dirs; i++) {
+		if (rmdir(grp->dirs[i]) != 0) {
+			LOG_ERROR("Failed to remove monitoring group %s: %s\n",
+				  grp->dirs[i], strerror(errno));
+			ret = PQOS_RETVAL_ERROR;
+		}
+		free(grp->dirs[i]);
+	}
+	free(grp->dirs);
+	free(grp->class_ids);
+	if (grp->watch_fd >= 0)
+		close(grp->watch_fd);
+	free(grp);
+
+	return ret;
+}
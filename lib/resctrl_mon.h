@@ -0,0 +1,200 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Internal header file for resctrl monitoring groups
+ */
+
+#ifndef __PQOS_RESCTRL_MON_H__
+#define __PQOS_RESCTRL_MON_H__
+
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Monitoring group on resctrl file system
+ */
+struct resctrl_mon_group;
+
+/**
+ * @brief Checks if resctrl supports monitoring groups
+ *
+ * @return 1 if monitoring groups can be created, 0 otherwise
+ */
+int resctrl_mon_is_supported(void);
+
+/**
+ * @brief Reads RMID events available through resctrl
+ *
+ * @param [out] events place to store mask of supported events
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int resctrl_mon_get_events(enum pqos_mon_event *events);
+
+/**
+ * @brief Creates monitoring group counting tasks running on \a cores
+ *
+ * Cores belonging to different control groups get a directory
+ * in each of them.
+ *
+ * @param [in] cap platform QoS capabilities structure
+ * @param [in] cores table of core ID's
+ * @param [in] num_cores number of cores in the table
+ * @param [out] grp place to store allocated monitoring group
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_RESOURCE if out of RMIDs
+ */
+int resctrl_mon_group_create_cpus(const struct pqos_cap *cap,
+                                  const unsigned *cores,
+                                  const unsigned num_cores,
+                                  struct resctrl_mon_group **grp);
+
+/**
+ * @brief Creates monitoring group and moves \a tasks into it
+ *
+ * Monitoring group has to be a child of the control group tasks
+ * already belong to, otherwise moving them in would change their
+ * allocation. Tasks belonging to different control groups get
+ * a directory in each of them. Tasks that exited in the meantime
+ * are skipped, tasks created later by the moved ones inherit
+ * the monitoring group.
+ *
+ * @param [in] cap platform QoS capabilities structure
+ * @param [in] tasks table of task ID's
+ * @param [in] num_tasks number of tasks in the table
+ * @param [out] grp place to store allocated monitoring group
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_RESOURCE if out of RMIDs
+ */
+int resctrl_mon_group_create_tasks(const struct pqos_cap *cap,
+                                   const pid_t *tasks,
+                                   const unsigned num_tasks,
+                                   struct resctrl_mon_group **grp);
+
+/**
+ * @brief Moves tasks of \a tasks that are not in \a grp into it
+ *
+ * Used to follow tasks attached to a monitored cgroup after the group
+ * was created. \a tasks is the current task list, it is compared with
+ * the tasks files of the group, so tasks the kernel removed from it
+ * on a move to another control group are moved back. Tasks in
+ * a control group not used by the group before get a new directory.
+ *
+ * @param [in] cap platform QoS capabilities structure
+ * @param [in] grp monitoring group
+ * @param [in,out] tasks table of task ID's, sorted on return
+ * @param [in] num_tasks number of tasks in the table
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_RESOURCE if out of RMIDs
+ */
+int resctrl_mon_group_update_tasks(const struct pqos_cap *cap,
+                                   struct resctrl_mon_group *grp,
+                                   pid_t *tasks,
+                                   const unsigned num_tasks);
+
+/**
+ * @brief Starts watching task lists that change membership of \a grp
+ *
+ * Writes to the task lists of \a cgroup attach tasks that should join
+ * the group, writes to the task lists of control groups move tasks
+ * out of it. Threads created by clone() inherit the monitoring group
+ * and need no resync.
+ *
+ * @param [in] cap platform QoS capabilities structure
+ * @param [in] grp monitoring group
+ * @param [in] cgroup cgroup directory followed by the group
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int resctrl_mon_group_watch(const struct pqos_cap *cap,
+                            struct resctrl_mon_group *grp,
+                            const char *cgroup);
+
+/**
+ * @brief Checks whether task lists watched for \a grp were written
+ *        since the last check
+ *
+ * @param [in] grp monitoring group
+ *
+ * @return 1 if tasks of the group need a resync, also if not watched
+ * @retval 0 membership didn't change
+ */
+int resctrl_mon_group_changed(struct resctrl_mon_group *grp);
+
+/**
+ * @brief Reads \a event of monitoring group summed over all L3 domains
+ *
+ * @param [in] grp monitoring group
+ * @param [in] event one of L3 occupancy, local or total MBM events
+ * @param [out] value place to store the value in bytes, left unchanged
+ *             unless the read succeeds
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ * @retval PQOS_RETVAL_BUSY if a domain reports "Unavailable" or "Error",
+ *         the sum would be lower than the real value
+ */
+int resctrl_mon_group_read(const struct resctrl_mon_group *grp,
+                           const enum pqos_mon_event event,
+                           uint64_t *value);
+
+/**
+ * @brief Removes monitoring group and frees \a grp
+ *
+ * Tasks of the group return to the parent group.
+ *
+ * @param [in] grp monitoring group
+ *
+ * @return Operational status
+ * @retval PQOS_RETVAL_OK on success
+ */
+int resctrl_mon_group_remove(struct resctrl_mon_group *grp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQOS_RESCTRL_MON_H__ */
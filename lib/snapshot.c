@@ -0,0 +1,439 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Topology and capability snapshot
+ *
+ * Snapshot file layout:
+ * - struct snapshot_hdr
+ * - struct pqos_cpuinfo including cores table
+ * - for each capability struct snapshot_item followed by
+ *   the capability structure
+ *
+ * File is replaced atomically with rename(), readers never see
+ * a partially written snapshot.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "pqos.h"
+#include "snapshot.h"
+#include "machine.h"
+#include "types.h"
+#include "log.h"
+
+#ifndef SNAPSHOT_FILE
+#ifdef __linux__
+#define SNAPSHOT_FILE "/run/libpqos.snapshot"
+#endif
+#ifdef __FreeBSD__
+#define SNAPSHOT_FILE "/var/run/libpqos.snapshot"
+#endif
+#endif /*!SNAPSHOT_FILE*/
+
+#define SNAPSHOT_MAGIC   0x53535150     /**< "PQSS" */
+#define SNAPSHOT_VERSION 1              /**< snapshot layout version */
+#define SNAPSHOT_MAX_SIZE (1024 * 1024) /**< sanity limit of file size */
+
+/**
+ * Platform identity the snapshot is valid for
+ */
+struct snapshot_key {
+        uint32_t signature;             /**< CPUID.1 EAX */
+        uint32_t microcode;             /**< microcode revision */
+        uint64_t layout;                /**< hash of OS CPU layout */
+};
+
+/**
+ * Snapshot file header
+ */
+struct snapshot_hdr {
+        uint32_t magic;
+        uint32_t version;               /**< SNAPSHOT_VERSION */
+        uint32_t lib_version;           /**< PQOS_VERSION */
+        uint32_t num_cap;               /**< number of capabilities */
+        struct snapshot_key key;
+        uint64_t size;                  /**< byte size of data after
+                                           the header */
+        uint64_t checksum;              /**< hash of data after
+                                           the header */
+};
+
+/**
+ * Capability item header
+ */
+struct snapshot_item {
+        uint32_t type;                  /**< enum pqos_cap_type */
+        uint32_t size;                  /**< byte size of the structure */
+};
+
+/**
+ * @brief FNV-1a hash of \a size bytes of \a data continuing from \a hash
+ */
+static uint64_t
+snapshot_hash(uint64_t hash, const void *data, const size_t size)
+{
+        const unsigned char *p = (const unsigned char *)data;
+        size_t i;
+
+        for (i = 0; i < size; i++) {
+                hash ^= p[i];
+                hash *= 0x100000001b3ULL;
+        }
+        return hash;
+}
+
+/**
+ * @brief Hashes content of \a fname into \a hash
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 file can't be read
+ */
+static int
+snapshot_hash_file(uint64_t *hash, const char *fname)
+{
+        char buf[256];
+        ssize_t len;
+        int fd;
+
+        fd = open(fname, O_RDONLY);
+        if (fd < 0)
+                return -1;
+        len = read(fd, buf, sizeof(buf));
+        close(fd);
+        if (len < 0)
+                return -1;
+        *hash = snapshot_hash(*hash, buf, (size_t)len);
+        return 0;
+}
+
+/**
+ * @brief Builds identity key of the running platform
+ *
+ * @param [out] key place to store the key
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+static int
+snapshot_key_get(struct snapshot_key *key)
+{
+        static const char * const layout_files[] = {
+                "/sys/devices/system/cpu/possible",
+                "/sys/devices/system/cpu/online",
+        };
+        struct cpuid_out res;
+        unsigned i;
+        FILE *fd;
+
+        memset(key, 0, sizeof(*key));
+
+        lcpuid(0x1, 0x0, &res);
+        key->signature = res.eax;
+
+        /* Virtual machines don't report microcode revision */
+        fd = fopen("/sys/devices/system/cpu/cpu0/microcode/version", "r");
+        if (fd != NULL) {
+                unsigned rev = 0;
+
+                if (fscanf(fd, "%x", &rev) == 1)
+                        key->microcode = rev;
+                fclose(fd);
+        }
+
+        key->layout = 0xcbf29ce484222325ULL;
+        for (i = 0; i < DIM(layout_files); i++)
+                if (snapshot_hash_file(&key->layout, layout_files[i]) != 0)
+                        return PQOS_RETVAL_RESOURCE;
+
+        return PQOS_RETVAL_OK;
+}
+
+/**
+ * @brief Gets expected byte size of capability structure at \a data
+ *
+ * @param [in] type capability type
+ * @param [in] data capability structure
+ * @param [in] size bytes available at \a data
+ *
+ * @return Byte size of the structure
+ * @retval 0 if \a type is unknown or structure is malformed
+ */
+static size_t
+snapshot_cap_size(const uint32_t type, const void *data, const size_t size)
+{
+        size_t sz;
+
+        switch (type) {
+        case PQOS_CAP_TYPE_MON:
+                if (size < sizeof(struct pqos_cap_mon))
+                        return 0;
+                sz = sizeof(struct pqos_cap_mon) +
+                        ((const struct pqos_cap_mon *)data)->num_events *
+                        sizeof(struct pqos_monitor);
+                break;
+        case PQOS_CAP_TYPE_L3CA:
+                sz = sizeof(struct pqos_cap_l3ca);
+                break;
+        case PQOS_CAP_TYPE_L2CA:
+                sz = sizeof(struct pqos_cap_l2ca);
+                break;
+        case PQOS_CAP_TYPE_MBA:
+                sz = sizeof(struct pqos_cap_mba);
+                break;
+        default:
+                return 0;
+        }
+        if (sz > size || *(const unsigned *)data != sz)
+                return 0;
+        return sz;
+}
+
+/**
+ * @brief Frees capabilities structure \a cap
+ */
+static void
+snapshot_cap_free(struct pqos_cap *cap)
+{
+        unsigned i;
+
+        if (cap == NULL)
+                return;
+        for (i = 0; i < cap->num_cap; i++)
+                free(cap->capabilities[i].u.generic_ptr);
+        free(cap);
+}
+
+int
+snapshot_load(struct pqos_cpuinfo **cpu, struct pqos_cap **cap)
+{
+        struct snapshot_hdr hdr;
+        struct snapshot_key key;
+        struct pqos_cpuinfo *l_cpu = NULL;
+        struct pqos_cap *l_cap = NULL;
+        unsigned char *data = NULL;
+        size_t off, sz;
+        unsigned i;
+        int fd, ret = PQOS_RETVAL_RESOURCE;
+
+        ASSERT(cpu != NULL);
+        ASSERT(cap != NULL);
+
+        fd = open(SNAPSHOT_FILE, O_RDONLY);
+        if (fd < 0)
+                return PQOS_RETVAL_RESOURCE;
+
+        if (read(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+            hdr.magic != SNAPSHOT_MAGIC ||
+            hdr.version != SNAPSHOT_VERSION ||
+            hdr.lib_version != PQOS_VERSION ||
+            hdr.size > SNAPSHOT_MAX_SIZE ||
+            hdr.size < sizeof(struct pqos_cpuinfo)) {
+                LOG_DEBUG("Snapshot %s not compatible\n", SNAPSHOT_FILE);
+                goto snapshot_load_exit;
+        }
+
+        if (snapshot_key_get(&key) != PQOS_RETVAL_OK ||
+            memcmp(&key, &hdr.key, sizeof(key)) != 0) {
+                LOG_INFO("Snapshot %s taken on different platform\n",
+                         SNAPSHOT_FILE);
+                goto snapshot_load_exit;
+        }
+
+        data = malloc(hdr.size);
+        if (data == NULL ||
+            read(fd, data, hdr.size) != (ssize_t)hdr.size ||
+            snapshot_hash(0xcbf29ce484222325ULL, data, hdr.size) !=
+            hdr.checksum) {
+                LOG_WARN("Snapshot %s corrupted\n", SNAPSHOT_FILE);
+                goto snapshot_load_exit;
+        }
+
+        /**
+         * CPU topology
+         */
+        sz = ((struct pqos_cpuinfo *)data)->mem_size;
+        if (sz > hdr.size || sz < sizeof(struct pqos_cpuinfo) +
+            ((struct pqos_cpuinfo *)data)->num_cores *
+            sizeof(struct pqos_coreinfo))
+                goto snapshot_load_exit;
+        l_cpu = malloc(sz);
+        if (l_cpu == NULL)
+                goto snapshot_load_exit;
+        memcpy(l_cpu, data, sz);
+        off = sz;
+
+        /**
+         * Capabilities
+         */
+        sz = sizeof(*l_cap) + hdr.num_cap * sizeof(l_cap->capabilities[0]);
+        l_cap = calloc(1, sz);
+        if (l_cap == NULL)
+                goto snapshot_load_exit;
+        l_cap->mem_size = sz;
+        l_cap->version = PQOS_VERSION;
+
+        for (i = 0; i < hdr.num_cap; i++) {
+                struct pqos_capability *item = &l_cap->capabilities[i];
+                struct snapshot_item it;
+
+                if (hdr.size - off < sizeof(it))
+                        goto snapshot_load_exit;
+                memcpy(&it, data + off, sizeof(it));
+                off += sizeof(it);
+
+                sz = snapshot_cap_size(it.type, data + off, hdr.size - off);
+                if (sz == 0 || sz != it.size)
+                        goto snapshot_load_exit;
+
+                item->type = (enum pqos_cap_type)it.type;
+                item->u.generic_ptr = malloc(sz);
+                if (item->u.generic_ptr == NULL)
+                        goto snapshot_load_exit;
+                memcpy(item->u.generic_ptr, data + off, sz);
+                l_cap->num_cap++;
+                off += sz;
+        }
+        if (off != hdr.size || l_cap->num_cap == 0)
+                goto snapshot_load_exit;
+
+        LOG_INFO("Topology and capabilities loaded from %s\n", SNAPSHOT_FILE);
+        *cpu = l_cpu;
+        *cap = l_cap;
+        ret = PQOS_RETVAL_OK;
+
+ snapshot_load_exit:
+        if (ret != PQOS_RETVAL_OK) {
+                free(l_cpu);
+                snapshot_cap_free(l_cap);
+        }
+        free(data);
+        close(fd);
+        return ret;
+}
+
+int
+snapshot_save(const struct pqos_cpuinfo *cpu, const struct pqos_cap *cap)
+{
+        struct snapshot_hdr hdr;
+        unsigned char *data;
+        size_t off = 0, sz;
+        char tmp[] = SNAPSHOT_FILE ".XXXXXX";
+        unsigned i;
+        int fd, ret = PQOS_RETVAL_OK;
+
+        ASSERT(cpu != NULL);
+        ASSERT(cap != NULL);
+
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.magic = SNAPSHOT_MAGIC;
+        hdr.version = SNAPSHOT_VERSION;
+        hdr.lib_version = PQOS_VERSION;
+        hdr.num_cap = cap->num_cap;
+        if (snapshot_key_get(&hdr.key) != PQOS_RETVAL_OK)
+                return PQOS_RETVAL_RESOURCE;
+
+        sz = cpu->mem_size;
+        for (i = 0; i < cap->num_cap; i++)
+                sz += sizeof(struct snapshot_item) +
+                        *(const unsigned *)cap->capabilities[i].u.generic_ptr;
+
+        data = malloc(sz);
+        if (data == NULL)
+                return PQOS_RETVAL_RESOURCE;
+
+        memcpy(data, cpu, cpu->mem_size);
+        off = cpu->mem_size;
+        for (i = 0; i < cap->num_cap; i++) {
+                const struct pqos_capability *item = &cap->capabilities[i];
+                struct snapshot_item it;
+
+                it.type = (uint32_t)item->type;
+                it.size = *(const unsigned *)item->u.generic_ptr;
+                memcpy(data + off, &it, sizeof(it));
+                off += sizeof(it);
+                memcpy(data + off, item->u.generic_ptr, it.size);
+
+                /**
+                 * CDP state may change until next load, store classes
+                 * as with CDP off
+                 */
+                if (item->type == PQOS_CAP_TYPE_L3CA) {
+                        struct pqos_cap_l3ca *l3ca =
+                                (struct pqos_cap_l3ca *)(data + off);
+
+                        if (l3ca->cdp_on)
+                                l3ca->num_classes *= 2;
+                        l3ca->cdp_on = 0;
+                }
+                off += it.size;
+        }
+        hdr.size = sz;
+        hdr.checksum = snapshot_hash(0xcbf29ce484222325ULL, data, sz);
+
+        fd = mkstemp(tmp);
+        if (fd < 0) {
+                LOG_DEBUG("Can't create snapshot %s: %s\n", tmp,
+                          strerror(errno));
+                free(data);
+                return PQOS_RETVAL_ERROR;
+        }
+        if (fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) != 0 ||
+            write(fd, &hdr, sizeof(hdr)) != (ssize_t)sizeof(hdr) ||
+            write(fd, data, sz) != (ssize_t)sz) {
+                LOG_WARN("Failed to write snapshot %s\n", tmp);
+                ret = PQOS_RETVAL_ERROR;
+        }
+        if (close(fd) != 0)
+                ret = PQOS_RETVAL_ERROR;
+        if (ret == PQOS_RETVAL_OK && rename(tmp, SNAPSHOT_FILE) != 0) {
+                LOG_WARN("Failed to replace snapshot %s\n", SNAPSHOT_FILE);
+                ret = PQOS_RETVAL_ERROR;
+        }
+        if (ret != PQOS_RETVAL_OK)
+                (void) unlink(tmp);
+        else
+                LOG_INFO("Topology and capabilities saved to %s\n",
+                         SNAPSHOT_FILE);
+
+        free(data);
+        return ret;
+}
@@ -0,0 +1,83 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Internal header file of topology and capability snapshot
+ *
+ * Snapshot saves CPU topology and hardware capabilities discovered by
+ * the library so that subsequent initializations on the same platform
+ * can skip the discovery.
+ */
+
+#ifndef __PQOS_SNAPSHOT_H__
+#define __PQOS_SNAPSHOT_H__
+
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Loads snapshot taken on this platform
+ *
+ * Snapshot is only accepted if CPU signature, microcode revision and
+ * CPU layout reported by the OS match the ones it was taken with.
+ *
+ * @param [out] cpu place to store allocated CPU topology
+ * @param [out] cap place to store allocated capabilities, hardware
+ *              part only, os_support flags are not set
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ * @retval PQOS_RETVAL_RESOURCE no valid snapshot
+ */
+int snapshot_load(struct pqos_cpuinfo **cpu, struct pqos_cap **cap);
+
+/**
+ * @brief Saves snapshot of \a cpu and \a cap
+ *
+ * @param [in] cpu CPU topology
+ * @param [in] cap capabilities, hardware part only
+ *
+ * @return Operation status
+ * @retval PQOS_RETVAL_OK success
+ */
+int snapshot_save(const struct pqos_cpuinfo *cpu, const struct pqos_cap *cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQOS_SNAPSHOT_H__ */
@@ -0,0 +1,290 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - cgroup statistics sampler
+ *
+ * All files are opened once and re-read from offset 0 with pread() into
+ * preallocated buffers, so one sample costs one system call per file.
+ * Values are parsed in place without sscanf().
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+
+#include "cgstat.h"
+
+#define CGSTAT_BUF_SIZE 4096
+
+/**
+ * Files sampled by cgstat_read()
+ */
+enum cgstat_file {
+        CGSTAT_PROC_STAT = 0,
+        CGSTAT_CPUACCT_STAT,
+        CGSTAT_MEM_USAGE,
+        CGSTAT_MEM_STAT,
+        CGSTAT_TASKS,
+        CGSTAT_NUM_FILES
+};
+
+struct cgstat {
+        int fd[CGSTAT_NUM_FILES];       /**< open file descriptors */
+        char buf[CGSTAT_BUF_SIZE];      /**< read buffer */
+};
+
+/**
+ * @brief Re-reads file \a file of \a cs into its buffer
+ *
+ * Only the first CGSTAT_BUF_SIZE - 1 bytes are read, enough for the
+ * first line of /proc/stat and the whole of the cgroup files.
+ *
+ * @return Number of bytes read, the buffer is NUL terminated
+ * @retval -1 error
+ */
+static ssize_t
+read_file(struct cgstat *cs, const enum cgstat_file file)
+{
+        ssize_t len = pread(cs->fd[file], cs->buf, sizeof(cs->buf) - 1, 0);
+
+        if (len < 0)
+                return -1;
+        cs->buf[len] = '\0';
+        return len;
+}
+
+/**
+ * @brief Parses decimal number at \a p skipping leading blanks
+ *
+ * @param [in] p text to parse
+ * @param [out] val parsed value
+ *
+ * @return Pointer past the number
+ * @retval NULL no number at \a p
+ */
+static const char *
+parse_u64(const char *p, uint64_t *val)
+{
+        uint64_t v = 0;
+
+        while (*p == ' ' || *p == '\t')
+                p++;
+        if (*p < '0' || *p > '9')
+                return NULL;
+        while (*p >= '0' && *p <= '9')
+                v = v * 10 + (uint64_t)(*p++ - '0');
+        *val = v;
+        return p;
+}
+
+/**
+ * @brief Finds value of \a key in "key value" lines of \a buf
+ *
+ * @param [in] buf NUL terminated text
+ * @param [in] key key to find
+ * @param [out] val parsed value
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 key not found
+ */
+static int
+find_u64(const char *buf, const char *key, uint64_t *val)
+{
+        const size_t len = strlen(key);
+        const char *p = buf;
+
+        while (*p != '\0') {
+                if (strncmp(p, key, len) == 0 && p[len] == ' ')
+                        return parse_u64(p + len, val) != NULL ? 0 : -1;
+                p = strchr(p, '\n');
+                if (p == NULL)
+                        break;
+                p++;
+        }
+        return -1;
+}
+
+/**
+ * @brief Counts lines of tasks file, it may not fit into the buffer
+ */
+static int
+count_tasks(struct cgstat *cs, unsigned *tasks)
+{
+        off_t off = 0;
+        unsigned count = 0;
+        ssize_t len, i;
+
+        while ((len = pread(cs->fd[CGSTAT_TASKS], cs->buf,
+                            sizeof(cs->buf), off)) > 0) {
+                for (i = 0; i < len; i++)
+                        if (cs->buf[i] == '\n')
+                                count++;
+                off += len;
+        }
+        if (len < 0)
+                return -1;
+        *tasks = count;
+        return 0;
+}
+
+/**
+ * @brief Sums time of all cpus from the first line of /proc/stat
+ *
+ * Fields are user, nice, system, idle, iowait, irq, softirq and steal.
+ * Guest time is already included in user and nice.
+ */
+static int
+parse_proc_stat(const char *buf, uint64_t *total)
+{
+        const char *p = buf;
+        uint64_t sum = 0;
+        int i;
+
+        if (strncmp(p, "cpu ", 4) != 0)
+                return -1;
+        p += 4;
+        for (i = 0; i < 8; i++) {
+                uint64_t v;
+
+                p = parse_u64(p, &v);
+                if (p == NULL)
+                        break;
+                sum += v;
+        }
+        /* old kernels report fewer fields */
+        if (i < 4)
+                return -1;
+        *total = sum;
+        return 0;
+}
+
+struct cgstat *
+cgstat_open(const char *cpuacct_dir, const char *memory_dir)
+{
+        static const struct {
+                int memory;
+                const char *name;
+        } files[CGSTAT_NUM_FILES] = {
+                [CGSTAT_PROC_STAT] = {0, NULL},
+                [CGSTAT_CPUACCT_STAT] = {0, "cpuacct.stat"},
+                [CGSTAT_MEM_USAGE] = {1, "memory.usage_in_bytes"},
+                [CGSTAT_MEM_STAT] = {1, "memory.stat"},
+                [CGSTAT_TASKS] = {0, "tasks"},
+        };
+        struct cgstat *cs;
+        int i;
+
+        if (cpuacct_dir == NULL || memory_dir == NULL)
+                return NULL;
+
+        cs = malloc(sizeof(*cs));
+        if (cs == NULL)
+                return NULL;
+
+        for (i = 0; i < CGSTAT_NUM_FILES; i++)
+                cs->fd[i] = -1;
+        for (i = 0; i < CGSTAT_NUM_FILES; i++) {
+                char path[PATH_MAX];
+
+                if (files[i].name == NULL)
+                        snprintf(path, sizeof(path), "/proc/stat");
+                else
+                        snprintf(path, sizeof(path), "%s/%s",
+                                 files[i].memory ? memory_dir : cpuacct_dir,
+                                 files[i].name);
+                cs->fd[i] = open(path, O_RDONLY | O_CLOEXEC);
+                if (cs->fd[i] == -1) {
+                        printf("Error : failed to open %s: %s\n",
+                               path, strerror(errno));
+                        cgstat_close(cs);
+                        return NULL;
+                }
+        }
+        return cs;
+}
+
+int
+cgstat_read(struct cgstat *cs, struct cgstat_values *v)
+{
+        uint64_t user, sys, rss, mapped;
+
+        if (cs == NULL || v == NULL)
+                return -1;
+
+        if (read_file(cs, CGSTAT_PROC_STAT) <= 0 ||
+            parse_proc_stat(cs->buf, &v->cpu_total) != 0)
+                goto cgstat_read__error;
+
+        if (read_file(cs, CGSTAT_CPUACCT_STAT) <= 0 ||
+            find_u64(cs->buf, "user", &user) != 0 ||
+            find_u64(cs->buf, "system", &sys) != 0)
+                goto cgstat_read__error;
+        v->cpu_cgroup = user + sys;
+
+        if (read_file(cs, CGSTAT_MEM_USAGE) <= 0 ||
+            parse_u64(cs->buf, &v->mem_usage) == NULL)
+                goto cgstat_read__error;
+
+        /* hierarchical totals include sub-groups of the cgroup */
+        if (read_file(cs, CGSTAT_MEM_STAT) <= 0 ||
+            find_u64(cs->buf, "total_rss", &rss) != 0 ||
+            find_u64(cs->buf, "total_mapped_file", &mapped) != 0)
+                goto cgstat_read__error;
+        v->mem_rss = rss + mapped;
+
+        if (count_tasks(cs, &v->tasks) != 0)
+                goto cgstat_read__error;
+        return 0;
+
+ cgstat_read__error:
+        printf("Error : failed to sample cgroup statistics\n");
+        return -1;
+}
+
+void
+cgstat_close(struct cgstat *cs)
+{
+        int i;
+
+        if (cs == NULL)
+                return;
+        for (i = 0; i < CGSTAT_NUM_FILES; i++)
+                if (cs->fd[i] != -1)
+                        close(cs->fd[i]);
+        free(cs);
+}
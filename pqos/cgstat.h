@@ -0,0 +1,101 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - cgroup statistics sampler
+ *
+ * Samples system and cgroup cpu time, cgroup memory usage and thread
+ * count from descriptors kept open across samples.
+ */
+
+#ifndef __CGSTAT_H__
+#define __CGSTAT_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * One sample of cgroup statistics
+ */
+struct cgstat_values {
+        uint64_t cpu_total;             /**< time of all cpus [ticks] */
+        uint64_t cpu_cgroup;            /**< user + system time of
+                                             cgroup tasks [ticks] */
+        uint64_t mem_usage;             /**< memory.usage_in_bytes */
+        uint64_t mem_rss;               /**< resident memory of cgroup tasks,
+                                             total_rss + total_mapped_file
+                                             [bytes] */
+        unsigned tasks;                 /**< number of threads */
+};
+
+struct cgstat;
+
+/**
+ * @brief Opens statistics files of a cgroup
+ *
+ * @param [in] cpuacct_dir cpuacct cgroup directory, its tasks file is
+ *             used for the thread count
+ * @param [in] memory_dir memory cgroup directory
+ *
+ * @return Pointer to the sampler
+ * @retval NULL error
+ */
+struct cgstat *cgstat_open(const char *cpuacct_dir, const char *memory_dir);
+
+/**
+ * @brief Takes one sample, re-reading each open file with pread()
+ *
+ * @param [in] cs sampler
+ * @param [out] v sampled values
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int cgstat_read(struct cgstat *cs, struct cgstat_values *v);
+
+/**
+ * @brief Closes files opened by cgstat_open()
+ *
+ * @param [in] cs sampler, may be NULL
+ */
+void cgstat_close(struct cgstat *cs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CGSTAT_H__ */
@@ -0,0 +1,583 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - isolation controller module
+ *
+ * Online groups are planned in priority order, each gets the cores
+ * (placed by the placement module) and exclusive L3 ways its quota asks
+ * for as long as one core cluster and one way are left for best-effort
+ * groups. Best-effort groups share one COS,
+ * the remaining cores and the lowest L3 ways. CAT masks have to be
+ * contiguous so online groups do not overlap the shared ways.
+ * Online groups get COS 1..N in configuration order.
+ *
+ * Quotas come from the IPS model when thread counts change. Online groups
+ * with a perf_event cgroup are also measured every FEEDBACK_INTERVAL_MS
+ * and the feedback module scales their cores, ways and MBA so measured
+ * IPS meets the target even where the model is wrong. Groups that
+ * retrain also feed those measurements to the retrain module and switch
+ * to its refit model, replanning, whenever one is ready.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "gbrt.h"
+#include "quota.h"
+#include "isolation.h"
+#include "taskwatch.h"
+#include "placement.h"
+#include "perfgroup.h"
+#include "feedback.h"
+#include "retrain.h"
+#include "controller.h"
+
+/**
+ * Runtime state of a configured group
+ */
+struct ctl_group {
+        const struct tenant_group *cfg; /**< group configuration */
+        struct gbrt_model *model;       /**< IPS model, online only */
+        int watch;                      /**< taskwatch id, online only */
+        int tasks;                      /**< watched thread count */
+        int applied;                    /**< thread count of current quota */
+        int trigger;                    /**< new quota pending */
+        struct quota q;                 /**< current quota, online only */
+        struct perfgroup *pg;           /**< IPS counters, feedback only */
+        struct perfgroup_values pv;     /**< last counter values */
+        uint64_t pv_ms;                 /**< time of last counter read */
+        struct feedback fb;             /**< quota scale from measured IPS */
+        struct quota used;              /**< resources actually planned */
+        struct retrain *rt;             /**< model refit, retraining only */
+        unsigned *cores;                /**< storage of planned cores */
+        struct isolation_group iso;     /**< planned resources */
+};
+
+static struct ctl_group m_groups[TENANT_MAX_GROUPS];
+static unsigned m_num_groups = 0;
+
+/**
+ * Core storage of all groups, num_groups x num_cores
+ */
+static unsigned *m_cores = NULL;
+
+/**
+ * @brief Returns monotonic time in milliseconds
+ */
+static uint64_t
+now_ms(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+/**
+ * @brief Reads total memory of the node in bytes
+ *
+ * @return Memory size, 0 if unknown
+ */
+static uint64_t
+mem_total(void)
+{
+        unsigned long long kb = 0;
+        char line[128];
+        FILE *fp;
+
+        fp = fopen("/proc/meminfo", "r");
+        if (fp == NULL)
+                return 0;
+        while (fgets(line, sizeof(line), fp) != NULL)
+                if (sscanf(line, "MemTotal: %llu kB", &kb) == 1)
+                        break;
+        fclose(fp);
+        return (uint64_t)kb * 1024;
+}
+
+/**
+ * @brief Compares online groups by priority, configuration order on ties
+ */
+static int
+cmp_priority(const void *a, const void *b)
+{
+        const struct ctl_group *x = *(const struct ctl_group * const *)a;
+        const struct ctl_group *y = *(const struct ctl_group * const *)b;
+
+        if (x->cfg->priority != y->cfg->priority)
+                return (y->cfg->priority > x->cfg->priority) ? 1 : -1;
+        return (x > y) - (x < y);
+}
+
+/**
+ * @brief Splits node resources between groups according to current quotas
+ */
+static void
+plan(const struct pqos_cpuinfo *cpu, const struct pqos_capability *cap_l3ca,
+     const uint64_t mem)
+{
+        struct ctl_group *order[TENANT_MAX_GROUPS];
+        const unsigned way_kb = cpu->l3.way_size >= 1024 ?
+                cpu->l3.way_size / 1024 : 1024;
+        unsigned num_online = 0, num_be = 0, i;
+        unsigned top = 0, mba_online = 0;
+        uint64_t mem_online = 0, shared;
+
+        for (i = 0; i < m_num_groups; i++)
+                if (m_groups[i].cfg->type == TENANT_ONLINE)
+                        order[num_online++] = &m_groups[i];
+                else
+                        num_be++;
+        qsort(order, num_online, sizeof(order[0]), cmp_priority);
+
+        if (cap_l3ca != NULL)
+                top = cap_l3ca->u.l3ca->num_ways;
+
+        placement_begin();
+
+        for (i = 0; i < num_online; i++) {
+                struct ctl_group *g = order[i];
+                const unsigned reserve = num_be ? 1 : 0;
+                /* model quota corrected by measured IPS */
+                const double cpu_q = g->q.cpu * g->fb.scale;
+                const double llc_q = g->q.llc * g->fb.scale;
+                double mba_q = g->q.mba * g->fb.scale;
+                unsigned need, left, ways;
+
+                if (mba_q > 100)
+                        mba_q = 100;
+                need = (unsigned)cpu_q;
+                if (cpu_q > need || need == 0)
+                        need++;
+                g->iso.num_cores = placement_take((int)(g - m_groups), need,
+                                                  reserve, g->cores);
+                if (g->iso.num_cores < need)
+                        printf("Warning : Group %s gets %u of %u cores\n",
+                               g->cfg->name, g->iso.num_cores, need);
+
+                /* exclusive ways, taken from the top */
+                ways = (unsigned)(llc_q / way_kb);
+                if (llc_q > ways * way_kb || ways == 0)
+                        ways++;
+                left = (top > reserve) ? top - reserve : 0;
+                if (ways > left)
+                        ways = left;
+                g->iso.l3_mask = ways ? (((1ULL << ways) - 1) <<
+                                         (top - ways)) : 0;
+                top -= ways;
+
+                /* bandwidth limit, rounded up to a whole percent */
+                g->iso.mba = (unsigned)mba_q;
+                if (mba_q > g->iso.mba || g->iso.mba == 0)
+                        g->iso.mba++;
+
+                g->used = g->q;
+                g->used.cpu = g->iso.num_cores;
+                g->used.llc = ways * way_kb;
+                g->used.mba = g->iso.mba;
+
+                g->iso.mem_limit = 0;
+                mba_online += g->iso.mba;
+                mem_online += (uint64_t)g->q.mem * 1024;
+        }
+
+        shared = top ? ((1ULL << top) - 1) : 0;
+        for (i = 0; i < m_num_groups; i++) {
+                struct ctl_group *g = &m_groups[i];
+
+                if (g->cfg->type == TENANT_ONLINE)
+                        continue;
+                /* best-effort groups share what is left */
+                g->iso.num_cores = placement_rest(g->cores);
+                g->iso.l3_mask = shared;
+                /* isolation_submit() raises it to the minimum rate */
+                g->iso.mba = mba_online < 100 ? 100 - mba_online : 1;
+                g->iso.mem_limit = (mem > mem_online) ? mem - mem_online : 0;
+        }
+}
+
+/**
+ * @brief Plans and applies resources of all groups
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+apply(const struct pqos_cpuinfo *cpu, const struct pqos_capability *cap_l3ca,
+      const struct pqos_capability *cap_mba, const uint64_t mem)
+{
+        struct isolation_group iso[TENANT_MAX_GROUPS];
+        unsigned i, n = 0;
+
+        plan(cpu, cap_l3ca, mem);
+
+        for (i = 0; i < m_num_groups; i++) {
+                const struct ctl_group *g = &m_groups[i];
+
+                if (g->iso.num_cores == 0) {
+                        printf("Warning : Group %s has no cores left, "
+                               "keeping its old quota\n", g->cfg->name);
+                        continue;
+                }
+                iso[n++] = g->iso;
+        }
+        if (n == 0)
+                return -1;
+        return isolation_submit(iso, n, cpu, cap_l3ca, cap_mba, NULL);
+}
+
+/**
+ * @brief Decides whether thread count of \a g moved enough from the one
+ *        its quota was planned for
+ */
+static void
+update_trigger(struct ctl_group *g)
+{
+        g->trigger = abs(g->tasks - g->applied) > CONTROLLER_TASKS_DELTA &&
+                g->tasks + g->cfg->tasks_offset > CONTROLLER_MIN_TASKS;
+}
+
+/**
+ * @brief Searches new quota of online group \a g for its thread count
+ */
+static void
+replan_group(struct ctl_group *g, const int tasks)
+{
+        struct quota q;
+
+        if (quota_search(g->model, &g->cfg->grid, g->cfg->slo_ips, tasks,
+                         &q) != 0) {
+                printf("Error : Quota search of %s failed, keeping old "
+                       "quota!\n", g->cfg->name);
+                return;
+        }
+        printf("Info : Group %s quota cpu=%.1f mem=%.0f llc=%.0f mba=%.0f\n",
+               g->cfg->name, q.cpu, q.mem, q.llc, q.mba);
+        g->q = q;
+}
+
+/**
+ * @brief Measures IPS of online groups with feedback and updates their
+ *        quota scale
+ *
+ * @param [in] now current time in ms
+ *
+ * @return 1 if any scale changed, 0 otherwise
+ */
+static int
+feedback_step(const uint64_t now)
+{
+        unsigned i;
+        int changed = 0;
+
+        for (i = 0; i < m_num_groups; i++) {
+                struct ctl_group *g = &m_groups[i];
+                float row[QUOTA_NUM_FEATURES];
+                double ips, load = -1;
+
+                if (g->pg == NULL || now <= g->pv_ms ||
+                    perfgroup_read(g->pg, &g->pv) != 0)
+                        continue;
+                /* same unit as the model, million instructions per second */
+                ips = (double)g->pv.delta[PERFGROUP_INSTRUCTIONS] /
+                        (double)(now - g->pv_ms) / 1000.0;
+                /* busy fraction of the cores the group was given */
+                if ((g->pv.available & (1U << PERFGROUP_TASK_CLOCK)) &&
+                    g->iso.num_cores > 0)
+                        load = (double)g->pv.delta[PERFGROUP_TASK_CLOCK] /
+                                ((double)(now - g->pv_ms) * 1000000.0 *
+                                 g->iso.num_cores);
+                g->pv_ms = now;
+                /* skip periods mixing two quotas or below saturation */
+                if (g->rt != NULL && !g->fb.hold &&
+                    load >= RETRAIN_MIN_LOAD) {
+                        quota_features(&g->used,
+                                       g->tasks + g->cfg->tasks_offset, row);
+                        retrain_add(g->rt, row, ips);
+                }
+                if (!feedback_update(&g->fb, g->q.ips, ips, load))
+                        continue;
+                printf("Info : Group %s IPS %.0f target %.0f load %.2f, "
+                       "quota scale %.2f\n",
+                       g->cfg->name, ips, g->q.ips, load, g->fb.scale);
+                changed = 1;
+        }
+        return changed;
+}
+
+/**
+ * @brief Switches online groups to refit models that are ready and
+ *        replans them
+ *
+ * @return 1 if any group was replanned, 0 otherwise
+ */
+static int
+retrain_step(void)
+{
+        unsigned i;
+        int changed = 0;
+
+        for (i = 0; i < m_num_groups; i++) {
+                struct ctl_group *g = &m_groups[i];
+                struct retrain_fit fit;
+                struct gbrt_model *model = retrain_poll(g->rt, &fit);
+
+                if (model == NULL)
+                        continue;
+                printf("Info : Group %s model refit on %u samples, "
+                       "IPS error %.0f -> %.0f\n", g->cfg->name,
+                       fit.num_samples, fit.rmse_base, fit.rmse);
+                gbrt_free(g->model);
+                g->model = model;
+                /* a pending adjustment uses the new model once settled */
+                if (g->trigger)
+                        continue;
+                replan_group(g, g->applied + g->cfg->tasks_offset);
+                /* the refit model already accounts for what feedback saw */
+                feedback_reset(&g->fb);
+                g->fb.hold = 1;
+                changed = 1;
+        }
+        return changed;
+}
+
+/**
+ * @brief Frees controller state
+ */
+static void
+controller_fini(void)
+{
+        unsigned i;
+
+        taskwatch_fini();
+        for (i = 0; i < m_num_groups; i++) {
+                gbrt_free(m_groups[i].model);
+                retrain_stop(m_groups[i].rt);
+                perfgroup_close(m_groups[i].pg);
+        }
+        memset(m_groups, 0, sizeof(m_groups));
+        m_num_groups = 0;
+        free(m_cores);
+        m_cores = NULL;
+        quota_fini();
+        placement_fini();
+        isolation_cleanup();
+}
+
+/**
+ * @brief Sets up group state, models and task watches
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+controller_init(const struct tenant_config *cfg,
+                const struct pqos_cpuinfo *cpu)
+{
+        unsigned i, cos = 1;
+
+        if (cfg->num_groups == 0 || cfg->num_groups > TENANT_MAX_GROUPS)
+                return -1;
+
+        m_cores = malloc(cfg->num_groups * cpu->num_cores *
+                         sizeof(m_cores[0]));
+        if (m_cores == NULL || quota_init() != 0 ||
+            placement_init(cpu) != 0 || taskwatch_init() != 0)
+                return -1;
+
+        m_num_groups = cfg->num_groups;
+        for (i = 0; i < cfg->num_groups; i++) {
+                struct ctl_group *g = &m_groups[i];
+
+                g->cfg = &cfg->groups[i];
+                g->watch = -1;
+                g->iso.cpuset_dir = g->cfg->cpuset_dir;
+                g->iso.memory_dir = g->cfg->memory_dir;
+                g->cores = &m_cores[i * cpu->num_cores];
+                g->iso.cores = g->cores;
+                feedback_reset(&g->fb);
+                if (g->cfg->type != TENANT_ONLINE)
+                        continue;
+
+                g->iso.cos = cos++;
+                g->model = quota_model_load(g->cfg->model_file);
+                if (g->model == NULL) {
+                        printf("Error : Failed to load model %s.\n",
+                               g->cfg->model_file);
+                        return -1;
+                }
+                g->watch = taskwatch_add(g->cfg->cpuset_dir);
+                if (g->watch < 0) {
+                        printf("Error : Failed to watch %s.\n",
+                               g->cfg->cpuset_dir);
+                        return -1;
+                }
+                if (g->cfg->perf_dir != NULL) {
+                        g->pg = perfgroup_open(g->cfg->perf_dir, cpu);
+                        if (g->pg == NULL ||
+                            perfgroup_read(g->pg, &g->pv) != 0) {
+                                printf("Error : Failed to count IPS of "
+                                       "%s.\n", g->cfg->name);
+                                return -1;
+                        }
+                        g->pv_ms = now_ms();
+                }
+                if (g->cfg->retrain_s > 0) {
+                        g->rt = retrain_start(g->cfg->model_file,
+                                              g->cfg->retrain_s);
+                        if (g->rt == NULL) {
+                                printf("Error : Failed to retrain model of "
+                                       "%s.\n", g->cfg->name);
+                                return -1;
+                        }
+                }
+                /* default quota, same as planning for 0 threads */
+                replan_group(g, 0);
+                g->tasks = taskwatch_count(g->watch);
+                /* 0 so that a loaded service triggers adjustment at start */
+                g->applied = 0;
+                update_trigger(g);
+        }
+        for (i = 0; i < cfg->num_groups; i++)
+                if (m_groups[i].cfg->type == TENANT_BEST_EFFORT)
+                        m_groups[i].iso.cos = cos;
+        return 0;
+}
+
+int controller_run(const struct tenant_config *cfg,
+                   const struct pqos_cpuinfo *cpu,
+                   const struct pqos_capability *cap_l3ca,
+                   const struct pqos_capability *cap_mba,
+                   volatile sig_atomic_t *stop)
+{
+        const uint64_t mem = mem_total();
+        uint64_t settle_at, feedback_at;
+        int ret = 0, feedback = 0;
+        unsigned i;
+
+        if (cfg == NULL || cpu == NULL || stop == NULL)
+                return -1;
+
+        if (controller_init(cfg, cpu) != 0) {
+                controller_fini();
+                return -1;
+        }
+        apply(cpu, cap_l3ca, cap_mba, mem);
+
+        for (i = 0; i < m_num_groups; i++)
+                feedback |= (m_groups[i].pg != NULL);
+        settle_at = now_ms() + CONTROLLER_SETTLE_MS;
+        feedback_at = now_ms() + FEEDBACK_INTERVAL_MS;
+
+        while (!*stop) {
+                const uint64_t now = now_ms();
+                int pending = 0, replan = 0, changed = 0, wait;
+                int timeout = -1;
+
+                for (i = 0; i < m_num_groups; i++)
+                        pending |= m_groups[i].trigger;
+
+                /* pending adjustment waits for thread counts to settle */
+                if (pending)
+                        timeout = settle_at > now ? (int)(settle_at - now) : 0;
+                if (feedback) {
+                        const int t = feedback_at > now ?
+                                (int)(feedback_at - now) : 0;
+
+                        if (timeout < 0 || t < timeout)
+                                timeout = t;
+                }
+                wait = taskwatch_wait(timeout);
+                if (wait < 0) {
+                        if (errno == EINTR)
+                                continue;
+                        printf("Error : Watching tasks failed: %s\n",
+                               strerror(errno));
+                        ret = -1;
+                        break;
+                }
+
+                if (wait > 0) {
+                        for (i = 0; i < m_num_groups; i++) {
+                                struct ctl_group *g = &m_groups[i];
+                                const int cur = taskwatch_count(g->watch);
+
+                                if (g->watch < 0 || cur == g->tasks)
+                                        continue;
+                                printf("Info : Group %s tasks changed. "
+                                       "Pre is %d, Cur is %d.\n",
+                                       g->cfg->name, g->tasks, cur);
+                                g->tasks = cur;
+                                update_trigger(g);
+                        }
+                        /* task churn must not starve the feedback loop */
+                        settle_at = now_ms() + CONTROLLER_SETTLE_MS;
+                }
+
+                if (pending && now_ms() >= settle_at) {
+                        printf("Info : The load is stable now. "
+                               "Dynamic quota adjustment begins ......\n");
+                        for (i = 0; i < m_num_groups; i++) {
+                                struct ctl_group *g = &m_groups[i];
+
+                                if (!g->trigger)
+                                        continue;
+                                replan_group(g,
+                                             g->tasks + g->cfg->tasks_offset);
+                                g->applied = g->tasks;
+                                g->trigger = 0;
+                                /* IPS of this period is not comparable */
+                                g->fb.hold = 1;
+                        }
+                        replan = 1;
+                }
+                if (feedback && now_ms() >= feedback_at) {
+                        feedback_at = now_ms() + FEEDBACK_INTERVAL_MS;
+                        changed = feedback_step(now_ms());
+                        if (retrain_step())
+                                replan = changed = 1;
+                }
+                if (!replan && !changed)
+                        continue;
+                if (apply(cpu, cap_l3ca, cap_mba, mem) == 0 && replan)
+                        printf("Info : Dynamic quota adjustment success.\n");
+        }
+
+        controller_fini();
+        return ret;
+}
@@ -0,0 +1,92 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - isolation controller module
+ *
+ * Shares cores, L3 ways, memory bandwidth and memory of the node between
+ * the online and best-effort groups of a tenant configuration and
+ * re-plans the online quotas when their thread counts change.
+ */
+
+#include <signal.h>
+#include "pqos.h"
+#include "tenant.h"
+
+#ifndef __CONTROLLER_H__
+#define __CONTROLLER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Thread count has to stay unchanged this long (ms) before a new quota
+ * is applied
+ */
+#define CONTROLLER_SETTLE_MS 200
+
+/**
+ * Thread count changes up to this value do not trigger a new quota
+ */
+#define CONTROLLER_TASKS_DELTA 5
+
+/**
+ * Groups with fewer threads (after tasks-offset) keep their quota
+ */
+#define CONTROLLER_MIN_TASKS 10
+
+/**
+ * @brief Runs isolation controller until \a stop is set
+ *
+ * @param [in] cfg tenant configuration
+ * @param [in] cpu cpu information structure
+ * @param [in] cap_l3ca L3 CAT capability structure, may be NULL
+ * @param [in] cap_mba MBA capability structure, may be NULL
+ * @param [in] stop flag set by signal handler to stop the controller
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int controller_run(const struct tenant_config *cfg,
+                   const struct pqos_cpuinfo *cpu,
+                   const struct pqos_capability *cap_l3ca,
+                   const struct pqos_capability *cap_mba,
+                   volatile sig_atomic_t *stop);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CONTROLLER_H__ */
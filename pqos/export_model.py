@@ -0,0 +1,105 @@
+#导出sklearn GradientBoostingRegressor模型，供Muses(quota.c/gbrt.c)直接mmap加载，无需python环境
+#用法: python3 export_model.py Mysql_25&100_GBRT_1101.model Mysql_25&100_GBRT_1101.gbrt
+#文件格式见gbrt.h struct gbrt_file_header: 每棵树补齐为深度相同的完全二叉树，按层序存放，
+#feature/threshold/leaf三个数组分开存放(SoA)，每个数组按64字节对齐
+import struct
+import sys
+
+GBRT_FILE_MAGIC = b"GBRTBIN\0"
+GBRT_FILE_VERSION = 2
+GBRT_MAX_DEPTH = 12
+GBRT_ALIGN = 64
+HEADER = struct.Struct("<8sIIIIddQQQ")
+FLT_MAX = 3.4028234663852886e38
+
+
+def float_down(value):
+    #返回不大于value的最大float32，float32输入x满足 x <= value 当且仅当 x <= float_down(value)
+    if value >= FLT_MAX:
+        return FLT_MAX
+    f = struct.unpack("<f", struct.pack("<f", value))[0]
+    if f <= value:
+        return f
+    bits = struct.unpack("<I", struct.pack("<f", f))[0]
+    if f > 0:
+        bits -= 1
+    elif f == 0:
+        bits = 0x80000001
+    else:
+        bits += 1
+    return struct.unpack("<f", struct.pack("<I", bits))[0]
+
+
+def tree_depth(tree, node=0):
+    if tree.children_left[node] == -1:
+        return 0
+    return 1 + max(tree_depth(tree, tree.children_left[node]),
+                   tree_depth(tree, tree.children_right[node]))
+
+
+def fill_tree(tree, node, pos, level, depth, feature, threshold, leaf):
+    #提前结束的叶子补成恒走左边的内部节点，其下所有叶子取相同值
+    inner = (1 << depth) - 1
+    left = tree.children_left[node]
+    if level == depth:
+        leaf[pos - inner] = float(tree.value[node][0][0])
+        return
+    if left == -1:
+        feature[pos] = 0
+        threshold[pos] = float("inf")
+        fill_tree(tree, node, 2 * pos + 1, level + 1, depth, feature, threshold, leaf)
+        fill_tree(tree, node, 2 * pos + 2, level + 1, depth, feature, threshold, leaf)
+        return
+    feature[pos] = int(tree.feature[node])
+    threshold[pos] = float_down(float(tree.threshold[node]))
+    fill_tree(tree, left, 2 * pos + 1, level + 1, depth, feature, threshold, leaf)
+    fill_tree(tree, tree.children_right[node], 2 * pos + 2, level + 1, depth,
+              feature, threshold, leaf)
+
+
+def align(off):
+    return (off + GBRT_ALIGN - 1) // GBRT_ALIGN * GBRT_ALIGN
+
+
+def write_model(fname, n_features, init, rate, trees):
+    depth = max(1, max(tree_depth(t) for t in trees))
+    if depth > GBRT_MAX_DEPTH:
+        raise ValueError("tree depth %d exceeds %d" % (depth, GBRT_MAX_DEPTH))
+    inner = (1 << depth) - 1
+    feature, threshold, leaf = [], [], []
+    for t in trees:
+        f, thr, lv = [0] * inner, [0.0] * inner, [0.0] * (inner + 1)
+        fill_tree(t, 0, 0, 0, depth, f, thr, lv)
+        feature += f
+        threshold += thr
+        leaf += lv
+
+    off_feature = align(HEADER.size)
+    off_threshold = align(off_feature + 4 * len(feature))
+    off_leaf = align(off_threshold + 4 * len(threshold))
+    with open(fname, "wb") as out:
+        out.write(HEADER.pack(GBRT_FILE_MAGIC, GBRT_FILE_VERSION, n_features,
+                              len(trees), depth, init, rate,
+                              off_feature, off_threshold, off_leaf))
+        out.write(b"\0" * (off_feature - out.tell()))
+        out.write(struct.pack("<%di" % len(feature), *feature))
+        out.write(b"\0" * (off_threshold - out.tell()))
+        out.write(struct.pack("<%df" % len(threshold), *threshold))
+        out.write(b"\0" * (off_leaf - out.tell()))
+        out.write(struct.pack("<%dd" % len(leaf), *leaf))
+
+
+def export_model(model, fname):
+    import numpy as np
+    n_features = model.n_features_
+    init = float(np.ravel(model.init_.predict(np.zeros((1, n_features))))[0])
+    write_model(fname, n_features, init, float(model.learning_rate),
+                [est.tree_ for est in model.estimators_[:, 0]])
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("Usage: %s MODEL_IN GBRT_OUT" % sys.argv[0])
+        sys.exit(1)
+    from sklearn.externals import joblib
+    export_model(joblib.load(sys.argv[1]), sys.argv[2])
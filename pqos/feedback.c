@@ -0,0 +1,95 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - SLO feedback module
+ *
+ * The controller output is a scale applied to cores, L3 ways and MBA of
+ * the model planned quota. The relative error (slo - ips) / slo drives a
+ * PI law with asymmetric proportional gain, the integral is clamped to
+ * the scale range so it cannot wind up while the scale saturates. The
+ * target assumes a saturated service, so the integral is frozen while
+ * a deficit comes with idle cores.
+ */
+#include "feedback.h"
+
+void
+feedback_reset(struct feedback *fb)
+{
+        fb->scale = 1.0;
+        fb->integral = 0.0;
+        fb->hold = 0;
+}
+
+static double
+clamp(const double v, const double lo, const double hi)
+{
+        return v < lo ? lo : (v > hi ? hi : v);
+}
+
+int
+feedback_update(struct feedback *fb, const double slo, const double ips,
+                const double load)
+{
+        const double i_max = (FEEDBACK_SCALE_MAX - 1.0) / FEEDBACK_KI;
+        const double i_min = (FEEDBACK_SCALE_MIN - 1.0) / FEEDBACK_KI;
+        double err, scale;
+
+        if (slo <= 0)
+                return 0;
+        if (fb->hold > 0) {
+                fb->hold--;
+                return 0;
+        }
+
+        err = (slo - ips) / slo;
+        if (err > -FEEDBACK_BAND && err < FEEDBACK_BAND)
+                return 0;
+        /* IPS limited by load, not by resources */
+        if (err > 0 && load >= 0 && load < FEEDBACK_MIN_LOAD)
+                return 0;
+
+        fb->integral = clamp(fb->integral + err, i_min, i_max);
+        scale = 1.0 + FEEDBACK_KI * fb->integral +
+                err * (err > 0 ? FEEDBACK_KP_UP : FEEDBACK_KP_DOWN);
+        scale = clamp(scale, FEEDBACK_SCALE_MIN, FEEDBACK_SCALE_MAX);
+        /* rate limit */
+        scale = clamp(scale, fb->scale - FEEDBACK_MAX_STEP,
+                      fb->scale + FEEDBACK_MAX_STEP);
+        if (scale == fb->scale)
+                return 0;
+
+        fb->scale = scale;
+        fb->hold = 1;
+        return 1;
+}
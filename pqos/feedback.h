@@ -0,0 +1,108 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - SLO feedback module
+ *
+ * PI controller correcting model planned quotas of an online group from
+ * its measured IPS.
+ */
+
+#ifndef __FEEDBACK_H__
+#define __FEEDBACK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FEEDBACK_INTERVAL_MS 1000       /**< control period */
+
+/**
+ * Relative IPS error below which resources are left alone (hysteresis)
+ */
+#define FEEDBACK_BAND 0.05
+
+#define FEEDBACK_KP_UP 1.5              /**< gain on SLO violation */
+#define FEEDBACK_KP_DOWN 0.5            /**< gain on IPS surplus */
+#define FEEDBACK_KI 0.2                 /**< integral gain */
+#define FEEDBACK_MAX_STEP 0.05          /**< max scale change per period */
+#define FEEDBACK_SCALE_MIN 0.8          /**< min quota scale */
+#define FEEDBACK_SCALE_MAX 1.5          /**< max quota scale */
+
+/**
+ * Busy fraction of the group's cores below which the group is not
+ * demanding resources. An IPS deficit then comes from the offered load,
+ * more resources would not close it.
+ */
+#define FEEDBACK_MIN_LOAD 0.7
+
+/**
+ * Controller state of one online group
+ */
+struct feedback {
+        double scale;                   /**< factor applied to model quota */
+        double integral;                /**< accumulated relative error */
+        int hold;                       /**< periods to skip after change */
+};
+
+/**
+ * @brief Resets \a fb to trust the model (scale 1)
+ */
+void feedback_reset(struct feedback *fb);
+
+/**
+ * @brief Updates quota scale from one period of measured IPS
+ *
+ * Errors within FEEDBACK_BAND of \a slo do not move the scale. A
+ * violation is corrected with the higher gain so the service is protected
+ * sooner than surplus is given back. A deficit while the group keeps
+ * less than FEEDBACK_MIN_LOAD of its cores busy is left alone and does
+ * not accumulate in the integral. The period after a change is skipped,
+ * its IPS was measured partly with old resources.
+ *
+ * @param [in,out] fb controller state
+ * @param [in] slo IPS target
+ * @param [in] ips IPS measured over the last period
+ * @param [in] load busy fraction of the group's cores over the last
+ *             period, negative if unknown
+ *
+ * @return 1 if scale changed, 0 otherwise
+ */
+int feedback_update(struct feedback *fb, const double slo, const double ips,
+                    const double load);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FEEDBACK_H__ */
@@ -0,0 +1,390 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - GBRT model module
+ *
+ * Model files are written by export_model.py (see struct gbrt_file_header)
+ * and mapped read-only, so loading does no parsing and no copying.
+ * Trees are complete and stored breadth-first which lets a batch of rows
+ * walk a tree in lock-step: one gather per level for the split feature,
+ * threshold and input value, then a compare selects the child.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GBRT_AVX2
+#endif
+
+#include "gbrt.h"
+
+#define GBRT_FILE_MAGIC   "GBRTBIN"
+#define GBRT_FILE_VERSION 2
+#define GBRT_ALIGN        64
+
+/**
+ * @brief Checks that array of \a size bytes at \a off fits in the file
+ *
+ * @return 1 if array is valid, 0 otherwise
+ */
+static int
+array_ok(const uint64_t off, const uint64_t size, const size_t file_size)
+{
+        return (off % GBRT_ALIGN) == 0 && off <= file_size &&
+                size <= file_size - off;
+}
+
+struct gbrt_model *gbrt_load(const char *fname)
+{
+        struct gbrt_model *model = NULL;
+        const struct gbrt_file_header *hdr;
+        struct stat st;
+        uint64_t inner, leaves;
+        unsigned i;
+        void *map;
+        int fd;
+
+        if (fname == NULL)
+                return NULL;
+
+        fd = open(fname, O_RDONLY);
+        if (fd < 0) {
+                printf("Error : Cannot open model file %s!\n", fname);
+                return NULL;
+        }
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(*hdr)) {
+                printf("Error : %s is not a GBRT model file!\n", fname);
+                close(fd);
+                return NULL;
+        }
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) {
+                printf("Error : Cannot map model file %s!\n", fname);
+                return NULL;
+        }
+
+        model = calloc(1, sizeof(*model));
+        if (model == NULL)
+                goto error;
+        model->map = map;
+        model->map_size = st.st_size;
+
+        hdr = map;
+        if (memcmp(hdr->magic, GBRT_FILE_MAGIC, sizeof(GBRT_FILE_MAGIC)) ||
+            hdr->version != GBRT_FILE_VERSION) {
+                printf("Error : %s is not a GBRT model file!\n", fname);
+                goto error;
+        }
+        if (hdr->num_features == 0 ||
+            hdr->num_features > GBRT_MAX_FEATURES ||
+            hdr->num_trees == 0 || hdr->depth == 0 ||
+            hdr->depth > GBRT_MAX_DEPTH) {
+                printf("Error : Unsupported model shape!\n");
+                goto error;
+        }
+
+        inner = (uint64_t)hdr->num_trees * ((1u << hdr->depth) - 1);
+        leaves = (uint64_t)hdr->num_trees * (1u << hdr->depth);
+        if (!array_ok(hdr->off_feature, inner * sizeof(int32_t),
+                      model->map_size) ||
+            !array_ok(hdr->off_threshold, inner * sizeof(float),
+                      model->map_size) ||
+            !array_ok(hdr->off_leaf, leaves * sizeof(double),
+                      model->map_size)) {
+                printf("Error : Model file %s is truncated!\n", fname);
+                goto error;
+        }
+
+        model->init = hdr->init;
+        model->rate = hdr->rate;
+        model->num_features = hdr->num_features;
+        model->num_trees = hdr->num_trees;
+        model->depth = hdr->depth;
+        model->num_inner = (1u << hdr->depth) - 1;
+        model->feature = (const int32_t *)((const char *)map +
+                                           hdr->off_feature);
+        model->threshold = (const float *)((const char *)map +
+                                           hdr->off_threshold);
+        model->leaf = (const double *)((const char *)map + hdr->off_leaf);
+
+        /* traversal indexes inputs with these, check them once here */
+        for (i = 0; i < inner; i++)
+                if (model->feature[i] < 0 ||
+                    (unsigned)model->feature[i] >= model->num_features) {
+                        printf("Error : Model file, bad split feature!\n");
+                        goto error;
+                }
+
+        return model;
+
+ error:
+        if (model == NULL)
+                munmap(map, st.st_size);
+        gbrt_free(model);
+        return NULL;
+}
+
+void gbrt_free(struct gbrt_model *model)
+{
+        if (model == NULL)
+                return;
+        if (model->map != NULL)
+                munmap(model->map, model->map_size);
+        free(model);
+}
+
+/**
+ * @brief Rounds \a off up to GBRT_ALIGN
+ */
+static inline size_t
+align_up(const size_t off)
+{
+        return (off + GBRT_ALIGN - 1) / GBRT_ALIGN * GBRT_ALIGN;
+}
+
+struct gbrt_model *gbrt_extend(const struct gbrt_model *base,
+                               const unsigned num_trees,
+                               const int32_t *feature, const float *threshold,
+                               const double *leaf)
+{
+        struct gbrt_model *model;
+        size_t ni, n_base, n_new, off_threshold, off_leaf;
+        unsigned i;
+        char *map;
+
+        if (base == NULL || feature == NULL || threshold == NULL ||
+            leaf == NULL || num_trees == 0 ||
+            num_trees > UINT_MAX - base->num_trees)
+                return NULL;
+
+        ni = base->num_inner;
+        n_base = (size_t)base->num_trees * ni;
+        n_new = (size_t)num_trees * ni;
+        for (i = 0; i < n_new; i++)
+                if (feature[i] < 0 ||
+                    (unsigned)feature[i] >= base->num_features)
+                        return NULL;
+
+        model = calloc(1, sizeof(*model));
+        if (model == NULL)
+                return NULL;
+        /* same layout as a model file without the header */
+        off_threshold = align_up((n_base + n_new) * sizeof(int32_t));
+        off_leaf = align_up(off_threshold +
+                            (n_base + n_new) * sizeof(float));
+        model->map_size = off_leaf + (n_base + n_new + base->num_trees +
+                                      num_trees) * sizeof(double);
+        map = mmap(NULL, model->map_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (map == MAP_FAILED) {
+                free(model);
+                return NULL;
+        }
+        model->map = map;
+
+        memcpy(map, base->feature, n_base * sizeof(int32_t));
+        memcpy(map + n_base * sizeof(int32_t), feature,
+               n_new * sizeof(int32_t));
+        memcpy(map + off_threshold, base->threshold, n_base * sizeof(float));
+        memcpy(map + off_threshold + n_base * sizeof(float), threshold,
+               n_new * sizeof(float));
+        memcpy(map + off_leaf, base->leaf,
+               (n_base + base->num_trees) * sizeof(double));
+        memcpy(map + off_leaf + (n_base + base->num_trees) * sizeof(double),
+               leaf, (n_new + num_trees) * sizeof(double));
+        mprotect(map, model->map_size, PROT_READ);
+
+        model->init = base->init;
+        model->rate = base->rate;
+        model->num_features = base->num_features;
+        model->num_trees = base->num_trees + num_trees;
+        model->depth = base->depth;
+        model->num_inner = base->num_inner;
+        model->feature = (const int32_t *)map;
+        model->threshold = (const float *)(map + off_threshold);
+        model->leaf = (const double *)(map + off_leaf);
+        return model;
+}
+
+/**
+ * @brief Scalar prediction of rows [\a first, \a num)
+ */
+static void
+predict_scalar(const struct gbrt_model *model, const float *x,
+               const unsigned first, const unsigned num, double *y)
+{
+        const unsigned nf = model->num_features;
+        const unsigned ni = model->num_inner;
+        unsigned i, t, d;
+
+        for (i = first; i < num; i++) {
+                const float *row = &x[i * nf];
+                double sum = model->init;
+
+                /* same summation order as sklearn predict_stages() */
+                for (t = 0; t < model->num_trees; t++) {
+                        const int32_t *feature = &model->feature[t * ni];
+                        const float *threshold = &model->threshold[t * ni];
+                        unsigned n = 0;
+
+                        /* x <= threshold goes left, NaN goes right */
+                        for (d = 0; d < model->depth; d++)
+                                n = 2 * n + 1 +
+                                        !(row[feature[n]] <= threshold[n]);
+                        sum += model->rate * model->leaf[t * (ni + 1) +
+                                                         n - ni];
+                }
+                y[i] = sum;
+        }
+}
+
+#ifdef GBRT_AVX2
+#define GBRT_AVX2_DEPTH 4               /**< deepest tree for AVX2 path */
+
+/**
+ * @brief AVX2 prediction, 8 rows per iteration
+ *
+ * Inner nodes of a tree (up to 15) are held in two registers and selected
+ * with permutes, only the input values and leaves are gathered.
+ * Multiply and add are kept separate (no FMA) so the result rounds
+ * exactly like the scalar path.
+ *
+ * @return number of rows predicted
+ */
+__attribute__((target("avx2")))
+static unsigned
+predict_avx2(const struct gbrt_model *model, const float *x,
+             const unsigned num, double *y)
+{
+        const unsigned nf = model->num_features;
+        const unsigned ni = model->num_inner;
+        const __m256d rate = _mm256_set1_pd(model->rate);
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i seven = _mm256_set1_epi32(7);
+        const __m256i leaf0 = _mm256_set1_epi32(ni);
+        const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i lane = _mm256_mullo_epi32(iota, _mm256_set1_epi32(nf));
+        const __m256i mask_lo = _mm256_cmpgt_epi32(leaf0, iota);
+        const __m256i mask_hi = _mm256_cmpgt_epi32(
+                leaf0, _mm256_add_epi32(iota, _mm256_set1_epi32(8)));
+        unsigned i, t, d;
+
+        /* gather indexes are signed 32-bit */
+        if (model->depth > GBRT_AVX2_DEPTH || (uint64_t)num * nf > INT_MAX)
+                return 0;
+
+        for (i = 0; i + 8 <= num; i += 8) {
+                const __m256i base = _mm256_add_epi32(
+                        _mm256_set1_epi32(i * nf), lane);
+                __m256d lo = _mm256_set1_pd(model->init);
+                __m256d hi = lo;
+
+                for (t = 0; t < model->num_trees; t++) {
+                        const int *feature =
+                                (const int *)&model->feature[t * ni];
+                        const float *threshold = &model->threshold[t * ni];
+                        const double *leaf = &model->leaf[t * (ni + 1)];
+                        const __m256i f_lo =
+                                _mm256_maskload_epi32(feature, mask_lo);
+                        const __m256i f_hi =
+                                _mm256_maskload_epi32(feature + 8, mask_hi);
+                        const __m256 t_lo =
+                                _mm256_maskload_ps(threshold, mask_lo);
+                        const __m256 t_hi =
+                                _mm256_maskload_ps(threshold + 8, mask_hi);
+                        __m256i n = _mm256_setzero_si256();
+                        __m256i f, sel;
+                        __m256 v, thr;
+
+                        for (d = 0; d < model->depth; d++) {
+                                /* nodes 8..14 live in the high registers */
+                                sel = _mm256_cmpgt_epi32(n, seven);
+                                f = _mm256_blendv_epi8(
+                                        _mm256_permutevar8x32_epi32(f_lo, n),
+                                        _mm256_permutevar8x32_epi32(f_hi, n),
+                                        sel);
+                                thr = _mm256_blendv_ps(
+                                        _mm256_permutevar8x32_ps(t_lo, n),
+                                        _mm256_permutevar8x32_ps(t_hi, n),
+                                        _mm256_castsi256_ps(sel));
+                                v = _mm256_i32gather_ps(
+                                        x, _mm256_add_epi32(base, f), 4);
+                                /* all ones where row goes right */
+                                f = _mm256_castps_si256(
+                                        _mm256_cmp_ps(v, thr, _CMP_NLE_UQ));
+                                n = _mm256_sub_epi32(
+                                        _mm256_add_epi32(
+                                                _mm256_add_epi32(n, n), one),
+                                        f);
+                        }
+                        n = _mm256_sub_epi32(n, leaf0);
+                        lo = _mm256_add_pd(lo, _mm256_mul_pd(rate,
+                                _mm256_i32gather_pd(
+                                        leaf, _mm256_castsi256_si128(n), 8)));
+                        hi = _mm256_add_pd(hi, _mm256_mul_pd(rate,
+                                _mm256_i32gather_pd(
+                                        leaf,
+                                        _mm256_extracti128_si256(n, 1), 8)));
+                }
+                _mm256_storeu_pd(&y[i], lo);
+                _mm256_storeu_pd(&y[i + 4], hi);
+        }
+        return i;
+}
+#endif
+
+void gbrt_predict_batch(const struct gbrt_model *model,
+                        const float *x, const unsigned num, double *y)
+{
+        unsigned done = 0;
+
+#ifdef GBRT_AVX2
+        static int avx2 = -1;
+
+        if (avx2 < 0) {
+                __builtin_cpu_init();
+                avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+        }
+        if (avx2)
+                done = predict_avx2(model, x, num, y);
+#endif
+        predict_scalar(model, x, done, num, y);
+}
@@ -0,0 +1,154 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - GBRT model module
+ *
+ * Gradient boosted regression tree ensemble exported from sklearn
+ * GradientBoostingRegressor by export_model.py and scored in batches.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef __GBRT_H__
+#define __GBRT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GBRT_MAX_FEATURES 8             /**< max model inputs */
+#define GBRT_MAX_DEPTH    12            /**< max depth of padded trees */
+
+/**
+ * Model file header. All fields are little-endian, arrays follow at the
+ * given offsets, each aligned to 64 bytes:
+ *
+ *   int32_t feature[num_trees][2^depth - 1]
+ *   float   threshold[num_trees][2^depth - 1]
+ *   double  leaf[num_trees][2^depth]
+ *
+ * Every tree is padded to a complete tree of \a depth and stored
+ * breadth-first, so children of node i are 2i+1 (x <= threshold) and 2i+2.
+ * Thresholds are rounded down to float so that float inputs compare
+ * exactly like sklearn does against the double threshold.
+ */
+struct gbrt_file_header {
+        char magic[8];                  /**< "GBRTBIN" */
+        uint32_t version;               /**< GBRT_FILE_VERSION */
+        uint32_t num_features;          /**< number of model inputs */
+        uint32_t num_trees;             /**< number of trees */
+        uint32_t depth;                 /**< depth of every tree */
+        double init;                    /**< initial prediction */
+        double rate;                    /**< learning rate */
+        uint64_t off_feature;           /**< offset of feature array */
+        uint64_t off_threshold;         /**< offset of threshold array */
+        uint64_t off_leaf;              /**< offset of leaf value array */
+};
+
+/**
+ * Tree ensemble mapped from a model file
+ */
+struct gbrt_model {
+        double init;                    /**< initial prediction */
+        double rate;                    /**< learning rate */
+        unsigned num_features;          /**< number of model inputs */
+        unsigned num_trees;             /**< number of trees */
+        unsigned depth;                 /**< depth of every tree */
+        unsigned num_inner;             /**< inner nodes per tree */
+        const int32_t *feature;         /**< split feature per inner node */
+        const float *threshold;         /**< split threshold per inner node */
+        const double *leaf;             /**< leaf values */
+        void *map;                      /**< file mapping */
+        size_t map_size;                /**< size of \a map */
+};
+
+/**
+ * @brief Maps model file written by export_model.py
+ *
+ * @param [in] fname model file name
+ *
+ * @return Pointer to loaded model
+ * @retval NULL on error
+ */
+struct gbrt_model *gbrt_load(const char *fname);
+
+/**
+ * @brief Unmaps model loaded by gbrt_load()
+ *
+ * @param [in] model model to free
+ */
+void gbrt_free(struct gbrt_model *model);
+
+/**
+ * @brief Builds a model made of the trees of \a base followed by
+ *        \a num_trees more trees of the same shape
+ *
+ * The new trees are scaled by the learning rate of \a base like its own
+ * trees are. The result does not reference \a base.
+ *
+ * @param [in] base model to extend
+ * @param [in] num_trees number of trees to append
+ * @param [in] feature split features, num_trees x num_inner
+ * @param [in] threshold split thresholds, num_trees x num_inner
+ * @param [in] leaf leaf values, num_trees x (num_inner + 1)
+ *
+ * @return Pointer to new model, free with gbrt_free()
+ * @retval NULL on error
+ */
+struct gbrt_model *gbrt_extend(const struct gbrt_model *base,
+                               const unsigned num_trees,
+                               const int32_t *feature, const float *threshold,
+                               const double *leaf);
+
+/**
+ * @brief Predicts values for a batch of input rows
+ *
+ * Walks 8 rows at a time with AVX2 when the CPU supports it and trees are
+ * at most 4 levels deep, otherwise one row at a time.
+ * Results are bit-identical to the scalar path and to sklearn predict().
+ *
+ * @param [in] model loaded model
+ * @param [in] x row major inputs, \a num rows of num_features each
+ * @param [in] num number of rows
+ * @param [out] y place to store \a num predictions
+ */
+void gbrt_predict_batch(const struct gbrt_model *model,
+                        const float *x, const unsigned num, double *y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GBRT_H__ */
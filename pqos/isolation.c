@@ -0,0 +1,929 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - isolation module
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <limits.h>
+#include <time.h>
+
+#include "../lib/pqos.h"
+
+#include "main.h"
+#include "isolation.h"
+
+/**
+ * Name of the cpuset file holding the list of cores
+ */
+static const char *cpuset_cpus_file = "cpuset.cpus";
+
+/**
+ * Name of the memory cgroup file holding the memory limit
+ */
+static const char *memory_limit_file = "memory.limit_in_bytes";
+
+/**
+ * Minimum MBA rate that a group can be throttled to
+ */
+#define ISOLATION_MBA_MIN 10
+
+/**
+ * Size of cpuset list string of one group
+ */
+#define ISOLATION_LIST_LEN 2048
+
+/**
+ * Commit steps of isolation_submit() in order, cgroup files
+ * are restored from their own undo log
+ */
+enum isolation_step {
+        STEP_CGROUP = 0,
+        STEP_ASSOC,
+        STEP_L3CA,
+        STEP_MBA
+};
+
+/**
+ * Sockets detected on the platform, resolved on first submit
+ */
+static unsigned *m_sockets = NULL;
+static unsigned m_sock_num = 0;
+
+/**
+ * Last COS successfully associated with each logical core, -1 if unknown.
+ * Lets the engine skip association writes for cores that stay put.
+ */
+static int *m_core_cos = NULL;
+static unsigned m_core_num = 0;
+
+/**
+ * @brief Returns monotonic time in milliseconds
+ */
+static double
+now_ms(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+static int
+cmp_unsigned(const void *a, const void *b)
+{
+        const unsigned x = *(const unsigned *)a;
+        const unsigned y = *(const unsigned *)b;
+
+        return (x > y) - (x < y);
+}
+
+/**
+ * @brief Builds cpuset list string (e.g. "0-3,8,10") of \a cores
+ *
+ * @param [in] cores logical cores, sorted ascending
+ * @param [in] num number of cores
+ * @param [out] buf place to store the string
+ * @param [in] sz size of \a buf
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 if \a buf is too small
+ */
+static int
+cores_to_list(const unsigned *cores, const unsigned num,
+              char *buf, const size_t sz)
+{
+        unsigned i = 0;
+        size_t len = 0;
+
+        buf[0] = '\0';
+        while (i < num) {
+                const unsigned start = cores[i];
+                int n;
+
+                while (i + 1 < num && cores[i + 1] <= cores[i] + 1)
+                        i++;
+                if (cores[i] == start)
+                        n = snprintf(buf + len, sz - len, "%s%u",
+                                     len ? "," : "", start);
+                else
+                        n = snprintf(buf + len, sz - len, "%s%u-%u",
+                                     len ? "," : "", start, cores[i]);
+                if (n < 0 || (size_t)n >= sz - len)
+                        return -1;
+                len += (size_t)n;
+                i++;
+        }
+        return 0;
+}
+
+/**
+ * Previous content of cgroup files written by one submit
+ */
+struct cgroup_undo {
+        unsigned num;                   /**< number of saved files */
+        char **paths;                   /**< file paths */
+        char **vals;                    /**< file content before the write */
+};
+
+/**
+ * @brief Writes \a val into file at \a path in a single write
+ *
+ * @param [in] path file path
+ * @param [in] val value string
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+file_write(const char *path, const char *val)
+{
+        const size_t len = strlen(val);
+        ssize_t ret;
+        int fd;
+
+        fd = open(path, O_WRONLY);
+        if (fd < 0)
+                return -1;
+        /* kernel parses the whole value from a single write */
+        ret = write(fd, val, len);
+        close(fd);
+
+        return (ret == (ssize_t)len) ? 0 : -1;
+}
+
+/**
+ * @brief Saves content of file at \a path into \a undo
+ *
+ * @param [in,out] undo undo log
+ * @param [in] path file path
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+undo_save(struct cgroup_undo *undo, const char *path)
+{
+        char buf[ISOLATION_LIST_LEN], **paths, **vals;
+        ssize_t n;
+        int fd;
+
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+                return -1;
+        n = read(fd, buf, sizeof(buf) - 1);
+        close(fd);
+        if (n < 0)
+                return -1;
+        /* empty file is restored by writing an empty line */
+        if (n == 0)
+                buf[n++] = '\n';
+        buf[n] = '\0';
+
+        paths = realloc(undo->paths, (undo->num + 1) * sizeof(paths[0]));
+        if (paths == NULL)
+                return -1;
+        undo->paths = paths;
+        vals = realloc(undo->vals, (undo->num + 1) * sizeof(vals[0]));
+        if (vals == NULL)
+                return -1;
+        undo->vals = vals;
+
+        paths[undo->num] = strdup(path);
+        vals[undo->num] = strdup(buf);
+        if (paths[undo->num] == NULL || vals[undo->num] == NULL) {
+                free(paths[undo->num]);
+                free(vals[undo->num]);
+                return -1;
+        }
+        undo->num++;
+        return 0;
+}
+
+/**
+ * @brief Writes saved content back into cgroup files
+ *
+ * Files are restored in reverse order of writing. A cpuset may be
+ * rejected while its parent is still narrower, so failed files get
+ * a second pass once the rest is restored.
+ *
+ * @param [in] undo undo log
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+undo_restore(const struct cgroup_undo *undo)
+{
+        unsigned i, pass, failed = 0;
+        char *done;
+
+        if (undo->num == 0)
+                return 0;
+        done = calloc(undo->num, sizeof(done[0]));
+        if (done == NULL)
+                return -1;
+
+        for (pass = 0; pass < 2; pass++) {
+                failed = 0;
+                for (i = undo->num; i > 0; i--) {
+                        if (done[i - 1])
+                                continue;
+                        if (file_write(undo->paths[i - 1],
+                                       undo->vals[i - 1]) == 0)
+                                done[i - 1] = 1;
+                        else
+                                failed++;
+                }
+        }
+        for (i = 0; i < undo->num; i++)
+                if (!done[i])
+                        printf("Error : Failed to restore %s: %s\n",
+                               undo->paths[i], strerror(errno));
+        free(done);
+        return failed ? -1 : 0;
+}
+
+/**
+ * @brief Frees memory held by \a undo
+ */
+static void
+undo_free(struct cgroup_undo *undo)
+{
+        unsigned i;
+
+        for (i = 0; i < undo->num; i++) {
+                free(undo->paths[i]);
+                free(undo->vals[i]);
+        }
+        free(undo->paths);
+        free(undo->vals);
+        memset(undo, 0, sizeof(*undo));
+}
+
+/**
+ * @brief Writes \a val into \a file of \a dir/\a sub
+ *
+ * @param [in] dir cgroup directory
+ * @param [in] sub sub-directory of \a dir or NULL
+ * @param [in] file cgroup file name
+ * @param [in] val value string
+ * @param [in,out] undo log to save previous content in, may be NULL
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+cgroup_write(const char *dir, const char *sub, const char *file,
+             const char *val, struct cgroup_undo *undo)
+{
+        char path[PATH_MAX];
+        int n;
+
+        if (sub != NULL)
+                n = snprintf(path, sizeof(path), "%s/%s/%s", dir, sub, file);
+        else
+                n = snprintf(path, sizeof(path), "%s/%s", dir, file);
+        if (n < 0 || (size_t)n >= sizeof(path))
+                return -1;
+
+        if (undo != NULL && undo_save(undo, path) != 0)
+                return -1;
+        return file_write(path, val);
+}
+
+/**
+ * @brief Writes \a cpus into \a dir and all its direct sub-directories
+ *
+ * A child cpuset has to be a subset of its parent so the parent is written
+ * first (growing) and again after the children (shrinking).
+ *
+ * @param [in] dir cgroup directory
+ * @param [in] cpus cpuset list string
+ * @param [in,out] undo log to save previous content in
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+cpuset_write_tree(const char *dir, const char *cpus,
+                  struct cgroup_undo *undo)
+{
+        const unsigned saved = undo->num;
+        int parent_ok, parent_saved, child_fail = 0;
+        DIR *d;
+
+        parent_ok = (cgroup_write(dir, NULL, cpuset_cpus_file, cpus,
+                                  undo) == 0);
+        parent_saved = (undo->num > saved);
+
+        d = opendir(dir);
+        if (d != NULL) {
+                struct dirent *e;
+
+                while ((e = readdir(d)) != NULL) {
+                        if (e->d_type != DT_DIR || e->d_name[0] == '.')
+                                continue;
+                        if (cgroup_write(dir, e->d_name, cpuset_cpus_file,
+                                         cpus, undo) != 0) {
+                                printf("Error : Failed to write cpuset "
+                                       "of %s/%s: %s\n", dir, e->d_name,
+                                       strerror(errno));
+                                child_fail = 1;
+                        }
+                }
+                closedir(d);
+        }
+
+        if (!parent_ok)
+                parent_ok = (cgroup_write(dir, NULL, cpuset_cpus_file,
+                                          cpus, parent_saved ? NULL :
+                                          undo) == 0);
+        if (!parent_ok)
+                printf("Error : Failed to write cpuset of %s: %s\n",
+                       dir, strerror(errno));
+
+        return (parent_ok && !child_fail) ? 0 : -1;
+}
+
+/**
+ * @brief Associates logical cores with COS from \a core_cos
+ *
+ * Cores moving to the same COS are associated in one call.
+ *
+ * @param [in] core_cos requested COS per logical core, -1 to skip
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+isolation_assoc(const int *core_cos)
+{
+        unsigned *cores, i, j;
+        int ret = 0;
+
+        cores = malloc(m_core_num * sizeof(cores[0]));
+        if (cores == NULL) {
+                printf("Error : Failed to allocate core table!\n");
+                return -1;
+        }
+
+        for (i = 0; i < m_core_num && ret == 0; i++) {
+                const int cos = core_cos[i];
+                unsigned num = 0;
+
+                if (cos < 0 || m_core_cos[i] == cos)
+                        continue;
+
+                /* earlier cores moving to cos were handled with core i */
+                for (j = i; j < m_core_num; j++)
+                        if (core_cos[j] == cos && m_core_cos[j] != cos)
+                                cores[num++] = j;
+
+                if (pqos_alloc_assoc_set_many(cores, num, (unsigned)cos) !=
+                    PQOS_RETVAL_OK) {
+                        printf("Error : COS%d association of %u cores "
+                               "failed!\n", cos, num);
+                        ret = -1;
+                }
+                for (j = 0; j < num; j++)
+                        m_core_cos[cores[j]] = (ret == 0) ? cos : -1;
+        }
+        free(cores);
+        return ret;
+}
+
+/**
+ * @brief Programs L3 CAT classes on all sockets
+ *
+ * @param [in] ca classes to program
+ * @param [in] num number of classes
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+isolation_l3ca(const struct pqos_l3ca *ca, const unsigned num)
+{
+        unsigned i;
+
+        for (i = 0; i < m_sock_num; i++)
+                if (pqos_l3ca_set(m_sockets[i], num, ca) != PQOS_RETVAL_OK) {
+                        printf("SOCKET %u L3CA - FAILED!\n", m_sockets[i]);
+                        return -1;
+                }
+        return 0;
+}
+
+/**
+ * @brief Programs MBA classes on all sockets
+ *
+ * @param [in] mba classes to program
+ * @param [in] num number of classes
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+isolation_mba(const struct pqos_mba *mba, const unsigned num)
+{
+        struct pqos_mba actual[ISOLATION_MAX_GROUPS];
+        unsigned i;
+
+        for (i = 0; i < m_sock_num; i++)
+                if (pqos_mba_set(m_sockets[i], num, mba, actual) !=
+                    PQOS_RETVAL_OK) {
+                        printf("SOCKET %u MBA - FAILED!\n", m_sockets[i]);
+                        return -1;
+                }
+        return 0;
+}
+
+/**
+ * @brief Reads current COS of cores that \a core_cos moves
+ *
+ * @param [in] core_cos requested COS per logical core, -1 to skip
+ * @param [out] old_cos current COS per logical core, -1 if not moved
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+assoc_save(const int *core_cos, int *old_cos)
+{
+        unsigned i;
+
+        for (i = 0; i < m_core_num; i++) {
+                unsigned class_id;
+
+                old_cos[i] = -1;
+                if (core_cos[i] < 0 || m_core_cos[i] == core_cos[i])
+                        continue;
+                if (pqos_alloc_assoc_get(i, &class_id) != PQOS_RETVAL_OK) {
+                        printf("Error : Failed to read COS of core %u!\n",
+                               i);
+                        return -1;
+                }
+                old_cos[i] = (int)class_id;
+        }
+        return 0;
+}
+
+/**
+ * @brief Reads current L3 CAT classes matching \a ca on all sockets
+ *
+ * @param [in] cap L3 CAT capability structure
+ * @param [in] ca classes to be programmed
+ * @param [in] num number of classes
+ * @param [out] old current classes, \a num per socket
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+l3ca_save(const struct pqos_capability *cap, const struct pqos_l3ca *ca,
+          const unsigned num, struct pqos_l3ca *old)
+{
+        const unsigned max = cap->u.l3ca->num_classes;
+        struct pqos_l3ca *tab;
+        unsigned i, j, k, n;
+        int ret = 0;
+
+        tab = malloc(max * sizeof(tab[0]));
+        if (tab == NULL)
+                return -1;
+        for (i = 0; i < m_sock_num && ret == 0; i++) {
+                if (pqos_l3ca_get(m_sockets[i], max, &n, tab) !=
+                    PQOS_RETVAL_OK) {
+                        ret = -1;
+                        break;
+                }
+                for (j = 0; j < num && ret == 0; j++) {
+                        for (k = 0; k < n; k++)
+                                if (tab[k].class_id == ca[j].class_id)
+                                        break;
+                        if (k == n)
+                                ret = -1;
+                        else
+                                old[i * num + j] = tab[k];
+                }
+        }
+        free(tab);
+        if (ret != 0)
+                printf("Error : Failed to read L3CA classes!\n");
+        return ret;
+}
+
+/**
+ * @brief Reads current MBA classes matching \a mba on all sockets
+ *
+ * @param [in] cap MBA capability structure
+ * @param [in] mba classes to be programmed
+ * @param [in] num number of classes
+ * @param [out] old current classes, \a num per socket
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+mba_save(const struct pqos_capability *cap, const struct pqos_mba *mba,
+         const unsigned num, struct pqos_mba *old)
+{
+        const unsigned max = cap->u.mba->num_classes;
+        struct pqos_mba *tab;
+        unsigned i, j, k, n;
+        int ret = 0;
+
+        tab = malloc(max * sizeof(tab[0]));
+        if (tab == NULL)
+                return -1;
+        for (i = 0; i < m_sock_num && ret == 0; i++) {
+                if (pqos_mba_get(m_sockets[i], max, &n, tab) !=
+                    PQOS_RETVAL_OK) {
+                        ret = -1;
+                        break;
+                }
+                for (j = 0; j < num && ret == 0; j++) {
+                        for (k = 0; k < n; k++)
+                                if (tab[k].class_id == mba[j].class_id)
+                                        break;
+                        if (k == n)
+                                ret = -1;
+                        else
+                                old[i * num + j] = tab[k];
+                }
+        }
+        free(tab);
+        if (ret != 0)
+                printf("Error : Failed to read MBA classes!\n");
+        return ret;
+}
+
+/**
+ * @brief Checks that \a mask is a non-empty run of ways within \a full
+ */
+static int
+mask_ok(const uint64_t mask, const uint64_t full)
+{
+        uint64_t m = mask;
+
+        if (m == 0 || (m & ~full) != 0)
+                return 0;
+        while ((m & 1) == 0)
+                m >>= 1;
+        return (m & (m + 1)) == 0;
+}
+
+/**
+ * @brief Resolves sockets and per core COS cache on first use
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+isolation_init(const struct pqos_cpuinfo *cpu)
+{
+        unsigned i;
+
+        if (m_sockets != NULL)
+                return 0;
+
+        m_sockets = pqos_cpu_get_sockets(cpu, &m_sock_num);
+        if (m_sockets == NULL) {
+                printf("Error retrieving CPU socket information!\n");
+                return -1;
+        }
+        m_core_num = 0;
+        for (i = 0; i < cpu->num_cores; i++)
+                if (cpu->cores[i].lcore >= m_core_num)
+                        m_core_num = cpu->cores[i].lcore + 1;
+        m_core_cos = malloc(m_core_num * sizeof(m_core_cos[0]));
+        if (m_core_cos == NULL) {
+                isolation_cleanup();
+                return -1;
+        }
+        for (i = 0; i < m_core_num; i++)
+                m_core_cos[i] = -1;
+        return 0;
+}
+
+int isolation_submit(const struct isolation_group *groups,
+                     const unsigned num_groups,
+                     const struct pqos_cpuinfo *cpu,
+                     const struct pqos_capability *cap_l3ca,
+                     const struct pqos_capability *cap_mba,
+                     struct isolation_latency *lat)
+{
+        static char lists[ISOLATION_MAX_GROUPS][ISOLATION_LIST_LEN];
+        struct pqos_l3ca ca[ISOLATION_MAX_GROUPS];
+        struct pqos_mba mba[ISOLATION_MAX_GROUPS];
+        unsigned num_ca = 0, num_mba = 0, g, i;
+        struct isolation_latency l;
+        uint64_t full_mask = 0;
+        struct pqos_l3ca *old_ca = NULL;
+        struct pqos_mba *old_mba = NULL;
+        struct cgroup_undo undo;
+        enum isolation_step step = STEP_CGROUP;
+        unsigned *sorted = NULL;
+        int *core_cos = NULL, *old_cos = NULL;
+        int ret = -1;
+        double t0, t;
+
+        if (groups == NULL || num_groups == 0 ||
+            num_groups > ISOLATION_MAX_GROUPS || cpu == NULL)
+                return -1;
+
+        memset(&l, 0, sizeof(l));
+        memset(&undo, 0, sizeof(undo));
+        t0 = now_ms();
+
+        /**
+         * Prepare - compute and validate everything before writing
+         */
+        if (isolation_init(cpu) != 0)
+                return -1;
+
+        if (cap_l3ca != NULL)
+                full_mask = (cap_l3ca->u.l3ca->num_ways >= 64) ? ~0ULL :
+                        ((1ULL << cap_l3ca->u.l3ca->num_ways) - 1ULL);
+
+        core_cos = malloc(m_core_num * sizeof(core_cos[0]));
+        old_cos = malloc(m_core_num * sizeof(old_cos[0]));
+        sorted = malloc(cpu->num_cores * sizeof(sorted[0]));
+        if (core_cos == NULL || old_cos == NULL || sorted == NULL)
+                goto exit;
+        for (i = 0; i < m_core_num; i++)
+                core_cos[i] = -1;
+
+        for (g = 0; g < num_groups; g++) {
+                const struct isolation_group *grp = &groups[g];
+                unsigned j;
+
+                if (grp->cpuset_dir == NULL || grp->num_cores == 0 ||
+                    grp->num_cores > cpu->num_cores) {
+                        printf("Error : Invalid group %u!\n", g);
+                        goto exit;
+                }
+                if ((cap_l3ca != NULL &&
+                     grp->cos >= cap_l3ca->u.l3ca->num_classes) ||
+                    (cap_mba != NULL &&
+                     grp->cos >= cap_mba->u.mba->num_classes)) {
+                        printf("Error : Not enough classes of service "
+                               "for COS%u!\n", grp->cos);
+                        goto exit;
+                }
+
+                for (i = 0; i < grp->num_cores; i++) {
+                        const unsigned lcore = grp->cores[i];
+
+                        if (pqos_cpu_check_core(cpu, lcore) !=
+                            PQOS_RETVAL_OK || lcore >= m_core_num ||
+                            (core_cos[lcore] >= 0 &&
+                             core_cos[lcore] != (int)grp->cos)) {
+                                printf("Error : Invalid core %u in "
+                                       "group %s!\n", lcore,
+                                       grp->cpuset_dir);
+                                goto exit;
+                        }
+                        core_cos[lcore] = (int)grp->cos;
+                        sorted[i] = lcore;
+                }
+                qsort(sorted, grp->num_cores, sizeof(sorted[0]),
+                      cmp_unsigned);
+                if (cores_to_list(sorted, grp->num_cores, lists[g],
+                                  sizeof(lists[g])) != 0)
+                        goto exit;
+
+                if (cap_l3ca != NULL && grp->l3_mask != 0) {
+                        if (!mask_ok(grp->l3_mask, full_mask)) {
+                                printf("Error : Invalid L3 mask 0x%llx!\n",
+                                       (unsigned long long)grp->l3_mask);
+                                goto exit;
+                        }
+                        for (j = 0; j < num_ca; j++)
+                                if (ca[j].class_id == grp->cos)
+                                        break;
+                        if (j < num_ca) {
+                                if (ca[j].u.ways_mask != grp->l3_mask) {
+                                        printf("Error : COS%u L3 mask "
+                                               "mismatch!\n", grp->cos);
+                                        goto exit;
+                                }
+                        } else {
+                                memset(&ca[num_ca], 0, sizeof(ca[0]));
+                                ca[num_ca].class_id = grp->cos;
+                                ca[num_ca].cdp = cap_l3ca->u.l3ca->cdp_on;
+                                if (ca[num_ca].cdp) {
+                                        ca[num_ca].u.s.data_mask =
+                                                grp->l3_mask;
+                                        ca[num_ca].u.s.code_mask =
+                                                grp->l3_mask;
+                                } else
+                                        ca[num_ca].u.ways_mask =
+                                                grp->l3_mask;
+                                num_ca++;
+                        }
+                }
+
+                if (cap_mba != NULL && grp->mba != 0) {
+                        unsigned rate = grp->mba < ISOLATION_MBA_MIN ?
+                                ISOLATION_MBA_MIN : grp->mba;
+
+                        if (rate > 100)
+                                rate = 100;
+                        for (j = 0; j < num_mba; j++)
+                                if (mba[j].class_id == grp->cos)
+                                        break;
+                        if (j < num_mba) {
+                                if (mba[j].mb_rate != rate) {
+                                        printf("Error : COS%u MBA rate "
+                                               "mismatch!\n", grp->cos);
+                                        goto exit;
+                                }
+                        } else {
+                                mba[num_mba].class_id = grp->cos;
+                                mba[num_mba].mb_rate = rate;
+                                num_mba++;
+                        }
+                }
+
+                printf("Info : Group %s COS%u cores [%s], L3 mask 0x%llx, "
+                       "MBA %u%%\n", grp->cpuset_dir, grp->cos, lists[g],
+                       (unsigned long long)grp->l3_mask, grp->mba);
+        }
+
+        if (num_ca > 0) {
+                old_ca = malloc(m_sock_num * num_ca * sizeof(old_ca[0]));
+                if (old_ca == NULL)
+                        goto exit;
+        }
+        if (num_mba > 0) {
+                old_mba = malloc(m_sock_num * num_mba * sizeof(old_mba[0]));
+                if (old_mba == NULL)
+                        goto exit;
+        }
+
+        /**
+         * Commit - stop at the first failing step, each step saves
+         * the values it overwrites first
+         */
+        ret = 0;
+        t = now_ms();
+        for (g = 0; g < num_groups && ret == 0; g++)
+                ret = cpuset_write_tree(groups[g].cpuset_dir, lists[g],
+                                        &undo);
+        l.cpuset_ms = now_ms() - t;
+
+        t = now_ms();
+        for (g = 0; g < num_groups && ret == 0; g++) {
+                char val[32];
+
+                if (groups[g].memory_dir == NULL || groups[g].mem_limit == 0)
+                        continue;
+                snprintf(val, sizeof(val), "%llu",
+                         (unsigned long long)groups[g].mem_limit);
+                ret = cgroup_write(groups[g].memory_dir, NULL,
+                                   memory_limit_file, val, &undo);
+                if (ret != 0)
+                        printf("Error : Failed to set memory limit of %s: "
+                               "%s\n", groups[g].memory_dir,
+                               strerror(errno));
+        }
+        l.mem_ms = now_ms() - t;
+
+        if (ret == 0 && (cap_l3ca != NULL || cap_mba != NULL)) {
+                t = now_ms();
+                ret = assoc_save(core_cos, old_cos);
+                if (ret == 0) {
+                        step = STEP_ASSOC;
+                        ret = isolation_assoc(core_cos);
+                }
+                l.assoc_ms = now_ms() - t;
+        }
+
+        if (ret == 0 && num_ca > 0) {
+                t = now_ms();
+                ret = l3ca_save(cap_l3ca, ca, num_ca, old_ca);
+                if (ret == 0) {
+                        step = STEP_L3CA;
+                        ret = isolation_l3ca(ca, num_ca);
+                }
+                l.l3ca_ms = now_ms() - t;
+        }
+
+        if (ret == 0 && num_mba > 0) {
+                t = now_ms();
+                ret = mba_save(cap_mba, mba, num_mba, old_mba);
+                if (ret == 0) {
+                        step = STEP_MBA;
+                        ret = isolation_mba(mba, num_mba);
+                }
+                l.mba_ms = now_ms() - t;
+        }
+
+        /**
+         * Rollback - restore saved values of every started step
+         * in reverse order
+         */
+        if (ret != 0) {
+                int restored = 0;
+
+                if (step >= STEP_MBA)
+                        for (i = 0; i < m_sock_num; i++)
+                                if (pqos_mba_set(m_sockets[i], num_mba,
+                                                 &old_mba[i * num_mba],
+                                                 mba) != PQOS_RETVAL_OK)
+                                        restored = -1;
+                if (step >= STEP_L3CA)
+                        for (i = 0; i < m_sock_num; i++)
+                                if (pqos_l3ca_set(m_sockets[i], num_ca,
+                                                  &old_ca[i * num_ca]) !=
+                                    PQOS_RETVAL_OK)
+                                        restored = -1;
+                if (step >= STEP_ASSOC)
+                        restored |= isolation_assoc(old_cos);
+                restored |= undo_restore(&undo);
+                printf("%s : Isolation submit rolled back%s\n",
+                       restored ? "Error" : "Info",
+                       restored ? " partially!" : "");
+        }
+
+        l.total_ms = now_ms() - t0;
+
+        printf("Info : Isolation submit %s in %.3f ms (cpuset %.3f, "
+               "mem %.3f, assoc %.3f, l3ca %.3f, mba %.3f)\n",
+               ret == 0 ? "done" : "FAILED", l.total_ms, l.cpuset_ms,
+               l.mem_ms, l.assoc_ms, l.l3ca_ms, l.mba_ms);
+
+        if (lat != NULL)
+                *lat = l;
+ exit:
+        undo_free(&undo);
+        free(core_cos);
+        free(old_cos);
+        free(old_ca);
+        free(old_mba);
+        free(sorted);
+        return ret;
+}
+
+void isolation_cleanup(void)
+{
+        if (m_sockets != NULL)
+                free(m_sockets);
+        m_sockets = NULL;
+        m_sock_num = 0;
+        free(m_core_cos);
+        m_core_cos = NULL;
+        m_core_num = 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - isolation module
+ *
+ * Applies group quotas (cpuset, memory limit, COS association, L3 CAT and
+ * MBA) in-process through the PQoS library.
+ */
+
+#ifndef __ISOLATION_H__
+#define __ISOLATION_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ISOLATION_MAX_GROUPS 16         /**< max groups per submit */
+
+/**
+ * Resources of one isolation group
+ */
+struct isolation_group {
+        const char *cpuset_dir;         /**< cpuset cgroup directory */
+        const char *memory_dir;         /**< memory cgroup directory or NULL */
+        unsigned cos;                   /**< class of service */
+        const unsigned *cores;          /**< logical cores of the group */
+        unsigned num_cores;             /**< number of cores */
+        uint64_t l3_mask;               /**< L3 ways mask, 0 keeps current */
+        unsigned mba;                   /**< MBA rate, 0 keeps current */
+        uint64_t mem_limit;             /**< memory limit in bytes,
+                                             0 keeps current */
+};
+
+/**
+ * Time spent in each step of the last isolation_submit() call
+ */
+struct isolation_latency {
+        double cpuset_ms;               /**< cpuset.cpus writes */
+        double mem_ms;                  /**< memory limit writes */
+        double assoc_ms;                /**< core to COS association */
+        double l3ca_ms;                 /**< L3 CAT class update */
+        double mba_ms;                  /**< MBA class update */
+        double total_ms;                /**< whole transaction */
+};
+
+/**
+ * @brief Applies resources of \a groups
+ *
+ * Writes cpuset.cpus of each group directory and its sub-directories,
+ * sets memory limits, associates group cores with group COS, then
+ * programs L3 CAT masks and MBA rates of every COS on every socket.
+ * Groups may share a COS, they must then agree on its mask and rate.
+ * All values are computed and validated before anything is written.
+ * Each step reads the values it is about to overwrite, if any step
+ * fails the cpusets, memory limits, associations and classes written
+ * so far are restored to them in reverse order.
+ *
+ * @param [in] groups groups to apply
+ * @param [in] num_groups number of groups
+ * @param [in] cpu cpu information structure
+ * @param [in] cap_l3ca L3 CAT capability structure, may be NULL
+ * @param [in] cap_mba MBA capability structure, may be NULL
+ * @param [out] lat optional place to store per step latency
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int isolation_submit(const struct isolation_group *groups,
+                     const unsigned num_groups,
+                     const struct pqos_cpuinfo *cpu,
+                     const struct pqos_capability *cap_l3ca,
+                     const struct pqos_capability *cap_mba,
+                     struct isolation_latency *lat);
+
+/**
+ * @brief Frees memory allocated by the isolation module
+ */
+void isolation_cleanup(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ISOLATION_H__ */
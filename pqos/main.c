@@ -55,8 +55,10 @@
 #include "cap.h"
 
 #include <signal.h>
-#include <python3.6m/Python.h>
-#include "pyapi.h"
+#include "quota.h"
+#include "tenant.h"
+#include "controller.h"
+#include "telemetry.h"
 
 /**
  * Default CDP configuration option - don't enforce on or off
@@ -115,6 +117,7 @@ static int sel_display_verbose = 0;
 const char *CG_CPUSET_PREFIX = "/sys/fs/cgroup/cpuset/mysql_test/";
 const char *CG_CPU_PREFIX = "/sys/fs/cgroup/cpu/mysql_test/";
 const char *CG_MEM_PREFIX = "/sys/fs/cgroup/memory/mysql_test/";
+const char *CG_PERF_PREFIX = "/sys/fs/cgroup/perf_event/mysql_test/";
 const char *CG_CGROUP_PROC_SUFFIX = "cgroup.procs";
 const char *CG_CPUSET_CPUS_SUFFIX = "cpuset.cpus";
 const char *CG_TASKS_SUFFIX = "tasks";
@@ -123,19 +126,10 @@ const char *CG_YARN_OFFLINE_CPUSET = "/sys/fs/cgroup/cpuset/hadoop-yarn/lxc-offl
 
 
 
-//当前节点的cpu core情况
-int ALL_CORES[32];
-const int CORE_NUMS = 32;
-int OFFLINE_LLC_WAYS = 1;
-int ONLINE_LLC_WAYS = 1;
-int OFFLINE_MBA_PERCENT = 10;
-int OFFLINE_MEM = -1;
-const int LLC_WAYS = 2047;
-
-//docker container中的服务线程数的偏移
-//mysql类型负载，线程数会多54，包括AM的线程等
-//这个值可能根据不同的在线任务而变化
-const int TASKS_OFFSET = -54;
+/**
+ * Tenant configuration file of isolation controller (-c)
+ */
+static const char *sel_tenant_config = NULL;
 //中断监视循环
 volatile sig_atomic_t stop_loop = 0;
 static void my_handler(int sig){ // can be called asynchronously
@@ -616,12 +610,6 @@ static void print_help(const int is_long)
                 printf(help_printf_long);
 }
 
-void init_cores(){
-    for(int i=0;i<CORE_NUMS;i++){
-        ALL_CORES[i] = 0;
-    }
-}
-
 static struct option long_cmd_opts[] = {
         {"help",            no_argument,       0, 'h'},
         {"log-file",        required_argument, 0, 'l'},
@@ -648,6 +636,32 @@ static struct option long_cmd_opts[] = {
         {0, 0, 0, 0} /* end */
 };
 
+static const char muses_help[] =
+        "Usage: %s [-p PID] [-c FILE] [-n N] [-i]\n"
+        "       %s --dump=FILE\n"
+        "  -p PID                      add PID to the online cgroups\n"
+        "  -c FILE                     load tenant groups from FILE\n"
+        "  -i                          start the isolation controller\n"
+        "  -n N, --mon-interval=N      set sampling interval to Nx100ms,\n"
+        "                              default 10 = 10 x 100ms = 1s.\n"
+        "                              Nms or Nus select intervals down\n"
+        "                              to 1ms.\n"
+        "  -d FILE, --dump=FILE        print binary telemetry log as csv\n"
+        "  --parallel-poll             poll L3 clusters in parallel\n"
+        "  --mon-multiplex             share RMIDs between groups in turns\n"
+        "                              when they run out\n"
+        "  --snapshot                  cache CPU topology and capabilities\n"
+        "                              in /run between starts\n";
+
+static struct option muses_cmd_opts[] = {
+        {"dump",            required_argument, 0, 'd'},
+        {"mon-interval",    required_argument, 0, 'n'},
+        {"parallel-poll",   no_argument,       0, 'P'},
+        {"mon-multiplex",   no_argument,       0, 'M'},
+        {"snapshot",        no_argument,       0, 'S'},
+        {0, 0, 0, 0} /* end */
+};
+
 const struct pqos_cpuinfo *p_cpu = NULL;
 const struct pqos_cap *p_cap = NULL;
 const struct pqos_capability *cap_mon = NULL, *cap_l3ca = NULL,
@@ -662,18 +676,57 @@ int main(int argc, char **argv)
     int opt_index = 0, pid_flag = 0;
 
     m_cmd_name = argv[0];
-    print_warning();
 
     memset(&cfg, 0, sizeof(cfg));
 
     //-p参数传入在线任务的pid，将其写入各个cgroup组的cgroup.procs，quxm add 2018.6.23
-    char *online_pid = (char*)malloc(20);
-    while ((opt = getopt(argc, argv, "p:i")) != -1)
+    const char *sel_online_pid = NULL;
+    int sel_isolation = 0;
+
+    //先解析全部参数，再统一初始化，参数顺序不影响-c和-n是否生效
+    while ((opt = getopt_long(argc, argv, "p:c:id:n:", muses_cmd_opts,
+                              NULL)) != -1)
     {
-        //printf("opt = %c\n", opt);
-        //printf("optarg = %s\n", optarg);
-        //printf("optind = %d\n", optind);
-        //printf("argv[optind - 1] = %s\n\n",  argv[optind - 1]);
+        switch (opt) {
+        case 'c':
+                //-c 多租户配置文件
+                sel_tenant_config = optarg;
+                break;
+        case 'n':
+                //-n 采样间隔，N为100ms的倍数，也可写作Nms或Nus，最小1ms
+                selfn_monitor_interval(optarg);
+                break;
+        case 'd':
+                //--dump 将二进制监控日志转换为csv输出到stdout，供训练脚本使用
+                return telemetry_dump(optarg, stdout) == 0 ?
+                        EXIT_SUCCESS : EXIT_FAILURE;
+        case 'p':
+                sel_online_pid = optarg;
+                break;
+        case 'i':
+                //开启后台动态隔离进程
+                sel_isolation = 1;
+                break;
+        case 'P':
+                //整机采样时按L3 cluster并行读取MSR
+                cfg.parallel_poll = 1;
+                break;
+        case 'M':
+                //RMID不足时各监测组轮流使用RMID，未轮到的组按上次测得的带宽外推
+                cfg.mon_multiplex = 1;
+                break;
+        case 'S':
+                //拓扑与能力缓存到/run，平台未变化时跳过发现过程
+                cfg.snapshot = 1;
+                break;
+        default:
+                printf(muses_help, m_cmd_name, m_cmd_name);
+                return EXIT_FAILURE;
+        }
+    }
+
+        //--dump的输出是csv，只在访问硬件前打印提示
+        print_warning();
         selfn_verbose_mode(NULL);
 
         cfg.verbose = sel_verbose_mode;
@@ -742,12 +795,9 @@ int main(int argc, char **argv)
                 goto error_exit_2;
         }
 
-        switch(opt)
-        {
-            case 'p':
+        if (sel_online_pid != NULL) {
                 //在线profiling组的pid
                 //以下操作为将传入的pid参数写入cpu、mem、cpuset子系统下的cgroup.procs文件内
-                sprintf(online_pid,"%.*s", strlen(optarg),optarg);
                 char *cg_cpu_procs_dir = (char*)malloc(100);
                 char *cg_mem_procs_dir = (char*)malloc(100);
                 char *cg_cpuset_procs_dir = (char*)malloc(100);
@@ -769,19 +819,28 @@ int main(int argc, char **argv)
                 }
                 //虽然pid之前已经被加入其中，并且进程存活，因此无需再次添加
                 //经过实验，即使重复添加相同pid也不会影响结果和报错，所以此处先不进行处理
-                fprintf(fp_cpu_proc,"%s",online_pid);
-                fprintf(fp_cpuset_proc,"%s",online_pid);
-                fprintf(fp_mem_proc,"%s",online_pid);
+                fprintf(fp_cpu_proc,"%s",sel_online_pid);
+                fprintf(fp_cpuset_proc,"%s",sel_online_pid);
+                fprintf(fp_mem_proc,"%s",sel_online_pid);
                 fclose(fp_cpu_proc);
                 fclose(fp_cpuset_proc);
                 fclose(fp_mem_proc);
+                //perf_event子系统用于统计在线组所有任务的指令数(monitor_loop_quxm)
+                char *cg_perf_procs_dir = (char*)malloc(100);
+                FILE *fp_perf_proc;
+                sprintf(cg_perf_procs_dir,"%s%s",CG_PERF_PREFIX,CG_CGROUP_PROC_SUFFIX);
+                fp_perf_proc = fopen(cg_perf_procs_dir,"a");
+                if (fp_perf_proc == NULL) {
+                        printf("Error : failed to open %s\n", cg_perf_procs_dir);
+                } else {
+                        fprintf(fp_perf_proc,"%s",sel_online_pid);
+                        fclose(fp_perf_proc);
+                }
+                free(cg_perf_procs_dir);
                 printf("%s\n","All cgroup.procs write complete!");
-                break;
-            case 'i':
-                //开启后台动态隔离进程
-                goto isolation_start;
         }
-    }
+        if (sel_isolation)
+                goto isolation_start;
 
         //quxm add : dynamic get cores of online cgroup
         //此处的功能为，从cpuset.cpus中读出cores，并赋值给监控项，以便监控在线组的资源使用情况
@@ -1141,7 +1200,8 @@ int main(int argc, char **argv)
         }//这里将显示样式设置为text ,sel_output_type = strdup("text");
        //printf("WAYS:%u,cache size:%u KB\n",p_cpu->l3.num_ways,p_cpu->l3.total_size/1024);
         //monitor_loop();
-        monitor_loop_quxm();
+        monitor_loop_quxm(p_cpu, CG_PERF_PREFIX, CG_CPU_PREFIX,
+                          CG_MEM_PREFIX);
         monitor_stop();
         goto error_exit_1;
 
@@ -1149,133 +1209,27 @@ int main(int argc, char **argv)
 
         //检测Ctrl_C
         signal(SIGINT, my_handler);
-        //初始化cores分配数组
-        init_cores();
-        int adjust_trigger = 0;
-        //初始化python环境
-        Py_Initialize();
-        if (!Py_IsInitialized()){
-            printf("Error : Python Init Failed.\n");
-            return -1;
-        }
-        PyRun_SimpleString("import sys");
-        PyRun_SimpleString("sys.path.append('./')");
-
-        //多维资源初始化
-        //给python预测脚本传入参数（0，0），即为初始化的参数值，默认得到90%IPS的资源值
-
-        //4维资源的划分在方法内已经执行完毕
-        get_online_cores(0,0);
-
-        printf("llcways=%d\n", OFFLINE_LLC_WAYS);
-        printf("mbapercents=%d\n", OFFLINE_MBA_PERCENT);
-
-        //提交初始化的配额，使其生效
-        isolation_submit();
-
-        //int stop_loop = 0;
-        int last_tasks = 0;
-        int cur_task_count = 0;
-        //循环体外拼接shell command
-        char *shell_command_get_tasks = (char *)malloc(300);
-        char *get_tasks_shell_dir = "./getTaskCount.sh";
-        char shellbuff[100];
-
-        strcpy(shell_command_get_tasks,get_tasks_shell_dir);
-        strcat(shell_command_get_tasks," ");
-        strcat(shell_command_get_tasks,CG_YARN_ONLINE_CPUSET);
-        printf("Get Tasks Shell Command : %s\n",shell_command_get_tasks);
 
-
-        while(!stop_loop){
-
-            //原采用文件读取方式获取tasks行数，获取子目录文件较为麻烦，已弃用
-//            char *docker_tasks_dir = (char *)malloc(200);
-//            sprintf(docker_tasks_dir,"%.*s%.*s",strlen(CG_YARN_ONLINE_CPUSET),CG_YARN_ONLINE_CPUSET,
-//                    strlen(CG_TASKS_SUFFIX),CG_TASKS_SUFFIX);
-//
-//            printf("Docker container tasks dir: %s\n",docker_tasks_dir);
-//            FILE *fp_docker_tasks;
-//
-//            cur_task_count = 0;
-//            fp_docker_tasks = fopen(docker_tasks_dir,"r");
-//            //获取tasks文件行数
-//            if(!fp_docker_tasks){
-//                printf("Error : FILE %s is null.\n",docker_tasks_dir);
-//                return -1;
-//            }
-//            while(fgets(buf_task,sizeof(buf_task),fp_docker_tasks)){
-//                cur_task_count++;
-//            }
-//
-//            free(docker_tasks_dir);
-//            fclose(fp_docker_tasks);
-
-            //shell脚本方式，获取所有在线任务的tasks数目
-
-            //1.执行shell获取tasks
-            FILE *fshellExecute_tasks=NULL;
-            memset(shellbuff,0,sizeof(shellbuff));
-            if(NULL==(fshellExecute_tasks=popen(shell_command_get_tasks,"r")))
-            {
-                fprintf(stderr,"Error : Execute Online command failed: %s",strerror(errno));
-            }
-
-            if(NULL!=fgets(shellbuff, sizeof(shellbuff), fshellExecute_tasks)) {
-                //printf("%s",shellbuff);
-                cur_task_count = atoi(shellbuff);
-            }
-            pclose(fshellExecute_tasks);
-
-            if(cur_task_count == 0){
-                printf("Warning : Docker Container doesn't exit!\n");
-            }
-
-            //2.判断tasks值是否波动，如果波动，则触发 动态配额调节
-            if(cur_task_count != last_tasks){
-                printf("Info : Tasks count changed. Pre is %d, Cur is %d.\n",last_tasks,cur_task_count);
-
-                //两轮tasks数量相差5以上时，再进行调节，5以内的线程波动，默认为可以不进行新的调节
-                //保证现有的task+offset的结果是大于10的，否则已开启的线程数太少，无需调节配额
-                //task波动过程中，不触发调节，只把trigger置1，当tasks稳定后，再进行调节
-                if(abs(cur_task_count - last_tasks) > 5 && (cur_task_count + TASKS_OFFSET) > 10){
-                    adjust_trigger = 1;
-                }
-
-            }
-            else{
-                if(adjust_trigger == 0){
-                    printf("Info : Tasks count remains unchanged. Cur is %d. Keep monitoring ......\n",cur_task_count);
-                }
-                else{
-                    //触发新一轮的动态调节
-                    printf("Info : The load is stable now. Cur is %d. \n",cur_task_count);
-                    printf("Info : Dynamic quota adjustment begins ......\n");
-
-                    //调用python预测得到新配额
-                    init_cores();
-
-                    get_online_cores(0,cur_task_count + TASKS_OFFSET);
-                    //执行调节操作
-                    //配额，使其生效
-                    isolation_submit();
-                    //置0
-                    adjust_trigger = 0;
-                    printf("Info : Dynamic quota adjustment success.\n");
-                }
-            }
-            last_tasks = cur_task_count;
-            if(stop_loop){
-                break;
-            }
-            //sleep 2s
-            usleep(2000000);
+        //加载多租户配置，未指定-c时使用默认的一个在线组和一个离线组
+        struct tenant_config tenants;
+
+        if (sel_tenant_config != NULL)
+                ret = tenant_config_load(sel_tenant_config, &tenants);
+        else
+                ret = tenant_config_default(&tenants, CG_YARN_ONLINE_CPUSET,
+                                            CG_YARN_OFFLINE_CPUSET,
+                                            QUOTA_MODEL_FILE);
+        if (ret != 0) {
+                printf("Error : Invalid tenant configuration.\n");
+                return -1;
         }
 
-        Py_Finalize();
+        //按各组负载动态调节配额，直到收到Ctrl_C
+        ret = controller_run(&tenants, p_cpu, cap_l3ca, cap_mba, &stop_loop);
+        tenant_config_free(&tenants);
         printf("\nMuses Isolation is shutting down.\n");
 
-        return 0;
+        return ret;
 
     allocation_exit:
 
@@ -1310,261 +1264,6 @@ int main(int argc, char **argv)
         return exit_val;
 }
 
-void isolation_submit(){
-
-    //Online and Offline : change cores
-    //所有子文件夹都要改才能生效
-    //调用update_cpus.sh
-    //文件访问的方式已经弃用，采用调用shell脚本对整个子目录的所有cpuset.cpus进行修改
-//    char *docker_cpus_dir = (char *)malloc(200);
-//    char *lxc_cpus_dir = (char *)malloc(200);
-    char *shell_command_online_cpus = (char *)malloc(300);
-    char *shell_command_offline_cpus = (char *)malloc(300);
-    char *update_cpu_shell_dir = "./update_cpus.sh";
-
-
-    //文件访问的方式已经弃用，采用调用shell脚本对整个子目录的所有cpuset.cpus进行修改
-//    sprintf(docker_cpus_dir,"%.*s%.*s",strlen(CG_YARN_ONLINE_CPUSET),CG_YARN_ONLINE_CPUSET,
-//            strlen(CG_CPUSET_CPUS_SUFFIX),CG_CPUSET_CPUS_SUFFIX);
-//
-//    sprintf(lxc_cpus_dir,"%.*s%.*s",strlen(CG_YARN_OFFLINE_CPUSET),CG_YARN_OFFLINE_CPUSET,
-//            strlen(CG_CPUSET_CPUS_SUFFIX),CG_CPUSET_CPUS_SUFFIX);
-
-
-    //文件访问的方式已经弃用，采用调用shell脚本对整个子目录的所有cpuset.cpus进行修改
-//    FILE *fp_docker_cpus,*fp_lxc_cpus;
-//    fp_docker_cpus = fopen(docker_cpus_dir,"a");
-//    fp_lxc_cpus = fopen(lxc_cpus_dir,"a");
-
-    char *online_cores = (char *)malloc(200);
-    char *offline_cores = (char *)malloc(200);
-    char *tmp_online_core = (char *)malloc(100);
-    char *tmp_offline_core = (char *)malloc(100);
-    strcpy(online_cores,"");
-    strcpy(offline_cores,"");
-
-
-    for(int i=0;i<CORE_NUMS;i++){
-        if(ALL_CORES[i] == 1){
-            sprintf(tmp_online_core,"%d,",i);
-            strcat(online_cores,tmp_online_core);
-        }
-        else{
-            sprintf(tmp_offline_core,"%d,",i);
-            strcat(offline_cores,tmp_offline_core);
-        }
-    }
-//    printf("Info ：Online cores are %s\n",online_cores);
-//    printf("Info ：Offline cores are %s\n",offline_cores);
-
-    //拼接command
-    strcpy(shell_command_online_cpus,update_cpu_shell_dir);
-    strcat(shell_command_online_cpus," ");
-    strcat(shell_command_online_cpus,CG_YARN_ONLINE_CPUSET);
-    strcat(shell_command_online_cpus," ");
-    strcat(shell_command_online_cpus,online_cores);
-
-    strcpy(shell_command_offline_cpus,update_cpu_shell_dir);
-    strcat(shell_command_offline_cpus," ");
-    strcat(shell_command_offline_cpus,CG_YARN_OFFLINE_CPUSET);
-    strcat(shell_command_offline_cpus," ");
-    strcat(shell_command_offline_cpus,offline_cores);
-
-    printf("Online shell command : %s\nOffline shell command : %s\n",shell_command_online_cpus,shell_command_offline_cpus);
-
-    //shell execute
-    FILE *fshellExecute_online=NULL;
-    char buff[1024];
-    memset(buff,0,sizeof(buff));
-    if(NULL==(fshellExecute_online=popen(shell_command_online_cpus,"r")))
-    {
-        fprintf(stderr,"Error : Execute Online command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buff, sizeof(buff), fshellExecute_online)) {
-        printf("%s",buff);
-    }
-    pclose(fshellExecute_online);
-
-    FILE *fshellExecute_offline=NULL;
-    memset(buff,0,sizeof(buff));
-    if(NULL==(fshellExecute_offline=popen(shell_command_offline_cpus,"r")))
-    {
-        fprintf(stderr,"Error : Execute Offline command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buff, sizeof(buff), fshellExecute_offline)) {
-        printf("%s",buff);
-    }
-    pclose(fshellExecute_offline);
-
-
-
-//    fprintf(fp_docker_cpus,"%s",online_cores);
-//    fprintf(fp_lxc_cpus,"%s",offline_cores);
-//
-//
-//    fclose(fp_docker_cpus);
-//    fclose(fp_lxc_cpus);
-
-
-    //LLC && MBA
-
-    char *pqos_a_command1 = (char *)malloc(300);
-    char *pqos_a_command2 = (char *)malloc(300);
-    char *pqos_a_prefix = "./pqos -a \"";
-    char *pqos_e_prefix = "./pqos -e \"";
-    char *pqos_e_command_llc = (char *)malloc(200);
-    char *pqos_e_command_mba = (char *)malloc(200);
-
-    char *llc_flag_cos1 = "llc:1=";
-    char *llc_flag_cos2 = "llc:2=";
-    char *mba_flag_cos1 = "mba:1=";
-    char *mba_flag_cos2 = "mba:2=";
-
-    char *allocation_1 = (char *)malloc(200);
-    char *allocation_2 = (char *)malloc(200);
-
-    char *pqos_e_llc2 = (char *)malloc(200);
-    char *pqos_e_mba2 = (char *)malloc(200);
-
-
-
-    sprintf(allocation_1,"%.*s%.*s",strlen(llc_flag_cos1),llc_flag_cos1,
-            strlen(online_cores),online_cores);
-
-    sprintf(allocation_2,"%.*s%.*s",strlen(llc_flag_cos2),llc_flag_cos2,
-            strlen(offline_cores),offline_cores);
-
-    //RESET
-//    selfn_reset_alloc(NULL);
-//    switch (alloc_apply(cap_l3ca, cap_l2ca, cap_mba, p_cpu)) {
-//        case 0: /* nothing to apply */
-//            printf("%s\n","Quxm info : COS1(online) & COS2(offline) reset return 0!");
-//            break;
-//        case 1: /* new allocation config applied and all is good */
-//            //goto allocation_exit;
-//            printf("%s\n","Quxm info : COS1(online) & COS2(offline) reset complete!");
-//            break;
-//    }
-
-    //submit allocation
-    //传参调用方式弃用，换成命令行执行方法（传参在二次执行时会报错，原因暂时未知）
-
-//    selfn_allocation_assoc(allocation_1);
-//    switch (alloc_apply(cap_l3ca, cap_l2ca, cap_mba, p_cpu)) {
-//        case 0: /* nothing to apply */
-//            break;
-//        case 1: /* new allocation config applied and all is good */
-//            //goto allocation_exit;
-//            printf("%s\n","Quxm info Online_llc_group : COS1(online) setting complete!");
-//            break;
-//    }
-    strcpy(pqos_a_command1,pqos_a_prefix);
-    strcat(pqos_a_command1,allocation_1);
-    strcat(pqos_a_command1,"\"");
-    printf("%s\n",pqos_a_command1);
-
-    FILE *fshellExecute_pqosa1=NULL;
-    char buffpqos[1024];
-    memset(buffpqos,0,sizeof(buffpqos));
-    if(NULL==(fshellExecute_pqosa1=popen(pqos_a_command1,"r")))
-    {
-        fprintf(stderr,"Error : Execute pqos -a command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buffpqos, sizeof(buffpqos), fshellExecute_pqosa1)) {
-        printf("%s",buffpqos);
-    }
-    pclose(fshellExecute_pqosa1);
-
-//    selfn_allocation_assoc(allocation_2);
-//    switch (alloc_apply(cap_l3ca, cap_l2ca, cap_mba, p_cpu)) {
-//        case 0: /* nothing to apply */
-//            break;
-//        case 1: /* new allocation config applied and all is good */
-//            //goto allocation_exit;
-//            printf("%s\n","Quxm info Offline_llc_group : COS2(offline) setting complete!");
-//            break;
-//    }
-
-    strcpy(pqos_a_command2,pqos_a_prefix);
-    strcat(pqos_a_command2,allocation_2);
-    strcat(pqos_a_command2,"\"");
-    printf("%s\n",pqos_a_command2);
-
-    FILE *fshellExecute_pqosa2=NULL;
-    memset(buffpqos,0,sizeof(buffpqos));
-    if(NULL==(fshellExecute_pqosa2=popen(pqos_a_command2,"r")))
-    {
-        fprintf(stderr,"Error : Execute pqos -a command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buffpqos, sizeof(buffpqos), fshellExecute_pqosa2)) {
-        printf("%s",buffpqos);
-    }
-    pclose(fshellExecute_pqosa2);
-
-
-    //change llc & mba
-    int current_offline_llc = LLC_WAYS;
-    for(int i=0;i<ONLINE_LLC_WAYS;i++){
-        current_offline_llc = current_offline_llc >> 1;
-    }
-
-    //llc最小是1，内存带宽最小为10%
-    if(current_offline_llc < 1){
-        current_offline_llc = 1;
-    }
-    if(OFFLINE_MBA_PERCENT < 10){
-        OFFLINE_MBA_PERCENT = 10;
-    }
-
-    sprintf(pqos_e_llc2,"%.*s%d",strlen(llc_flag_cos2),llc_flag_cos2,current_offline_llc);
-    sprintf(pqos_e_mba2,"%.*s%d",strlen(mba_flag_cos2),mba_flag_cos2,OFFLINE_MBA_PERCENT);
-
-
-    strcpy(pqos_e_command_llc,pqos_e_prefix);
-    strcat(pqos_e_command_llc,pqos_e_llc2);
-    strcat(pqos_e_command_llc,"\"");
-
-    strcpy(pqos_e_command_mba,pqos_e_prefix);
-    strcat(pqos_e_command_mba,pqos_e_mba2);
-    strcat(pqos_e_command_mba,"\"");
-
-    printf("%s\n%s\n",pqos_e_command_llc,pqos_e_command_mba);
-
-    FILE *fshellExecute_pqose2llc=NULL;
-    memset(buffpqos,0,sizeof(buffpqos));
-    if(NULL==(fshellExecute_pqose2llc=popen(pqos_e_command_llc,"r")))
-    {
-        fprintf(stderr,"Error : Execute pqos -e command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buffpqos, sizeof(buffpqos), fshellExecute_pqose2llc)) {
-        printf("%s",buffpqos);
-    }
-    pclose(fshellExecute_pqose2llc);
-
-    FILE *fshellExecute_pqose2mba=NULL;
-    memset(buffpqos,0,sizeof(buffpqos));
-    if(NULL==(fshellExecute_pqose2mba=popen(pqos_e_command_mba,"r")))
-    {
-        fprintf(stderr,"Error : Execute pqos -e command failed: %s",strerror(errno));
-    }
-
-    while(NULL!=fgets(buffpqos, sizeof(buffpqos), fshellExecute_pqose2mba)) {
-        printf("%s",buffpqos);
-    }
-    pclose(fshellExecute_pqose2mba);
-
-
-    //llc
-//    selfn_allocation_class(pqos_e_llc2);
-    //memory bandwidth
-//    selfn_allocation_class(pqos_e_mba2);
-
-}
 /*
 int main(int argc, char **argv)
 {
@@ -47,17 +47,18 @@
 #include <sys/time.h>                                   /**< gettimeofday() */
 #include <time.h>                                       /**< localtime() */
 #include <fcntl.h>
+#include <errno.h>
 #include <dirent.h>                                     /**< for dir list*/
 
 #include "../lib/pqos.h"
 #include "main.h"
 #include "monitor.h"
 #include "../lib/machine.h"
-
-//add by quxm:perf need.2018.6.10
-#include <unistd.h>
-#include <sys/syscall.h>
-#include <linux/perf_event.h>
+#include "perfgroup.h"
+#include "cgstat.h"
+#include "telemetry.h"
+#include "shmring.h"
+#include "ticker.h"
 
 #define PQOS_MAX_PIDS         128
 #define PQOS_MON_EVENT_ALL    -1
@@ -136,7 +137,7 @@ static int sel_process_num = 0;
  * Maintains monitoring interval that is selected in config string for
  * monitoring L3 occupancy
  */
-static int sel_mon_interval = 10; /**< 10 = 10x100ms = 1s */
+static uint64_t sel_mon_interval_us = 1000000; /**< 1s */
 
 /**
  * Maintains TOP like output that is selected in config string for
@@ -172,11 +173,38 @@ static FILE *fp_monitor = NULL;
 
 /**
  * Quxm add 2018.6.25
- * File descriptor for writing monitored data into
- * output to csv
+ * Binary telemetry log of monitored data,
+ * "Muses --dump" converts it back to csv
+ */
+static struct telemetry_writer *tlm_output = NULL;
+const char *OUTPUT_FILE_NAME = "Muses_output.tlm";
+
+/**
+ * Columns of the telemetry log, same order as the former csv header
+ */
+static const struct telemetry_column tlm_columns[] = {
+        {"IPS(pid)",            TELEMETRY_F64},
+        {"IPS(cores)",          TELEMETRY_F64},
+        {"CPU",                 TELEMETRY_F64},
+        {"MEM(KB)",             TELEMETRY_I64},
+        {"LLC(KB)",             TELEMETRY_F64},
+        {"MemBW(%)",            TELEMETRY_I64},
+        {"Tasks",               TELEMETRY_I64},
+        {"MemBW(MB)",           TELEMETRY_F64},
+        {"CACHE_MISS(K)",       TELEMETRY_I64},
+        {"IPC(cgroup)",         TELEMETRY_F64},
+        {"LLC_MISS(K|cgroup)",  TELEMETRY_I64},
+        {"MEM_USAGE(KB)",       TELEMETRY_I64},
+        {"TIME(us)",            TELEMETRY_I64},
+        {"TIME_MONO(ns)",       TELEMETRY_I64},
+};
+
+#define TLM_NUM_COLUMNS (sizeof(tlm_columns) / sizeof(tlm_columns[0]))
+
+/**
+ * Shared memory ring the samples of every group are published to
  */
-static FILE *fp_output_csv = NULL;
-const char *OUTPUT_FILE_NAME = "Muses_output.csv";
+static struct shmring_writer *shm_output = NULL;
 
 
 /**
@@ -190,11 +218,6 @@ struct proc_stats {
         int valid; /**< marks if statisctics are fully processed */
 };
 
-/*
- * Mantains the number of cpu logical cores of the node
- */
-static int system_cores_num = 32;
-
 /**
  * Mantains single linked list implementation
  */
@@ -757,7 +780,34 @@ void selfn_monitor_time(const char *arg)
 
 void selfn_monitor_interval(const char *arg)
 {
-        sel_mon_interval = (int) strtouint64(arg);
+        const char *unit = arg;
+        uint64_t n;
+
+        ASSERT(arg != NULL);
+
+        /* N is in 100ms units, Nms and Nus select finer intervals */
+        while (isdigit((unsigned char)*unit))
+                unit++;
+        if (unit == arg) {
+                printf("Invalid monitoring interval '%s'!\n", arg);
+                exit(EXIT_FAILURE);
+        }
+        n = strtoull(arg, NULL, 10);
+        if (*unit == '\0')
+                sel_mon_interval_us = n * 100000;
+        else if (strcmp(unit, "ms") == 0)
+                sel_mon_interval_us = n * 1000;
+        else if (strcmp(unit, "us") == 0)
+                sel_mon_interval_us = n;
+        else {
+                printf("Invalid monitoring interval '%s'!\n", arg);
+                exit(EXIT_FAILURE);
+        }
+        if (sel_mon_interval_us < TICKER_MIN_PERIOD_US) {
+                printf("Monitoring interval below %uus is not supported!\n",
+                       TICKER_MIN_PERIOD_US);
+                exit(EXIT_FAILURE);
+        }
 }
 
 void selfn_monitor_top_like(const char *arg)
@@ -1943,15 +1993,64 @@ get_mon_arrays(struct pqos_mon_data ***parray1,
 }
 
 /**
- * @brief Converts microseconds into timeval structure
+ * @brief Reports ticks missed because sampling took longer than the
+ *        interval, at most once a second
+ *
+ * @param t sampling ticker
+ */
+static void
+report_missed(const struct ticker *t)
+{
+        static uint64_t last_ns = 0;
+        const uint64_t now = ticker_now_ns();
+
+        if (last_ns != 0 && now - last_ns < 1000000000ULL)
+                return;
+        last_ns = now;
+        printf("Warning : %llu of %llu sampling ticks missed, sampling "
+               "takes longer than the interval\n",
+               (unsigned long long)t->missed, (unsigned long long)t->ticks);
+}
+
+/**
+ * @brief Publishes monitored groups in shared memory ring SHMRING_NAME
+ *
+ * Groups are labelled with their cores or pid. Monitoring goes on
+ * without the ring if it cannot be created.
  *
- * @param tv pointer to timeval structure to be filled in
- * @param usec microseconds to be used to fill in \a tv
+ * @param mon_number number of monitored groups
  */
-static void usec_to_timeval(struct timeval *tv, const long usec)
+static void
+shm_output_create(const unsigned mon_number)
 {
-        tv->tv_sec = usec / 1000000L;
-        tv->tv_usec = usec % 1000000L;
+        char (*labels)[SHMRING_LABEL_LEN];
+        const char **plabels;
+        unsigned i;
+
+        labels = calloc(mon_number, sizeof(labels[0]));
+        plabels = calloc(mon_number, sizeof(plabels[0]));
+        if (labels != NULL && plabels != NULL) {
+                for (i = 0; i < mon_number; i++) {
+                        if (!process_mode())
+                                snprintf(labels[i], sizeof(labels[i]),
+                                         "cores %s",
+                                         sel_monitor_core_tab[i].desc);
+                        else
+                                snprintf(labels[i], sizeof(labels[i]),
+                                         "pid %d",
+                                         (int)sel_monitor_pid_tab[i].pid);
+                        plabels[i] = labels[i];
+                }
+                shm_output = shmring_create(SHMRING_NAME, plabels,
+                                            mon_number,
+                                            (unsigned)(sel_mon_interval_us /
+                                                       1000));
+        }
+        if (shm_output == NULL)
+                printf("Info : Samples are not shared in /dev/shm%s\n",
+                       SHMRING_NAME);
+        free(labels);
+        free(plabels);
 }
 
 /**
@@ -1970,9 +2069,10 @@ void monitor_loop(void)
 {
 #define TERM_MIN_NUM_LINES 3
 
-        const long interval =
-                (long)sel_mon_interval * 100000LL; /* interval in [us] units */
+        const long interval = (long)sel_mon_interval_us;
         struct timeval tv_start, tv_s;
+        struct ticker tick;
+        uint64_t t_prev;
         int ret = PQOS_RETVAL_OK;
         const int istty = isatty(fileno(fp_monitor));
         const int istext = !strcasecmp(sel_output_type, "text");
@@ -1991,6 +2091,7 @@ void monitor_loop(void)
 
         mon_number = get_mon_arrays(&mon_grps, &mon_data);
         display_num = mon_number;
+        shm_output_create(mon_number);
 
         /**
          * Capture ctrl-c to gracefully stop the loop
@@ -2017,7 +2118,7 @@ void monitor_loop(void)
         /**
          * Coefficient to display the data as MB / s
          */
-        const double coeff = 10.0 / (double)sel_mon_interval;
+        double coeff = 0.0;
 
         /**
          * Build the header
@@ -2029,12 +2130,19 @@ void monitor_loop(void)
 
         gettimeofday(&tv_start, NULL);
         tv_s = tv_start;
+        t_prev = ticker_now_ns();
+        if (ticker_start(&tick, (uint64_t)interval) != 0) {
+                free(mon_grps);
+                free(mon_data);
+                return;
+        }
 
         while (!stop_monitoring_loop) {
 		struct timeval tv_e;
                 struct tm *ptm = NULL;
                 unsigned i = 0;
-                long usec_start = 0, usec_end = 0, usec_diff = 0;
+                uint64_t t_now;
+                int missed;
                 char cb_time[64];
 
 		ret = pqos_mon_poll(mon_grps, mon_number);  //读出寄存器中的数值
@@ -2042,8 +2150,17 @@ void monitor_loop(void)
 		        printf("Failed to poll monitoring data!\n");
 			free(mon_grps);
 			free(mon_data);
+			ticker_stop(&tick);
 			return;
 		}
+                /* rates over the time actually elapsed between polls */
+                t_now = ticker_now_ns();
+                coeff = (t_now > t_prev) ?
+                        1e9 / (double)(t_now - t_prev) : 0.0;
+                t_prev = t_now;
+                gettimeofday(&tv_s, NULL);
+                shmring_publish(shm_output, timeval_to_usec(&tv_s),
+                                t_now, mon_grps);
 
 		memcpy(mon_data, mon_grps, mon_number * sizeof(mon_grps[0]));
 
@@ -2095,41 +2212,21 @@ void monitor_loop(void)
 
                 fflush(fp_monitor);
 
-                gettimeofday(&tv_e, NULL);
-
                 if (stop_monitoring_loop)
                         break;
 
-                /**
-                 * Calculate microseconds to the nearest measurement interval
-                 */
-                usec_start = timeval_to_usec(&tv_s);
-                usec_end = timeval_to_usec(&tv_e);
-                usec_diff = usec_end - usec_start;
-
-                if (usec_diff < interval && usec_diff > 0) {
-                        struct timespec req, rem;
-
-                        memset(&rem, 0, sizeof(rem));
-                        memset(&req, 0, sizeof(req));
-
-                        req.tv_sec = (interval - usec_diff) / 1000000L;
-                        req.tv_nsec =
-                                ((interval - usec_diff) % 1000000L) * 1000L;
-                        if (nanosleep(&req, &rem) == -1) {
-                                /**
-                                 * nanosleep() interrupted by a signal
-                                 */
-                                if (stop_monitoring_loop)
-                                        break;
-                                req = rem;
-                                memset(&rem, 0, sizeof(rem));
-                                nanosleep(&req, &rem);
-                        }
+                /* ticks are due at exact multiples of the interval */
+                while ((missed = ticker_wait(&tick)) < 0 &&
+                       errno == EINTR && !stop_monitoring_loop)
+                        ;
+                if (stop_monitoring_loop)
+                        break;
+                if (missed < 0) {
+                        printf("Failed to wait for the sampling timer!\n");
+                        break;
                 }
-
-                /* move tv_s to the next interval */
-                usec_to_timeval(&tv_s, usec_start + interval);
+                if (missed > 0)
+                        report_missed(&tick);
 
                 if (sel_timeout >= 0) {
                         gettimeofday(&tv_e, NULL);
@@ -2137,6 +2234,12 @@ void monitor_loop(void)
                                 break;
                 }
         }
+        if (tick.missed > 0)
+                printf("Info : %llu of %llu sampling ticks missed\n",
+                       (unsigned long long)tick.missed,
+                       (unsigned long long)tick.ticks);
+        ticker_stop(&tick);
+
         if (isxml)
                 fprintf(fp_monitor, "%s\n", xml_root_close);
 
@@ -2156,10 +2259,11 @@ void monitor_cleanup(void)
                 fclose(fp_monitor);
         fp_monitor = NULL;
 
-        //退出监控时关闭文件 quxm add 2018.6.25
-        if (fp_output_csv != NULL)
-            fclose(fp_output_csv);
-        fp_output_csv = NULL;
+        //退出监控时写完剩余样本并关闭日志 quxm add 2018.6.25
+        telemetry_close(tlm_output);
+        tlm_output = NULL;
+        shmring_destroy(shm_output);
+        shm_output = NULL;
 
         /**
          * Free allocated memory
@@ -2172,26 +2276,22 @@ void monitor_cleanup(void)
         sel_output_type = NULL;
 }
 
-//add by quxm:use for getting ipc.2018.6.10
-static long
-perf_event_open(struct perf_event_attr *hw_event, pid_t pid,
-                int cpu, int group_fd, unsigned long flags)
-{
-    int ret;
-
-    ret = syscall(__NR_perf_event_open, hw_event, pid, cpu,
-                  group_fd, flags);
-    return ret;
-}
-
-void monitor_loop_quxm(void)
+void monitor_loop_quxm(const struct pqos_cpuinfo *cpu_info,
+                       const char *perf_cgroup,
+                       const char *cpuacct_cgroup,
+                       const char *memory_cgroup)
 {
 #define TERM_MIN_NUM_LINES 3
 
         //quxm comments: interval = 10 * 10^5 us = 1s
-        const long interval =
-                (long)sel_mon_interval * 100000LL; /* interval in [us] units */
+        const long interval = (long)sel_mon_interval_us;
+        const uint64_t print_every = interval < 100000 ?
+                (uint64_t)(100000 / interval) : 1;
+        uint64_t samples = 0;
+        int show = 1;
         struct timeval tv_start, tv_s;
+        struct ticker tick;
+        uint64_t t_prev;
         int ret = PQOS_RETVAL_OK;
         //是否输出到csv文件，1开启，0关闭，quxm add 2018.6.25
         const int to_csv = 1;
@@ -2202,84 +2302,91 @@ void monitor_loop_quxm(void)
 
         mon_number = get_mon_arrays(&mon_grps, &mon_data);
         display_num = mon_number;
+        memset(&tick, 0, sizeof(tick));
+        tick.fd = -1;
+        //每个周期的样本同时发布到/dev/shm，其他进程无需再读计数器
+        shm_output_create(mon_number);
 
-        //如果输出到csv文件，先创建文件,每次创建新文件进行写入,如果存在则覆盖  quxm add 2018.6.25
+        //输出到二进制日志，追加写入，重启不丢历史；超过64MB或1天轮转，保留8个  quxm add 2018.6.25
         if(to_csv)
         {
-            fp_output_csv = fopen(OUTPUT_FILE_NAME,"w+");
-            //header
-            fprintf(fp_output_csv,"%s,%s,%s,%s,%s,%s,%s,%s,%s\n",
-                    "IPS(pid)","IPS(cores)","CPU","MEM(KB)","LLC(KB)","MemBW(%)","Tasks","MemBW(MB)","CACHE_MISS(K)");
+            struct telemetry_options tlm_opt;
+
+            tlm_opt.max_bytes = 64ULL << 20;
+            tlm_opt.max_age_s = 24 * 3600;
+            tlm_opt.keep = 8;
+            tlm_opt.compress = 1;
+            tlm_output = telemetry_open(OUTPUT_FILE_NAME, tlm_columns,
+                                        TLM_NUM_COLUMNS, &tlm_opt);
         }
 
-        //quxm add:get online_group pid.2018.6.10
-        FILE *fp_pid;
-        char buf_online[32];
-        int online_pid;
-        //目前的实现只读取了一个进程，之后要扩展到读取多进程号
-        fp_pid = fopen("/sys/fs/cgroup/cpu,cpuacct/mysql_test/cgroup.procs","r");
-        fgets(buf_online, sizeof(buf_online),fp_pid);
-        sscanf(buf_online,"%d",&online_pid);
-        printf("Quxm info online_pid:%d\n",online_pid);
-        mon_grps[0]->perf_pid_ipc_enable = online_pid;
-        mon_data[0]->perf_pid_ipc_enable = online_pid;
-        fclose(fp_pid);
-        //add by quxm:use perf_event_open to get ipc based on pid.2018.6.10
-        struct perf_event_attr pe;
-
-        memset(&pe, 0, sizeof(struct perf_event_attr));
-        pe.type = PERF_TYPE_HARDWARE;
-        pe.size = sizeof(struct perf_event_attr);
-        pe.config = PERF_COUNT_HW_INSTRUCTIONS;
-        pe.inherit = 1;
-        //pe.exclude_kernel = 0;
-        //pe.exclude_hv = 1;
-
-        mon_grps[0]->values.fd_ins = perf_event_open(&pe, online_pid, -1, -1, 0);
-        if (mon_grps[0]->values.fd_ins == -1) {
-            fprintf(stderr, "Getting IPC : Error opening leader %llx\n", pe.config);
-            exit(EXIT_FAILURE);
+        //在线组所有进程/线程的指令数等由perf_event cgroup统计，不再只跟踪第一个pid
+        struct perfgroup *pg = perfgroup_open(perf_cgroup, cpu_info);
+        struct perfgroup_values pg_values;
+        struct cgstat *cs = NULL;
+        struct cgstat_values cg_values;
+
+        if (pg == NULL) {
+                free(mon_grps);
+                free(mon_data);
+                return;
         }
-        ioctl(mon_grps[0]->values.fd_ins, PERF_EVENT_IOC_RESET, 0);
-        ioctl(mon_grps[0]->values.fd_ins, PERF_EVENT_IOC_ENABLE, 0);
+        memset(&pg_values, 0, sizeof(pg_values));
+        if (perfgroup_read(pg, &pg_values) != 0)
+                goto monitor_loop_quxm__exit;
 
+        //cpu、内存和线程数相关文件只打开一次，每个周期用pread重新读取
+        cs = cgstat_open(cpuacct_cgroup, memory_cgroup);
+        if (cs == NULL)
+                goto monitor_loop_quxm__exit;
 
     /**
      * Capture ctrl-c to gracefully stop the loop
      */
         if (signal(SIGINT, monitoring_ctrlc) == SIG_ERR)
                 printf("Failed to catch SIGINT!\n");
-        //else
-        //{
-            //quxm add :close perf_event_open for ipc.2018.6.10
-            //ioctl(mon_grps[0]->values.fd_ins, PERF_EVENT_IOC_DISABLE, 0);
-            //close(mon_grps[0]->values.fd_ins);
-        //}
         if (signal(SIGHUP, monitoring_ctrlc) == SIG_ERR)
                 printf("Failed to catch SIGHUP!\n");
 
         /**
          * Coefficient to display the data as MB / s
          */
-        const double coeff = 10.0 / (double)sel_mon_interval;
+        double coeff = 0.0;
 
         gettimeofday(&tv_start, NULL);
         tv_s = tv_start;
+        t_prev = ticker_now_ns();
+        if (ticker_start(&tick, (uint64_t)interval) != 0) {
+                goto monitor_loop_quxm__exit;
+        }
 
         while (!stop_monitoring_loop) {
                 struct timeval tv_e;
                 struct tm *ptm = NULL;
                 unsigned i = 0;
-                long usec_start = 0, usec_end = 0, usec_diff = 0;
+                uint64_t t_now;
+                int missed;
                 char cb_time[64];
 
                 ret = pqos_mon_poll(mon_grps, mon_number);  //读出寄存器中的数值
                 if (ret != PQOS_RETVAL_OK) {
                         printf("Failed to poll monitoring data!\n");
-                        free(mon_grps);
-                        free(mon_data);
-                        return;
+                        break;
                 }
+                if (perfgroup_read(pg, &pg_values) != 0 ||
+                    cgstat_read(cs, &cg_values) != 0)
+                        break;
+                //按两次采样间实际经过的时间计算速率，与定时器抖动无关
+                t_now = ticker_now_ns();
+                coeff = (t_now > t_prev) ?
+                        1e9 / (double)(t_now - t_prev) : 0.0;
+                t_prev = t_now;
+                gettimeofday(&tv_s, NULL);
+                show = (samples++ % print_every) == 0;
+                mon_grps[0]->values.ipc_retired_delta_pid =
+                        pg_values.delta[PERFGROUP_INSTRUCTIONS];
+                mon_grps[0]->values.ipc_retired_pid =
+                        pg_values.value[PERFGROUP_INSTRUCTIONS];
 
                 memcpy(mon_data, mon_grps, mon_number * sizeof(mon_grps[0]));
 
@@ -2318,159 +2425,89 @@ void monitor_loop_quxm(void)
                     uint64_t val = 0;
                     int retval = msr_read(mba_get_core, reg_mba, &val);
                     if (retval != MACHINE_RETVAL_OK)
-                        return ;
+                        goto monitor_loop_quxm__exit;
                     int mba_percent = (unsigned) PQOS_MBA_LINEAR_MAX - val;
 
                     //quxm add: ic(instruction count) and cycles to show
                     uint64_t ic = pv->ipc_retired_delta;
                     uint64_t ic_pid = pv->ipc_retired_delta_pid;
                     uint64_t cycles = pv->ipc_unhalted_delta;
-
-                    if(1)
-                    {
-                        //quxm add --cpu usage
-                        FILE *fp1,*fp2;
-                        char buf1[128],buf2[32];
-                        char cpu_name[5],user_name[6],sys_name[8];
-                        long int user,nice,sys,idle,iowait,irq,softirq,stealstolen,guest,unknown1;
-                        long int cgroup_user,cgroup_sys;
-                        long int all,use;
-                        fp1 = fopen("/proc/stat","r");
-                        if(fp1 == NULL)
-                        {
-                            perror("fopen:/proc/stat");
-                        }
-
-                        fgets(buf1, sizeof(buf1),fp1);
-                        fclose(fp1);
-                        //printf("buf1=%s",buf1);
-                        sscanf(buf1,"%s%ld%ld%ld%ld%ld%ld%ld%ld%ld%ld",&cpu_name,&user,&nice,&sys,&idle,&iowait,
-                               &irq,&softirq,&stealstolen,&guest,&unknown1);
-
-                        all = user+nice+sys+idle+iowait+irq+softirq+stealstolen+guest+unknown1;
-
-                        pv->cpu_all_delta = all - pv->cpu_all;
-                        pv->cpu_all = all;
-
-                        fp2 = fopen("/sys/fs/cgroup/cpu,cpuacct/mysql_test/cpuacct.stat","r");
-
-                        if(fp2 == NULL)
-                        {
-                            perror("/sys/fs/cgroup/cpu,cpuacct/mysql_test/cpuacct.stat");
-                        }
-                        fgets(buf2, sizeof(buf2),fp2);
-                        sscanf(buf2,"%s%ld",&user_name,&cgroup_user);
-                        memset(buf2,0,sizeof(buf2));
-                        fgets(buf2, sizeof(buf2),fp2);
-
-                        fclose(fp2);
-
-                        sscanf(buf2,"%s%ld",&sys_name,&cgroup_sys);
-                        use = cgroup_user+cgroup_sys;
-                        pv->cpu_use_delta = use - pv->cpu_use;
-                        pv->cpu_use = use;
-
-                        //quxm 这里的*32是因为有32逻辑核，同样hardcode，该结果与top命令一致
-                        if(pv->cpu_all_delta > 0)
-                            pv->cpu_usage = (double)pv->cpu_use_delta/pv->cpu_all_delta*system_cores_num;
-
-                        //quxm add --memory usage
-
-                        FILE *fp3;
-                        char buf3[32],proc_dir[64],process_id[32],mem_name[10];
-                        long int vmrss;
-                        //目前的实现只读取了一个进程，之后要扩展到读取多进程号
-                        fp3 = fopen("/sys/fs/cgroup/cpu,cpuacct/mysql_test/cgroup.procs","r");
-                        fgets(buf3, sizeof(buf3),fp3);
-                        sscanf(buf3,"%s",&process_id);
-                        fclose(fp3);
-                        proc_dir[0] = '\0';
-                        strcat(proc_dir,"/proc/");
-                        strcat(proc_dir,process_id);
-                        strcat(proc_dir,"/status");
-                        //printf("%s\n",proc_dir);
-                        fp3 = fopen(proc_dir,"r");
-                        //quxm  这里22是VmRSS所在行数，先暂时这么写，hardcode
-                        for(int i=0;i<21;i++)
-                            fgets(buf3,sizeof(buf3),fp3);
-                        fgets(buf3,sizeof(buf3),fp3);
-                        fclose(fp3);
-                        sscanf(buf3,"%s %ld",&mem_name,&vmrss);
-                        pv->mem_vmrss = vmrss;
-
-                        //quxm add --server thread counts
-                        FILE *fp_server_tasks;
-                        int count = 0;
-                        char buf_task[32];
-                        fp_server_tasks = fopen("/sys/fs/cgroup/cpu,cpuacct/mysql_test/tasks","r");
-                        //获取tasks文件行数
-                        if(!fp_server_tasks){
-                            printf("Error: FILE /sys/fs/cgroup/cpu,cpuacct/mysql_test/tasks is null.");
-                            return;
-                        }
-                        while(fgets(buf_task,sizeof(buf_task),fp_server_tasks)){
-                            count++;
-                        }
-                        pv->thread_count = count;
-                        fclose(fp_server_tasks);
-                    }
+                    //cgroup内所有任务的IPC和LLC miss，来自同一个perf event group
+                    double ipc_cg = pg_values.delta[PERFGROUP_CYCLES] ?
+                            (double)pg_values.delta[PERFGROUP_INSTRUCTIONS] /
+                            pg_values.delta[PERFGROUP_CYCLES] : 0.0;
+                    unsigned llc_miss_cg = (unsigned)
+                            (pg_values.delta[PERFGROUP_LLC_MISSES] / 1000);
+
+                    //cgroup的cpu、内存和线程数每个周期由cgstat采样一次
+                    pv->cpu_all_delta = (long)(cg_values.cpu_total - pv->cpu_all);
+                    pv->cpu_all = (long)cg_values.cpu_total;
+                    pv->cpu_use_delta = (long)(cg_values.cpu_cgroup - pv->cpu_use);
+                    pv->cpu_use = (long)cg_values.cpu_cgroup;
+                    //与top命令一致，cpu_usage为使用的逻辑核数
+                    if(pv->cpu_all_delta > 0)
+                        pv->cpu_usage = (double)pv->cpu_use_delta/pv->cpu_all_delta*cpu_info->num_cores;
+                    //整个cgroup的常驻内存，而不是单个进程的VmRSS
+                    pv->mem_vmrss = (long)(cg_values.mem_rss / 1024);
+                    pv->thread_count = (int)cg_values.tasks;
 
                         //printf("%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n","IC","Cycles","IPC","CACHE_MISS(K)",
                         //       "LLC(KB)","MBL(MB)","MBR(MB)","CPU_Usage","VmRss(KB)");
 
-                        printf("%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n","IPS(M/s|pid)","IPS(M/s|cores)","CPU_Usage","VmRss(KB)",
-                           "LLC(KB)","MemBW(%)","Tasks","MemBW(MB)","CACHE_MISS(K)");
+                        //间隔小于100ms时终端只每100ms打印一次，完整样本见日志和/dev/shm
+                        if (show)
+                        printf("%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n","IPS(M/s|pid)","IPS(M/s|cores)","CPU_Usage","VmRss(KB)",
+                           "LLC(KB)","MemBW(%)","Tasks","MemBW(MB)","CACHE_MISS(K)","IPC(cgroup)","LLC_MISS(K|cgroup)");
                         // ic/1000000表示单位为每1M个指令，interval/1000000表示单位为1秒
                         //输出由ipc改为ips，by quxm 2018.6.29
-                    double ips = (double)ic/1000000/(interval/1000000);
-                    double ips_pid = (double)ic_pid/1000000/(interval/1000000);
-                        printf("%lf\t%lf\t%.4lf\t%ld\t%.1lf\t%d\t%d\t%.2lf\t%u\n",ips_pid,ips,pv->cpu_usage,pv->mem_vmrss,
-                               llc,mba_percent,pv->thread_count,mbl+mbr,(unsigned)pv->llc_misses_delta/1000);
-                        if(to_csv && fp_output_csv!=NULL)
+                    double ips = (double)ic/1000000*coeff;
+                    double ips_pid = (double)ic_pid/1000000*coeff;
+                        if (show)
+                        printf("%lf\t%lf\t%.4lf\t%ld\t%.1lf\t%d\t%d\t%.2lf\t%u\t%.3lf\t%u\n",ips_pid,ips,pv->cpu_usage,pv->mem_vmrss,
+                               llc,mba_percent,pv->thread_count,mbl+mbr,(unsigned)pv->llc_misses_delta/1000,ipc_cg,llc_miss_cg);
+                        if(to_csv && tlm_output!=NULL)
                         {
-                            fprintf(fp_output_csv,"%lf,%lf,%.4lf,%ld,%.1lf,%d,%d,%.2lf,%u\n",ips_pid,ips,pv->cpu_usage,pv->mem_vmrss,
-                                    llc,mba_percent,pv->thread_count,mbl+mbr,(unsigned)pv->llc_misses_delta/1000);
+                            //样本只拷贝进列块，编码和写盘在写线程中完成
+                            union telemetry_value row[TLM_NUM_COLUMNS];
+
+                            row[0].f = ips_pid;
+                            row[1].f = ips;
+                            row[2].f = pv->cpu_usage;
+                            row[3].i = pv->mem_vmrss;
+                            row[4].f = llc;
+                            row[5].i = mba_percent;
+                            row[6].i = pv->thread_count;
+                            row[7].f = mbl + mbr;
+                            row[8].i = (unsigned)pv->llc_misses_delta / 1000;
+                            row[9].f = ipc_cg;
+                            row[10].i = llc_miss_cg;
+                            row[11].i = (int64_t)(cg_values.mem_usage / 1024);
+                            row[12].i = timeval_to_usec(&tv_s);
+                            //单调时钟时间戳，修改系统时间不会跳变
+                            row[13].i = (int64_t)t_now;
+                            telemetry_append(tlm_output, row);
                         }
 
                 }
+                shmring_publish(shm_output, timeval_to_usec(&tv_s),
+                                t_now, mon_grps);
 
 
-                gettimeofday(&tv_e, NULL);
-
                 if (stop_monitoring_loop)
                         break;
 
-                /**
-                 * Calculate microseconds to the nearest measurement interval
-                 */
-                usec_start = timeval_to_usec(&tv_s);
-                usec_end = timeval_to_usec(&tv_e);
-                usec_diff = usec_end - usec_start;
-
-                //quxm comments:do this when measurement time < interval(1s here)
-                if (usec_diff < interval && usec_diff > 0) {
-                        struct timespec req, rem;
-
-                        memset(&rem, 0, sizeof(rem));
-                        memset(&req, 0, sizeof(req));
-
-                        req.tv_sec = (interval - usec_diff) / 1000000L;
-                        req.tv_nsec =
-                                ((interval - usec_diff) % 1000000L) * 1000L;
-                        if (nanosleep(&req, &rem) == -1) {
-                                /**
-                                 * nanosleep() interrupted by a signal
-                                 */
-                                if (stop_monitoring_loop)
-                                        break;
-                                req = rem;
-                                memset(&rem, 0, sizeof(rem));
-                                nanosleep(&req, &rem);
-                        }
+                /* ticks are due at exact multiples of the interval */
+                while ((missed = ticker_wait(&tick)) < 0 &&
+                       errno == EINTR && !stop_monitoring_loop)
+                        ;
+                if (stop_monitoring_loop)
+                        break;
+                if (missed < 0) {
+                        printf("Failed to wait for the sampling timer!\n");
+                        break;
                 }
-
-                /* move tv_s to the next interval */
-                usec_to_timeval(&tv_s, usec_start + interval);
+                if (missed > 0)
+                        report_missed(&tick);
 
                 if (sel_timeout >= 0) {
                         gettimeofday(&tv_e, NULL);
@@ -2479,7 +2516,14 @@ void monitor_loop_quxm(void)
                 }
         }
 
-
+ monitor_loop_quxm__exit:
+        if (tick.missed > 0)
+                printf("Info : %llu of %llu sampling ticks missed\n",
+                       (unsigned long long)tick.missed,
+                       (unsigned long long)tick.ticks);
+        ticker_stop(&tick);
+        cgstat_close(cs);
+        perfgroup_close(pg);
         free(mon_grps);
         free(mon_data);
 }
@@ -133,7 +133,23 @@ void monitor_cleanup(void);
  * @brief Monitors resources and writes data into selected stream.
  */
 void monitor_loop(void);
-void monitor_loop_quxm(void);
+
+/**
+ * @brief Monitors the online group and writes its profile into csv file
+ *
+ * Instructions, cycles and LLC misses of all tasks of the online group
+ * are counted through the perf_event cgroup \a perf_cgroup, cpu time,
+ * memory and thread count are sampled from its cpuacct and memory cgroups.
+ *
+ * @param [in] cpu_info cpu information structure
+ * @param [in] perf_cgroup perf_event cgroup directory of the online group
+ * @param [in] cpuacct_cgroup cpuacct cgroup directory of the online group
+ * @param [in] memory_cgroup memory cgroup directory of the online group
+ */
+void monitor_loop_quxm(const struct pqos_cpuinfo *cpu_info,
+                       const char *perf_cgroup,
+                       const char *cpuacct_cgroup,
+                       const char *memory_cgroup);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,285 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - cgroup perf counters module
+ *
+ * Cgroup mode perf events (PERF_FLAG_PID_CGROUP) count only while a task
+ * of the cgroup runs on the cpu, so one event group per cpu covers every
+ * process and thread of the cgroup without following them by pid.
+ * Counters of a cpu form one group read with PERF_FORMAT_GROUP.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "perfgroup.h"
+
+#ifndef PERF_FLAG_FD_CLOEXEC
+#define PERF_FLAG_FD_CLOEXEC (1UL << 3)
+#endif
+
+#define PERFGROUP_READ_FORMAT (PERF_FORMAT_GROUP | \
+                               PERF_FORMAT_TOTAL_TIME_ENABLED | \
+                               PERF_FORMAT_TOTAL_TIME_RUNNING)
+
+/**
+ * Event group of one cgroup
+ */
+struct perfgroup {
+        int cgroup_fd;                  /**< cgroup directory descriptor */
+        unsigned num_cpus;              /**< number of cpus */
+        unsigned available;             /**< mask of opened events */
+        unsigned num_events;            /**< number of opened events */
+        int *fds;                       /**< PERFGROUP_NUM_EVENTS per cpu */
+};
+
+/**
+ * Layout of PERFGROUP_READ_FORMAT read() result
+ */
+struct perfgroup_read_buf {
+        uint64_t nr;
+        uint64_t time_enabled;
+        uint64_t time_running;
+        uint64_t values[PERFGROUP_NUM_EVENTS];
+};
+
+static const uint32_t m_type[PERFGROUP_NUM_EVENTS] = {
+        [PERFGROUP_INSTRUCTIONS] = PERF_TYPE_HARDWARE,
+        [PERFGROUP_CYCLES] = PERF_TYPE_HARDWARE,
+        [PERFGROUP_REF_CYCLES] = PERF_TYPE_HARDWARE,
+        [PERFGROUP_LLC_MISSES] = PERF_TYPE_HARDWARE,
+        [PERFGROUP_TASK_CLOCK] = PERF_TYPE_SOFTWARE,
+};
+
+static const uint64_t m_config[PERFGROUP_NUM_EVENTS] = {
+        [PERFGROUP_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+        [PERFGROUP_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+        [PERFGROUP_REF_CYCLES] = PERF_COUNT_HW_REF_CPU_CYCLES,
+        [PERFGROUP_LLC_MISSES] = PERF_COUNT_HW_CACHE_MISSES,
+        [PERFGROUP_TASK_CLOCK] = PERF_COUNT_SW_TASK_CLOCK,
+};
+
+static int
+perf_event_open(struct perf_event_attr *attr, int pid, int cpu,
+                int group_fd, unsigned long flags)
+{
+        return (int)syscall(__NR_perf_event_open, attr, pid, cpu,
+                            group_fd, flags);
+}
+
+/**
+ * @brief Opens event \a ev of cgroup \a pg on \a cpu
+ *
+ * @param [in] pg event group
+ * @param [in] ev event to open
+ * @param [in] cpu logical core id
+ * @param [in] leader descriptor of group leader or -1
+ *
+ * @return Event descriptor
+ * @retval -1 error
+ */
+static int
+open_event(const struct perfgroup *pg, const int ev, const unsigned cpu,
+           const int leader)
+{
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.type = m_type[ev];
+        attr.size = sizeof(attr);
+        attr.config = m_config[ev];
+        attr.read_format = PERFGROUP_READ_FORMAT;
+        attr.disabled = (leader == -1);
+
+        return perf_event_open(&attr, pg->cgroup_fd, (int)cpu, leader,
+                               PERF_FLAG_PID_CGROUP | PERF_FLAG_FD_CLOEXEC);
+}
+
+struct perfgroup *
+perfgroup_open(const char *cgroup_dir, const struct pqos_cpuinfo *cpu)
+{
+        struct perfgroup *pg;
+        unsigned i;
+        int ev;
+
+        if (cgroup_dir == NULL || cpu == NULL || cpu->num_cores == 0)
+                return NULL;
+
+        pg = calloc(1, sizeof(*pg));
+        if (pg == NULL)
+                return NULL;
+        pg->cgroup_fd = -1;
+        pg->num_cpus = cpu->num_cores;
+        pg->fds = malloc(pg->num_cpus * PERFGROUP_NUM_EVENTS *
+                         sizeof(pg->fds[0]));
+        if (pg->fds == NULL) {
+                free(pg);
+                return NULL;
+        }
+        for (i = 0; i < pg->num_cpus * PERFGROUP_NUM_EVENTS; i++)
+                pg->fds[i] = -1;
+
+        pg->cgroup_fd = open(cgroup_dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (pg->cgroup_fd == -1) {
+                printf("Error : failed to open perf_event cgroup %s: %s\n",
+                       cgroup_dir, strerror(errno));
+                goto perfgroup_open__error;
+        }
+
+        for (i = 0; i < pg->num_cpus; i++) {
+                const unsigned lcore = cpu->cores[i].lcore;
+                int *fds = &pg->fds[i * PERFGROUP_NUM_EVENTS];
+
+                for (ev = 0; ev < PERFGROUP_NUM_EVENTS; ev++) {
+                        const int first = (i == 0);
+
+                        if (!first && !(pg->available & (1U << ev)))
+                                continue;
+                        fds[ev] = open_event(pg, ev, lcore,
+                                             ev == PERFGROUP_INSTRUCTIONS ?
+                                             -1 : fds[PERFGROUP_INSTRUCTIONS]);
+                        if (fds[ev] != -1) {
+                                if (first) {
+                                        pg->available |= 1U << ev;
+                                        pg->num_events++;
+                                }
+                                continue;
+                        }
+                        /* optional events are dropped if PMU lacks them */
+                        if (first && ev != PERFGROUP_INSTRUCTIONS &&
+                            (errno == ENOENT || errno == EOPNOTSUPP ||
+                             errno == EINVAL))
+                                continue;
+                        printf("Error : failed to open perf event %d on "
+                               "cpu %u for %s: %s\n", ev, lcore,
+                               cgroup_dir, strerror(errno));
+                        goto perfgroup_open__error;
+                }
+        }
+
+        for (i = 0; i < pg->num_cpus; i++) {
+                const int leader =
+                        pg->fds[i * PERFGROUP_NUM_EVENTS +
+                                PERFGROUP_INSTRUCTIONS];
+
+                if (ioctl(leader, PERF_EVENT_IOC_RESET,
+                          PERF_IOC_FLAG_GROUP) == -1 ||
+                    ioctl(leader, PERF_EVENT_IOC_ENABLE,
+                          PERF_IOC_FLAG_GROUP) == -1) {
+                        printf("Error : failed to enable perf events of %s: "
+                               "%s\n", cgroup_dir, strerror(errno));
+                        goto perfgroup_open__error;
+                }
+        }
+        return pg;
+
+ perfgroup_open__error:
+        perfgroup_close(pg);
+        return NULL;
+}
+
+int
+perfgroup_read(struct perfgroup *pg, struct perfgroup_values *v)
+{
+        uint64_t sum[PERFGROUP_NUM_EVENTS];
+        unsigned i;
+        int ev;
+
+        if (pg == NULL || v == NULL)
+                return -1;
+
+        memset(sum, 0, sizeof(sum));
+        for (i = 0; i < pg->num_cpus; i++) {
+                struct perfgroup_read_buf buf;
+                const int leader =
+                        pg->fds[i * PERFGROUP_NUM_EVENTS +
+                                PERFGROUP_INSTRUCTIONS];
+                double scale = 1.0;
+                unsigned n = 0;
+                ssize_t ret;
+
+                ret = read(leader, &buf, sizeof(buf));
+                if (ret < (ssize_t)(3 * sizeof(uint64_t)) ||
+                    buf.nr != pg->num_events) {
+                        printf("Error : failed to read perf event group\n");
+                        return -1;
+                }
+                if (buf.time_running == 0)
+                        continue;
+                if (buf.time_running < buf.time_enabled)
+                        scale = (double)buf.time_enabled /
+                                (double)buf.time_running;
+
+                /* group members are returned in the order they were opened */
+                for (ev = 0; ev < PERFGROUP_NUM_EVENTS; ev++)
+                        if (pg->available & (1U << ev))
+                                sum[ev] += (uint64_t)((double)buf.values[n++]
+                                                      * scale);
+        }
+
+        for (ev = 0; ev < PERFGROUP_NUM_EVENTS; ev++) {
+                /* scaled estimates of a multiplexed group may go back */
+                v->delta[ev] = sum[ev] > v->value[ev] ?
+                        sum[ev] - v->value[ev] : 0;
+                v->value[ev] = sum[ev];
+        }
+        v->available = pg->available;
+        return 0;
+}
+
+void
+perfgroup_close(struct perfgroup *pg)
+{
+        unsigned i;
+
+        if (pg == NULL)
+                return;
+
+        if (pg->fds != NULL) {
+                /* close group members before their leader */
+                for (i = pg->num_cpus * PERFGROUP_NUM_EVENTS; i > 0; i--)
+                        if (pg->fds[i - 1] != -1)
+                                close(pg->fds[i - 1]);
+                free(pg->fds);
+        }
+        if (pg->cgroup_fd != -1)
+                close(pg->cgroup_fd);
+        free(pg);
+}
@@ -0,0 +1,114 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - cgroup perf counters module
+ *
+ * Counts instructions, cycles, reference cycles and LLC misses of every
+ * task of a perf_event cgroup, including tasks that join it later.
+ */
+
+#ifndef __PERFGROUP_H__
+#define __PERFGROUP_H__
+
+#include <stdint.h>
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Counters of one event group, instructions is the group leader
+ */
+enum perfgroup_event {
+        PERFGROUP_INSTRUCTIONS = 0,
+        PERFGROUP_CYCLES,
+        PERFGROUP_REF_CYCLES,
+        PERFGROUP_LLC_MISSES,
+        PERFGROUP_TASK_CLOCK,           /**< cpu time of the cgroup in ns */
+        PERFGROUP_NUM_EVENTS
+};
+
+/**
+ * Counter values of a cgroup summed over all cpus
+ */
+struct perfgroup_values {
+        uint64_t value[PERFGROUP_NUM_EVENTS]; /**< counter readings */
+        uint64_t delta[PERFGROUP_NUM_EVENTS]; /**< change since last read */
+        unsigned available;             /**< mask of opened events */
+};
+
+struct perfgroup;
+
+/**
+ * @brief Opens one event group per cpu counting tasks of \a cgroup_dir
+ *
+ * Events other than instructions that the PMU does not support are left
+ * out of the group and reported as 0.
+ *
+ * @param [in] cgroup_dir perf_event cgroup directory
+ * @param [in] cpu cpu information structure
+ *
+ * @return Pointer to the counters
+ * @retval NULL error
+ */
+struct perfgroup *perfgroup_open(const char *cgroup_dir,
+                                 const struct pqos_cpuinfo *cpu);
+
+/**
+ * @brief Reads all counters of \a pg, one read() per cpu
+ *
+ * Counts are scaled up if the kernel had to multiplex the group.
+ *
+ * @param [in] pg counters to read
+ * @param [in,out] v values, deltas are computed against previous values
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int perfgroup_read(struct perfgroup *pg, struct perfgroup_values *v);
+
+/**
+ * @brief Closes counters opened by perfgroup_open()
+ *
+ * @param [in] pg counters to close, may be NULL
+ */
+void perfgroup_close(struct perfgroup *pg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PERFGROUP_H__ */
@@ -0,0 +1,296 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - core placement module
+ *
+ * Logical cores sharing an L2 cache form a cluster, clusters sharing a
+ * socket and L3 cache form a domain. Each placement picks free clusters
+ * one by one, ranked by:
+ *  - domain: one the group fits in, holding most of its previous
+ *    clusters, with the least free space (best fit),
+ *  - ownership: held by this group before, not held by any online group
+ *    before, held by another group,
+ *  - position in the topology.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "placement.h"
+
+/**
+ * Logical cores sharing an L2 cache
+ */
+struct cluster {
+        unsigned socket;                /**< socket id */
+        unsigned l3_id;                 /**< L3 cluster id */
+        unsigned l2_id;                 /**< L2 cluster id */
+        unsigned domain;                /**< index of socket/L3 domain */
+        unsigned first;                 /**< first core in m_lcores */
+        unsigned num;                   /**< number of logical cores */
+        int owner;                      /**< group in current plan or -1 */
+        int prev;                       /**< group in previous plan or -1 */
+};
+
+static struct cluster *m_clusters = NULL;
+static unsigned m_num_clusters = 0;
+static unsigned m_num_domains = 0;
+
+/**
+ * Logical cores ordered by cluster
+ */
+static unsigned *m_lcores = NULL;
+
+/**
+ * Per domain scratch space of placement_take()
+ */
+static unsigned *m_dom_free = NULL;
+static unsigned *m_dom_prev = NULL;
+static unsigned *m_dom_rank = NULL;
+
+static int
+cmp_coreinfo(const void *a, const void *b)
+{
+        const struct pqos_coreinfo *x = (const struct pqos_coreinfo *)a;
+        const struct pqos_coreinfo *y = (const struct pqos_coreinfo *)b;
+
+        if (x->socket != y->socket)
+                return (x->socket > y->socket) ? 1 : -1;
+        if (x->l3_id != y->l3_id)
+                return (x->l3_id > y->l3_id) ? 1 : -1;
+        if (x->l2_id != y->l2_id)
+                return (x->l2_id > y->l2_id) ? 1 : -1;
+        return (x->lcore > y->lcore) - (x->lcore < y->lcore);
+}
+
+int placement_init(const struct pqos_cpuinfo *cpu)
+{
+        struct pqos_coreinfo *cores;
+        unsigned i;
+
+        if (cpu == NULL || cpu->num_cores == 0)
+                return -1;
+        placement_fini();
+
+        cores = malloc(cpu->num_cores * sizeof(cores[0]));
+        m_clusters = calloc(cpu->num_cores, sizeof(m_clusters[0]));
+        m_lcores = malloc(cpu->num_cores * sizeof(m_lcores[0]));
+        m_dom_free = malloc(cpu->num_cores * sizeof(m_dom_free[0]));
+        m_dom_prev = malloc(cpu->num_cores * sizeof(m_dom_prev[0]));
+        m_dom_rank = malloc(cpu->num_cores * sizeof(m_dom_rank[0]));
+        if (cores == NULL || m_clusters == NULL || m_lcores == NULL ||
+            m_dom_free == NULL || m_dom_prev == NULL || m_dom_rank == NULL) {
+                free(cores);
+                placement_fini();
+                return -1;
+        }
+
+        /* sorted cores make clusters and domains contiguous */
+        memcpy(cores, cpu->cores, cpu->num_cores * sizeof(cores[0]));
+        qsort(cores, cpu->num_cores, sizeof(cores[0]), cmp_coreinfo);
+
+        for (i = 0; i < cpu->num_cores; i++) {
+                const struct pqos_coreinfo *c = &cores[i];
+                struct cluster *cl = m_num_clusters ?
+                        &m_clusters[m_num_clusters - 1] : NULL;
+
+                m_lcores[i] = c->lcore;
+                if (cl != NULL && cl->socket == c->socket &&
+                    cl->l3_id == c->l3_id && cl->l2_id == c->l2_id) {
+                        cl->num++;
+                        continue;
+                }
+                if (cl == NULL || cl->socket != c->socket ||
+                    cl->l3_id != c->l3_id)
+                        m_num_domains++;
+                cl = &m_clusters[m_num_clusters++];
+                cl->socket = c->socket;
+                cl->l3_id = c->l3_id;
+                cl->l2_id = c->l2_id;
+                cl->domain = m_num_domains - 1;
+                cl->first = i;
+                cl->num = 1;
+                cl->owner = -1;
+                cl->prev = -1;
+        }
+        free(cores);
+
+        printf("Info : Placement over %u domains, %u clusters, "
+               "%u cores\n", m_num_domains, m_num_clusters,
+               cpu->num_cores);
+        return 0;
+}
+
+void placement_begin(void)
+{
+        unsigned i;
+
+        for (i = 0; i < m_num_clusters; i++) {
+                m_clusters[i].prev = m_clusters[i].owner;
+                m_clusters[i].owner = -1;
+        }
+}
+
+/**
+ * @brief Ranks domains for \a group, see the module description
+ */
+static void
+rank_domains(const int group, const unsigned need)
+{
+        unsigned i, j;
+
+        memset(m_dom_free, 0, m_num_domains * sizeof(m_dom_free[0]));
+        memset(m_dom_prev, 0, m_num_domains * sizeof(m_dom_prev[0]));
+        for (i = 0; i < m_num_clusters; i++) {
+                const struct cluster *cl = &m_clusters[i];
+
+                if (cl->owner >= 0)
+                        continue;
+                m_dom_free[cl->domain] += cl->num;
+                if (cl->prev == group)
+                        m_dom_prev[cl->domain]++;
+        }
+
+        /* m_dom_rank[] holds domains best first, insertion sorted */
+        for (i = 0; i < m_num_domains; i++) {
+                const int fit = m_dom_free[i] >= need;
+
+                for (j = i; j > 0; j--) {
+                        const unsigned d = m_dom_rank[j - 1];
+                        const int dfit = m_dom_free[d] >= need;
+
+                        if (dfit > fit)
+                                break;
+                        if (dfit == fit) {
+                                if (m_dom_prev[d] > m_dom_prev[i])
+                                        break;
+                                if (m_dom_prev[d] == m_dom_prev[i] &&
+                                    (fit ? m_dom_free[d] <= m_dom_free[i] :
+                                     m_dom_free[d] >= m_dom_free[i]))
+                                        break;
+                        }
+                        m_dom_rank[j] = m_dom_rank[j - 1];
+                }
+                m_dom_rank[j] = i;
+        }
+        /* reuse m_dom_free as domain -> rank map */
+        for (i = 0; i < m_num_domains; i++)
+                m_dom_free[m_dom_rank[i]] = i;
+}
+
+/**
+ * @brief Returns ownership rank of cluster \a cl for \a group
+ */
+static unsigned
+owner_rank(const struct cluster *cl, const int group)
+{
+        if (cl->prev == group)
+                return 0;
+        return (cl->prev < 0) ? 1 : 2;
+}
+
+unsigned placement_take(const int group, const unsigned need,
+                        const unsigned reserve, unsigned *cores)
+{
+        unsigned free_clusters = 0, taken = 0, n = 0, i;
+
+        if (cores == NULL || m_clusters == NULL || need == 0)
+                return 0;
+
+        for (i = 0; i < m_num_clusters; i++)
+                if (m_clusters[i].owner < 0)
+                        free_clusters++;
+
+        rank_domains(group, need);
+
+        while (n < need && taken + reserve < free_clusters) {
+                struct cluster *best = NULL;
+
+                for (i = 0; i < m_num_clusters; i++) {
+                        struct cluster *cl = &m_clusters[i];
+
+                        if (cl->owner >= 0)
+                                continue;
+                        if (best == NULL ||
+                            m_dom_free[cl->domain] <
+                            m_dom_free[best->domain] ||
+                            (cl->domain == best->domain &&
+                             owner_rank(cl, group) <
+                             owner_rank(best, group)))
+                                best = cl;
+                }
+                if (best == NULL)
+                        break;
+                best->owner = group;
+                memcpy(&cores[n], &m_lcores[best->first],
+                       best->num * sizeof(cores[0]));
+                n += best->num;
+                taken++;
+        }
+        return n;
+}
+
+unsigned placement_rest(unsigned *cores)
+{
+        unsigned n = 0, i;
+
+        if (cores == NULL)
+                return 0;
+        for (i = 0; i < m_num_clusters; i++) {
+                const struct cluster *cl = &m_clusters[i];
+
+                if (cl->owner >= 0)
+                        continue;
+                memcpy(&cores[n], &m_lcores[cl->first],
+                       cl->num * sizeof(cores[0]));
+                n += cl->num;
+        }
+        return n;
+}
+
+void placement_fini(void)
+{
+        free(m_clusters);
+        m_clusters = NULL;
+        free(m_lcores);
+        m_lcores = NULL;
+        free(m_dom_free);
+        m_dom_free = NULL;
+        free(m_dom_prev);
+        m_dom_prev = NULL;
+        free(m_dom_rank);
+        m_dom_rank = NULL;
+        m_num_clusters = 0;
+        m_num_domains = 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - core placement module
+ *
+ * Picks cores of online groups from the CPU topology. Cores are handed
+ * out as whole L2 clusters (physical cores with all their SMT siblings),
+ * a group is kept within one socket/L3 domain when it fits, and clusters
+ * a group held in the previous plan are preferred to limit churn.
+ */
+
+#include "pqos.h"
+
+#ifndef __PLACEMENT_H__
+#define __PLACEMENT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Builds the cluster map from \a cpu
+ *
+ * @param [in] cpu cpu information structure
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int placement_init(const struct pqos_cpuinfo *cpu);
+
+/**
+ * @brief Starts a new plan, current placement becomes the previous one
+ */
+void placement_begin(void);
+
+/**
+ * @brief Places group \a group on at least \a need logical cores
+ *
+ * The group gets whole clusters, so it may receive more than \a need
+ * logical cores. Fewer are given when only \a reserve clusters would be
+ * left for the remaining groups.
+ *
+ * @param [in] group id of the group, stable between plans
+ * @param [in] need number of logical cores requested
+ * @param [in] reserve number of clusters to keep free
+ * @param [out] cores place to store logical cores of the group
+ *
+ * @return Number of logical cores stored in \a cores
+ */
+unsigned placement_take(const int group, const unsigned need,
+                        const unsigned reserve, unsigned *cores);
+
+/**
+ * @brief Returns logical cores not placed in the current plan
+ *
+ * @param [out] cores place to store logical cores
+ *
+ * @return Number of logical cores stored in \a cores
+ */
+unsigned placement_rest(unsigned *cores);
+
+/**
+ * @brief Frees the cluster map
+ */
+void placement_fini(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PLACEMENT_H__ */
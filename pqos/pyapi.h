@@ -1,10 +0,0 @@
-#include <stdio.h>
-#include "../lib/pqos.h"
-
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-void get_online_cores(int ips,int tasks);
-int get_way_counts(int llc);
\ No newline at end of file
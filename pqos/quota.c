@@ -0,0 +1,387 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - quota planner module
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gbrt.h"
+#include "quota.h"
+
+/**
+ * Grid steps, same as init_mysql_const() in get_best_quota.py
+ */
+#define CPU_STEP        1               /**< tenths of a core */
+#define MEM_STEP        1024            /**< KB */
+#define LLC_STEP        1024            /**< KB */
+#define MEMBW_STEP      10              /**< percent */
+
+/**
+ * Default grid, the mysql one of init_mysql_const()
+ */
+static const struct quota_grid m_default_grid = {
+        .cpu_max = 60, .cpu_min = 6,
+        .mem_max = 1024 * 500, .mem_min = 10240,
+        .llc_max = 11264, .llc_min = 1024,
+        .mba_max = 100, .mba_min = 10,
+};
+
+/**
+ * Batch buffers sized for the largest batch of one cpu step of the
+ * largest grid searched so far
+ */
+static float *m_rows = NULL;
+static double *m_pred = NULL;
+static double *m_pred_llc = NULL;
+static size_t m_max_rows = 0;           /**< rows of m_rows and m_pred */
+static size_t m_max_llc = 0;            /**< entries of m_pred_llc */
+
+/**
+ * Offsets of each mem step in m_pred_llc and of each (mem, llc) step
+ * in m_pred, -1 when the step was pruned
+ */
+static int *m_llc_off = NULL;
+static int *m_bw_off = NULL;
+
+/**
+ * @brief Number of grid points walked from \a max down to (but
+ *        excluding) \a min
+ */
+static inline int
+grid_num(const int max, const int min, const int step)
+{
+        return (max > min) ? (max - min - 1) / step + 1 : 0;
+}
+
+/**
+ * @brief Cost of quota, minCost_mysql() in get_best_quota.py
+ */
+static double
+quota_cost(const double cpu, const double mem, const double llc,
+           const double membw)
+{
+        if (mem >= 20480)
+                return (cpu * 3 - 2) + (mem / 1024) + (llc / 1024) +
+                        (membw / 10);
+        return (cpu * 3 - 2) + (mem / 102.4) + llc / 1024 + membw / 10;
+}
+
+static inline double grid_cpu(const struct quota_grid *g, const int i)
+{
+        return (double)(g->cpu_max - i * CPU_STEP) / 10.0;
+}
+
+static inline double grid_mem(const struct quota_grid *g, const int i)
+{
+        return (double)(g->mem_max - i * MEM_STEP);
+}
+
+static inline double grid_llc(const struct quota_grid *g, const int i)
+{
+        return (double)(g->llc_max - i * LLC_STEP);
+}
+
+static inline double grid_membw(const struct quota_grid *g, const int i)
+{
+        return (double)(g->mba_max - i * MEMBW_STEP);
+}
+
+static inline void
+fill_row(float *row, const double cpu, const double mem, const double llc,
+         const double membw, const int tasks)
+{
+        row[0] = (float)cpu;
+        row[1] = (float)mem;
+        row[2] = (float)llc;
+        row[3] = (float)membw;
+        row[4] = (float)tasks;
+}
+
+void quota_features(const struct quota *q, const int tasks, float *row)
+{
+        fill_row(row, q->cpu, q->mem, q->llc, q->mba, tasks);
+}
+
+void quota_grid_default(struct quota_grid *grid)
+{
+        *grid = m_default_grid;
+}
+
+/**
+ * @brief Grows batch buffers to fit one cpu step of \a grid
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+reserve(const struct quota_grid *grid)
+{
+        const size_t num_mem = (size_t)grid_num(grid->mem_max, grid->mem_min,
+                                                MEM_STEP);
+        const size_t num_llc = num_mem * grid_num(grid->llc_max,
+                                                  grid->llc_min, LLC_STEP);
+        const size_t max_rows = num_llc * grid_num(grid->mba_max,
+                                                   grid->mba_min, MEMBW_STEP);
+        void *p;
+
+        if (max_rows > m_max_rows) {
+                p = realloc(m_rows, max_rows * QUOTA_NUM_FEATURES *
+                            sizeof(m_rows[0]));
+                if (p == NULL)
+                        return -1;
+                m_rows = p;
+                p = realloc(m_pred, max_rows * sizeof(m_pred[0]));
+                if (p == NULL)
+                        return -1;
+                m_pred = p;
+                m_max_rows = max_rows;
+        }
+        if (num_llc > m_max_llc) {
+                p = realloc(m_pred_llc, num_llc * sizeof(m_pred_llc[0]));
+                if (p == NULL)
+                        return -1;
+                m_pred_llc = p;
+                p = realloc(m_bw_off, num_llc * sizeof(m_bw_off[0]));
+                if (p == NULL)
+                        return -1;
+                m_bw_off = p;
+                /* a mem step has at least one llc step */
+                p = realloc(m_llc_off, num_llc * sizeof(m_llc_off[0]));
+                if (p == NULL)
+                        return -1;
+                m_llc_off = p;
+                m_max_llc = num_llc;
+        }
+        return 0;
+}
+
+int quota_init(void)
+{
+        if (reserve(&m_default_grid) != 0) {
+                quota_fini();
+                return -1;
+        }
+        return 0;
+}
+
+void quota_fini(void)
+{
+        free(m_rows);
+        m_rows = NULL;
+        free(m_pred);
+        m_pred = NULL;
+        m_max_rows = 0;
+        free(m_pred_llc);
+        m_pred_llc = NULL;
+        free(m_bw_off);
+        m_bw_off = NULL;
+        free(m_llc_off);
+        m_llc_off = NULL;
+        m_max_llc = 0;
+}
+
+struct gbrt_model *quota_model_load(const char *fname)
+{
+        struct gbrt_model *model = gbrt_load(fname);
+
+        if (model == NULL)
+                return NULL;
+        if (model->num_features != QUOTA_NUM_FEATURES) {
+                printf("Error : Model expects %u inputs, planner uses %d!\n",
+                       model->num_features, QUOTA_NUM_FEATURES);
+                gbrt_free(model);
+                return NULL;
+        }
+        printf("Info : Loaded model %s, %u trees of depth %u\n",
+               fname, model->num_trees, model->depth);
+        return model;
+}
+
+/**
+ * The search mirrors get_quota_from_ipc():
+ *
+ *   for cpu, for mem, for llc:
+ *       stop llc loop once predict(cpu, mem, llc, max membw) < IPS
+ *       for membw:
+ *           stop membw loop once predict(cpu, mem, llc, membw) < IPS
+ *           keep quota if its cost is strictly below the best one
+ *
+ * For each cpu step the predictions are computed in two batches (llc
+ * probes, then membw points) and scanned afterwards in the original order.
+ * Points whose cost cannot beat the best cost known at batch time are not
+ * predicted at all; cost grows with llc and membw so this never changes
+ * the result.
+ */
+double quota_max_ips(const struct gbrt_model *model,
+                     const struct quota_grid *grid, const int tasks)
+{
+        float row[QUOTA_NUM_FEATURES];
+        double pred = 0;
+
+        fill_row(row, grid_cpu(grid, 0), grid_mem(grid, 0),
+                 grid_llc(grid, 0), grid_membw(grid, 0), tasks);
+        gbrt_predict_batch(model, row, 1, &pred);
+        return pred;
+}
+
+int quota_search(const struct gbrt_model *model,
+                 const struct quota_grid *grid, const double ips,
+                 const int tasks, struct quota *q)
+{
+        int num_cpu, num_mem, num_llc, num_bw, ci;
+        double llc_low, membw_low, min_cost, target = ips;
+        struct quota best;
+
+        if (q == NULL || model == NULL || grid == NULL)
+                return -1;
+        num_cpu = grid_num(grid->cpu_max, grid->cpu_min, CPU_STEP);
+        num_mem = grid_num(grid->mem_max, grid->mem_min, MEM_STEP);
+        num_llc = grid_num(grid->llc_max, grid->llc_min, LLC_STEP);
+        num_bw = grid_num(grid->mba_max, grid->mba_min, MEMBW_STEP);
+        if (num_cpu == 0 || num_mem == 0 || num_llc == 0 || num_bw == 0 ||
+            reserve(grid) != 0)
+                return -1;
+        /* smallest values visited by the search */
+        llc_low = grid_llc(grid, num_llc - 1);
+        membw_low = grid_membw(grid, num_bw - 1);
+        if (target <= 0)
+                target = QUOTA_MAX_IPS_RATIO *
+                        quota_max_ips(model, grid, tasks);
+
+        best.cpu = grid_cpu(grid, 0);
+        best.mem = grid_mem(grid, 0);
+        best.llc = grid_llc(grid, 0);
+        best.mba = grid_membw(grid, 0);
+        best.ips = target;
+        min_cost = quota_cost(best.cpu, best.mem, best.llc, best.mba);
+
+        for (ci = 0; ci < num_cpu; ci++) {
+                const double cpu = grid_cpu(grid, ci);
+                unsigned n = 0;
+                int mi, li, bi;
+
+                /* batch 1: llc probes at max membw */
+                for (mi = 0; mi < num_mem; mi++) {
+                        const double mem = grid_mem(grid, mi);
+
+                        m_llc_off[mi] = -1;
+                        if (quota_cost(cpu, mem, llc_low, membw_low) >=
+                            min_cost)
+                                continue;
+                        m_llc_off[mi] = (int)n;
+                        for (li = 0; li < num_llc; li++)
+                                fill_row(&m_rows[(n++) *
+                                                 QUOTA_NUM_FEATURES],
+                                         cpu, mem, grid_llc(grid, li),
+                                         grid_membw(grid, 0), tasks);
+                }
+                if (n == 0)
+                        continue;
+                gbrt_predict_batch(model, m_rows, n, m_pred_llc);
+
+                /* batch 2: remaining membw points of passing llc probes */
+                n = 0;
+                for (mi = 0; mi < num_mem; mi++) {
+                        const double mem = grid_mem(grid, mi);
+                        int *bw_off = &m_bw_off[mi * num_llc];
+
+                        if (m_llc_off[mi] < 0)
+                                continue;
+                        for (li = 0; li < num_llc; li++) {
+                                const double llc = grid_llc(grid, li);
+
+                                bw_off[li] = -1;
+                                if (m_pred_llc[m_llc_off[mi] + li] < target)
+                                        break;
+                                if (quota_cost(cpu, mem, llc, membw_low) >=
+                                    min_cost)
+                                        continue;
+                                bw_off[li] = (int)n;
+                                for (bi = 1; bi < num_bw; bi++)
+                                        fill_row(&m_rows[(n++) *
+                                                         QUOTA_NUM_FEATURES],
+                                                 cpu, mem, llc,
+                                                 grid_membw(grid, bi), tasks);
+                        }
+                }
+                if (n > 0)
+                        gbrt_predict_batch(model, m_rows, n, m_pred);
+
+                /* scan in the original order */
+                for (mi = 0; mi < num_mem; mi++) {
+                        const double mem = grid_mem(grid, mi);
+                        const int *bw_off = &m_bw_off[mi * num_llc];
+                        const double *p_llc;
+
+                        if (m_llc_off[mi] < 0)
+                                continue;
+                        p_llc = &m_pred_llc[m_llc_off[mi]];
+                        for (li = 0; li < num_llc; li++) {
+                                const double llc = grid_llc(grid, li);
+
+                                if (p_llc[li] < target)
+                                        break;
+                                if (bw_off[li] < 0)
+                                        continue;
+                                for (bi = 0; bi < num_bw; bi++) {
+                                        const double membw =
+                                                grid_membw(grid, bi);
+                                        const double pred = (bi == 0) ?
+                                                p_llc[li] :
+                                                m_pred[bw_off[li] + bi - 1];
+                                        double cost;
+
+                                        if (pred < target)
+                                                break;
+                                        cost = quota_cost(cpu, mem, llc,
+                                                          membw);
+                                        if (cost < min_cost) {
+                                                min_cost = cost;
+                                                best.cpu = cpu;
+                                                best.mem = mem;
+                                                best.llc = llc;
+                                                best.mba = membw;
+                                        }
+                                }
+                        }
+                }
+        }
+
+        *q = best;
+        return 0;
+}
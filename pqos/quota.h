@@ -0,0 +1,170 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - quota planner module
+ *
+ * Native replacement of get_best_quota.py: finds the cheapest
+ * (cpu, mem, llc, mba) quota that keeps predicted online IPS above target.
+ */
+
+#include "gbrt.h"
+
+#ifndef __QUOTA_H__
+#define __QUOTA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Default IPS model of the online service, see export_model.py
+ */
+#define QUOTA_MODEL_FILE "Mysql_25&100_GBRT_1101.gbrt"
+
+/**
+ * Model inputs: cpu, mem, llc, membw, threads
+ */
+#define QUOTA_NUM_FEATURES 5
+
+/**
+ * Resource quota of an online group
+ */
+struct quota {
+        double cpu;                     /**< cores */
+        double mem;                     /**< memory in KB */
+        double llc;                     /**< LLC in KB */
+        double mba;                     /**< memory bandwidth in percent */
+        double ips;                     /**< IPS target the quota meets */
+};
+
+/**
+ * Default IPS target as a fraction of the max IPS the model predicts
+ */
+#define QUOTA_MAX_IPS_RATIO 0.9
+
+/**
+ * Quota search grid of one service. Every dimension is walked from
+ * max down to (but excluding) min, cpu in 0.1 core, mem and llc
+ * in 1 MB and mba in 10% steps.
+ */
+struct quota_grid {
+        int cpu_max;                    /**< tenths of a core */
+        int cpu_min;
+        int mem_max;                    /**< KB */
+        int mem_min;
+        int llc_max;                    /**< KB */
+        int llc_min;
+        int mba_max;                    /**< percent */
+        int mba_min;
+};
+
+/**
+ * @brief Allocates planner buffers
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int quota_init(void);
+
+/**
+ * @brief Frees planner buffers
+ */
+void quota_fini(void);
+
+/**
+ * @brief Fills \a grid with the default grid, the one of the mysql
+ *        service in get_best_quota.py
+ *
+ * @param [out] grid place to store the grid
+ */
+void quota_grid_default(struct quota_grid *grid);
+
+/**
+ * @brief Loads IPS model and checks it takes the planner inputs
+ *
+ * @param [in] fname model file exported by export_model.py
+ *
+ * @return Loaded model, free with gbrt_free()
+ * @retval NULL on error
+ */
+struct gbrt_model *quota_model_load(const char *fname);
+
+/**
+ * @brief Builds model inputs of quota \a q for \a tasks threads
+ *
+ * @param [in] q quota
+ * @param [in] tasks number of service threads
+ * @param [out] row place to store QUOTA_NUM_FEATURES inputs
+ */
+void quota_features(const struct quota *q, const int tasks, float *row);
+
+/**
+ * @brief Predicts IPS of \a tasks threads given the top of \a grid
+ *
+ * @param [in] model IPS model of the service
+ * @param [in] grid search grid of the service
+ * @param [in] tasks number of service threads
+ *
+ * @return Max IPS of the service
+ */
+double quota_max_ips(const struct gbrt_model *model,
+                     const struct quota_grid *grid, const int tasks);
+
+/**
+ * @brief Searches for the cheapest quota meeting IPS target
+ *
+ * Applies the same early exits as get_best_quota.get_mysql_quota(),
+ * so on the default grid with the same target the result is identical.
+ *
+ * @param [in] model IPS model of the service
+ * @param [in] grid search grid of the service
+ * @param [in] ips IPS target, 0 selects QUOTA_MAX_IPS_RATIO of
+ *             quota_max_ips() for \a tasks
+ * @param [in] tasks number of service threads
+ * @param [out] q place to store the best quota
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int quota_search(const struct gbrt_model *model,
+                 const struct quota_grid *grid, const double ips,
+                 const int tasks, struct quota *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __QUOTA_H__ */
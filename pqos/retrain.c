@@ -0,0 +1,465 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - online model retraining module
+ *
+ * The offline model is kept as it is and corrected: the refit adds
+ * RETRAIN_TREES shallow regression trees fitted, gradient boosting style,
+ * to its error on the held samples. Samples only cover quotas that were
+ * actually applied, so away from them the correction stays what the
+ * nearest trained region says and the offline model keeps the shape.
+ *
+ * The new trees are padded to the depth of the offline ones so the result
+ * is an ordinary model scored by the unchanged gbrt_predict_batch().
+ * It is handed over through an atomic pointer: the controller takes it
+ * when it is ready and never waits for a refit.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "quota.h"
+#include "retrain.h"
+
+#define RETRAIN_TREES    30             /**< trees added per refit */
+#define RETRAIN_DEPTH    3              /**< levels actually split */
+#define RETRAIN_SHRINK   0.1            /**< learning rate of new trees */
+#define RETRAIN_MIN_LEAF 8              /**< min samples per split side */
+
+/**
+ * Refit model and its summary, as published to the controller
+ */
+struct retrain_result {
+        struct gbrt_model *model;       /**< refit model */
+        struct retrain_fit fit;         /**< refit summary */
+};
+
+/**
+ * One sample projected on a feature, for split search
+ */
+struct split_point {
+        float v;                        /**< feature value */
+        double r;                       /**< remaining IPS error */
+};
+
+struct retrain {
+        struct gbrt_model *base;        /**< offline model */
+        unsigned period_s;              /**< refit period */
+        unsigned nf;                    /**< model inputs */
+
+        pthread_t thread;               /**< refit thread */
+        int started;                    /**< thread is running */
+        pthread_mutex_t lock;           /**< protects ring and stop */
+        pthread_cond_t wake;            /**< signalled on stop */
+        int stop;                       /**< thread should exit */
+
+        float *ring_x;                  /**< sample inputs, ring */
+        double *ring_ips;               /**< sample IPS, ring */
+        unsigned head;                  /**< next ring slot */
+        unsigned count;                 /**< valid ring slots */
+        uint64_t added;                 /**< samples ever added */
+
+        struct retrain_result *next;    /**< latest unclaimed refit */
+
+        /* refit thread only */
+        float *x;                       /**< sample inputs */
+        double *ips;                    /**< sample IPS */
+        double *resid;                  /**< remaining IPS error */
+        unsigned *idx;                  /**< samples ordered by node */
+        struct split_point *pts;        /**< split search buffer */
+        int32_t *feature;               /**< new trees */
+        float *threshold;
+        double *leaf;
+};
+
+/**
+ * @brief Orders split points by feature value
+ */
+static int
+cmp_point(const void *a, const void *b)
+{
+        const float x = ((const struct split_point *)a)->v;
+        const float y = ((const struct split_point *)b)->v;
+
+        return (x > y) - (x < y);
+}
+
+/**
+ * @brief Finds least squares split of samples idx[lo, hi)
+ *
+ * @param [out] f split feature
+ * @param [out] thr split threshold, samples with value <= thr go left
+ *
+ * @return 1 if a split reduces the error, 0 otherwise
+ */
+static int
+best_split(struct retrain *rt, const unsigned lo, const unsigned hi,
+           int32_t *f, float *thr)
+{
+        const unsigned n = hi - lo;
+        double sum = 0, best = 0;
+        unsigned i, k;
+        int found = 0;
+
+        if (n < 2 * RETRAIN_MIN_LEAF)
+                return 0;
+        for (i = lo; i < hi; i++)
+                sum += rt->resid[rt->idx[i]];
+
+        for (k = 0; k < rt->nf; k++) {
+                double sl = 0;
+
+                for (i = 0; i < n; i++) {
+                        const unsigned s = rt->idx[lo + i];
+
+                        rt->pts[i].v = rt->x[s * rt->nf + k];
+                        rt->pts[i].r = rt->resid[s];
+                }
+                qsort(rt->pts, n, sizeof(rt->pts[0]), cmp_point);
+
+                for (i = 0; i + 1 < n; i++) {
+                        const unsigned nl = i + 1;
+                        double gain;
+
+                        sl += rt->pts[i].r;
+                        if (nl < RETRAIN_MIN_LEAF)
+                                continue;
+                        if (n - nl < RETRAIN_MIN_LEAF)
+                                break;
+                        if (rt->pts[i].v == rt->pts[i + 1].v)
+                                continue;
+                        /* error reduction up to a constant */
+                        gain = sl * sl / nl +
+                                (sum - sl) * (sum - sl) / (n - nl);
+                        if (!found || gain > best) {
+                                best = gain;
+                                *f = (int32_t)k;
+                                *thr = rt->pts[i].v;
+                                found = 1;
+                        }
+                }
+        }
+        return found && best > sum * sum / n;
+}
+
+/**
+ * @brief Grows node \a pos of new tree \a t from samples idx[lo, hi)
+ *
+ * Levels past RETRAIN_DEPTH, and nodes that cannot be split, send every
+ * sample left and give both sides the value of the node.
+ *
+ * @param [in] mean IPS error of the parent, used by empty nodes
+ */
+static void
+grow(struct retrain *rt, const unsigned t, const unsigned pos,
+     const unsigned level, const unsigned lo, const unsigned hi,
+     double mean)
+{
+        const struct gbrt_model *base = rt->base;
+        const unsigned ni = base->num_inner;
+        int32_t f = 0;
+        float thr = INFINITY;
+        unsigned i, mid = hi;
+
+        if (hi > lo) {
+                mean = 0;
+                for (i = lo; i < hi; i++)
+                        mean += rt->resid[rt->idx[i]];
+                mean /= (hi - lo);
+        }
+
+        if (level == base->depth) {
+                const double v = RETRAIN_SHRINK * mean;
+
+                /* prediction scales leaves by the offline learning rate */
+                rt->leaf[t * (ni + 1) + pos - ni] = v / base->rate;
+                for (i = lo; i < hi; i++)
+                        rt->resid[rt->idx[i]] -= v;
+                return;
+        }
+
+        if (level < RETRAIN_DEPTH && best_split(rt, lo, hi, &f, &thr)) {
+                mid = lo;
+                for (i = lo; i < hi; i++) {
+                        const unsigned s = rt->idx[i];
+
+                        if (rt->x[s * rt->nf + f] <= thr) {
+                                rt->idx[i] = rt->idx[mid];
+                                rt->idx[mid++] = s;
+                        }
+                }
+        }
+        rt->feature[t * ni + pos] = f;
+        rt->threshold[t * ni + pos] = thr;
+        grow(rt, t, 2 * pos + 1, level + 1, lo, mid, mean);
+        grow(rt, t, 2 * pos + 2, level + 1, mid, hi, mean);
+}
+
+/**
+ * @brief Root mean square of remaining IPS error of \a n samples
+ */
+static double
+rmse(const double *resid, const unsigned n)
+{
+        double sum = 0;
+        unsigned i;
+
+        for (i = 0; i < n; i++)
+                sum += resid[i] * resid[i];
+        return sqrt(sum / n);
+}
+
+/**
+ * @brief Fits new trees to \a n samples copied to rt->x and rt->ips
+ *
+ * @return Refit result
+ * @retval NULL on error
+ */
+static struct retrain_result *
+refit(struct retrain *rt, const unsigned n)
+{
+        struct retrain_result *res;
+        unsigned i, t;
+
+        res = malloc(sizeof(*res));
+        if (res == NULL)
+                return NULL;
+
+        gbrt_predict_batch(rt->base, rt->x, n, rt->resid);
+        for (i = 0; i < n; i++)
+                rt->resid[i] = rt->ips[i] - rt->resid[i];
+        res->fit.num_samples = n;
+        res->fit.rmse_base = rmse(rt->resid, n);
+
+        for (t = 0; t < RETRAIN_TREES; t++) {
+                for (i = 0; i < n; i++)
+                        rt->idx[i] = i;
+                grow(rt, t, 0, 0, 0, n, 0);
+        }
+        res->fit.rmse = rmse(rt->resid, n);
+
+        res->model = gbrt_extend(rt->base, RETRAIN_TREES, rt->feature,
+                                 rt->threshold, rt->leaf);
+        if (res->model == NULL) {
+                free(res);
+                return NULL;
+        }
+        return res;
+}
+
+/**
+ * @brief Frees refit result and its model
+ */
+static void
+result_free(struct retrain_result *res)
+{
+        if (res == NULL)
+                return;
+        gbrt_free(res->model);
+        free(res);
+}
+
+/**
+ * @brief Refit thread, wakes up every period and refits on new samples
+ */
+static void *
+retrain_main(void *arg)
+{
+        struct retrain *rt = arg;
+        uint64_t fitted = 0;
+
+        pthread_mutex_lock(&rt->lock);
+        while (!rt->stop) {
+                struct retrain_result *res;
+                struct timespec ts;
+                unsigned n, i;
+
+                clock_gettime(CLOCK_REALTIME, &ts);
+                ts.tv_sec += rt->period_s;
+                while (!rt->stop &&
+                       pthread_cond_timedwait(&rt->wake, &rt->lock,
+                                              &ts) != ETIMEDOUT)
+                        ;
+                if (rt->stop)
+                        break;
+                if (rt->added == fitted || rt->count < RETRAIN_MIN_SAMPLES)
+                        continue;
+
+                /* oldest first, the ring keeps being filled meanwhile */
+                n = rt->count;
+                for (i = 0; i < n; i++) {
+                        const unsigned s = (rt->head + RETRAIN_MAX_SAMPLES -
+                                            n + i) % RETRAIN_MAX_SAMPLES;
+
+                        memcpy(&rt->x[i * rt->nf], &rt->ring_x[s * rt->nf],
+                               rt->nf * sizeof(rt->x[0]));
+                        rt->ips[i] = rt->ring_ips[s];
+                }
+                fitted = rt->added;
+                pthread_mutex_unlock(&rt->lock);
+
+                res = refit(rt, n);
+                if (res != NULL)
+                        result_free(__atomic_exchange_n(&rt->next, res,
+                                                        __ATOMIC_ACQ_REL));
+
+                pthread_mutex_lock(&rt->lock);
+        }
+        pthread_mutex_unlock(&rt->lock);
+        return NULL;
+}
+
+struct retrain *retrain_start(const char *model_file, const unsigned period_s)
+{
+        const size_t max = RETRAIN_MAX_SAMPLES;
+        struct retrain *rt;
+        sigset_t all, old;
+        size_t ni;
+        int ret;
+
+        if (model_file == NULL || period_s == 0)
+                return NULL;
+
+        rt = calloc(1, sizeof(*rt));
+        if (rt == NULL)
+                return NULL;
+        pthread_mutex_init(&rt->lock, NULL);
+        pthread_cond_init(&rt->wake, NULL);
+        rt->period_s = period_s;
+        rt->base = quota_model_load(model_file);
+        if (rt->base == NULL)
+                goto error;
+        rt->nf = rt->base->num_features;
+        ni = rt->base->num_inner;
+
+        rt->ring_x = malloc(max * rt->nf * sizeof(rt->ring_x[0]));
+        rt->ring_ips = malloc(max * sizeof(rt->ring_ips[0]));
+        rt->x = malloc(max * rt->nf * sizeof(rt->x[0]));
+        rt->ips = malloc(max * sizeof(rt->ips[0]));
+        rt->resid = malloc(max * sizeof(rt->resid[0]));
+        rt->idx = malloc(max * sizeof(rt->idx[0]));
+        rt->pts = malloc(max * sizeof(rt->pts[0]));
+        rt->feature = malloc(RETRAIN_TREES * ni * sizeof(rt->feature[0]));
+        rt->threshold = malloc(RETRAIN_TREES * ni *
+                               sizeof(rt->threshold[0]));
+        rt->leaf = malloc(RETRAIN_TREES * (ni + 1) * sizeof(rt->leaf[0]));
+        if (rt->ring_x == NULL || rt->ring_ips == NULL || rt->x == NULL ||
+            rt->ips == NULL || rt->resid == NULL || rt->idx == NULL ||
+            rt->pts == NULL || rt->feature == NULL ||
+            rt->threshold == NULL || rt->leaf == NULL)
+                goto error;
+
+        /* signals are handled by the controller thread */
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        ret = pthread_create(&rt->thread, NULL, retrain_main, rt);
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+        if (ret != 0) {
+                printf("Error : Cannot start model refit thread!\n");
+                goto error;
+        }
+        rt->started = 1;
+        return rt;
+
+ error:
+        retrain_stop(rt);
+        return NULL;
+}
+
+void retrain_add(struct retrain *rt, const float *x, const double ips)
+{
+        if (rt == NULL || x == NULL)
+                return;
+
+        pthread_mutex_lock(&rt->lock);
+        memcpy(&rt->ring_x[rt->head * rt->nf], x,
+               rt->nf * sizeof(rt->ring_x[0]));
+        rt->ring_ips[rt->head] = ips;
+        rt->head = (rt->head + 1) % RETRAIN_MAX_SAMPLES;
+        if (rt->count < RETRAIN_MAX_SAMPLES)
+                rt->count++;
+        rt->added++;
+        pthread_mutex_unlock(&rt->lock);
+}
+
+struct gbrt_model *retrain_poll(struct retrain *rt, struct retrain_fit *fit)
+{
+        struct retrain_result *res;
+        struct gbrt_model *model;
+
+        if (rt == NULL)
+                return NULL;
+        res = __atomic_exchange_n(&rt->next, NULL, __ATOMIC_ACQ_REL);
+        if (res == NULL)
+                return NULL;
+        if (fit != NULL)
+                *fit = res->fit;
+        model = res->model;
+        free(res);
+        return model;
+}
+
+void retrain_stop(struct retrain *rt)
+{
+        if (rt == NULL)
+                return;
+
+        if (rt->started) {
+                pthread_mutex_lock(&rt->lock);
+                rt->stop = 1;
+                pthread_cond_signal(&rt->wake);
+                pthread_mutex_unlock(&rt->lock);
+                pthread_join(rt->thread, NULL);
+        }
+        result_free(rt->next);
+        gbrt_free(rt->base);
+        free(rt->ring_x);
+        free(rt->ring_ips);
+        free(rt->x);
+        free(rt->ips);
+        free(rt->resid);
+        free(rt->idx);
+        free(rt->pts);
+        free(rt->feature);
+        free(rt->threshold);
+        free(rt->leaf);
+        pthread_cond_destroy(&rt->wake);
+        pthread_mutex_destroy(&rt->lock);
+        free(rt);
+}
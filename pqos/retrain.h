@@ -0,0 +1,123 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - online model retraining module
+ *
+ * Keeps the most recent (quota, thread count) -> measured IPS samples of
+ * an online group and periodically refits the offline IPS model to them
+ * in a background thread.
+ */
+
+#ifndef __RETRAIN_H__
+#define __RETRAIN_H__
+
+#include "gbrt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETRAIN_MAX_SAMPLES 2048        /**< ring size, oldest dropped */
+#define RETRAIN_MIN_SAMPLES 60          /**< samples needed to refit */
+
+/**
+ * Busy fraction of the group's cores from which a sample is taken. The
+ * model predicts what a quota delivers to a saturated service, below it
+ * measured IPS follows the offered load instead.
+ */
+#define RETRAIN_MIN_LOAD 0.9
+
+/**
+ * Summary of one refit
+ */
+struct retrain_fit {
+        unsigned num_samples;           /**< samples fitted */
+        double rmse_base;               /**< IPS error of offline model */
+        double rmse;                    /**< IPS error of refit model */
+};
+
+struct retrain;
+
+/**
+ * @brief Loads offline model and starts refitting it
+ *
+ * Every \a period_s seconds, if samples were added since the last refit
+ * and at least RETRAIN_MIN_SAMPLES are held, boosted trees are fitted
+ * to the error of the offline model on the samples and appended to it.
+ *
+ * @param [in] model_file model exported by export_model.py
+ * @param [in] period_s refit period in seconds
+ *
+ * @return Pointer to retraining state
+ * @retval NULL on error
+ */
+struct retrain *retrain_start(const char *model_file, const unsigned period_s);
+
+/**
+ * @brief Adds one sample, replacing the oldest one when the ring is full
+ *
+ * Only samples of a saturated group, see RETRAIN_MIN_LOAD, should be
+ * added.
+ *
+ * @param [in] rt retraining state
+ * @param [in] x model inputs of the sample
+ * @param [in] ips measured IPS
+ */
+void retrain_add(struct retrain *rt, const float *x, const double ips);
+
+/**
+ * @brief Takes the latest refit model if there is a new one
+ *
+ * Does not wait for the background thread.
+ *
+ * @param [in] rt retraining state
+ * @param [out] fit optional place to store refit summary
+ *
+ * @return Refit model, owned by the caller, free with gbrt_free()
+ * @retval NULL no new model
+ */
+struct gbrt_model *retrain_poll(struct retrain *rt, struct retrain_fit *fit);
+
+/**
+ * @brief Stops the background thread and frees \a rt
+ *
+ * @param [in] rt retraining state, may be NULL
+ */
+void retrain_stop(struct retrain *rt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RETRAIN_H__ */
@@ -0,0 +1,299 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - shared memory sample ring module
+ *
+ * Single writer, any number of readers, no locks: the writer never
+ * waits for readers and readers detect a sample that changed while they
+ * copied it through the slot sequence number.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "shmring.h"
+
+#define SHMRING_MAGIC   "MUSESRB"
+#define SHMRING_VERSION 2
+#define SHMRING_ALIGN   64              /**< slots start on cache lines */
+
+struct shmring_writer {
+        char *name;                     /**< shared memory object name */
+        struct shmring_header *hdr;     /**< mapping */
+        size_t size;                    /**< size of mapping */
+};
+
+struct shmring_reader {
+        struct shmring_header *hdr;     /**< read-only mapping */
+        size_t size;                    /**< size of mapping */
+};
+
+static inline size_t align_up(const size_t v)
+{
+        return (v + SHMRING_ALIGN - 1) / SHMRING_ALIGN * SHMRING_ALIGN;
+}
+
+/**
+ * @brief Returns slot of sample \a n
+ */
+static inline struct shmring_slot *
+get_slot(struct shmring_header *hdr, const uint64_t n)
+{
+        return (struct shmring_slot *)((char *)hdr + hdr->slot_offset +
+                                       (size_t)(n % hdr->num_slots) *
+                                       hdr->slot_size);
+}
+
+struct shmring_writer *shmring_create(const char *name,
+                                      const char * const *labels,
+                                      const unsigned num_groups,
+                                      const unsigned interval_ms)
+{
+        const size_t slot_offset =
+                align_up(sizeof(struct shmring_header) +
+                         num_groups * sizeof(struct shmring_group));
+        const size_t slot_size =
+                align_up(sizeof(struct shmring_slot) +
+                         num_groups * sizeof(struct pqos_event_values));
+        struct shmring_group *groups;
+        struct shmring_writer *w;
+        void *map;
+        unsigned i;
+        int fd;
+
+        if (name == NULL || labels == NULL || num_groups == 0 ||
+            num_groups > SHMRING_MAX_GROUPS)
+                return NULL;
+
+        w = calloc(1, sizeof(*w));
+        if (w == NULL)
+                return NULL;
+        w->name = strdup(name);
+        if (w->name == NULL) {
+                free(w);
+                return NULL;
+        }
+        w->size = slot_offset + SHMRING_SLOTS * slot_size;
+
+        /* readers of an old ring keep their mapping and see it closed */
+        shm_unlink(name);
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+        if (fd < 0 || ftruncate(fd, (off_t)w->size) != 0) {
+                printf("Error : Cannot create shared memory %s!\n", name);
+                if (fd >= 0) {
+                        close(fd);
+                        shm_unlink(name);
+                }
+                free(w->name);
+                free(w);
+                return NULL;
+        }
+        map = mmap(NULL, w->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) {
+                shm_unlink(name);
+                free(w->name);
+                free(w);
+                return NULL;
+        }
+
+        /* the object is zero filled, so every slot starts at seq 0 */
+        w->hdr = map;
+        w->hdr->version = SHMRING_VERSION;
+        w->hdr->num_groups = num_groups;
+        w->hdr->num_slots = SHMRING_SLOTS;
+        w->hdr->slot_size = (uint32_t)slot_size;
+        w->hdr->slot_offset = (uint32_t)slot_offset;
+        w->hdr->value_size = sizeof(struct pqos_event_values);
+        w->hdr->interval_ms = interval_ms;
+        groups = (struct shmring_group *)(w->hdr + 1);
+        for (i = 0; i < num_groups; i++)
+                strncpy(groups[i].label, labels[i] != NULL ? labels[i] : "",
+                        SHMRING_LABEL_LEN - 1);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        memcpy(w->hdr->magic, SHMRING_MAGIC, sizeof(SHMRING_MAGIC));
+        return w;
+}
+
+void shmring_publish(struct shmring_writer *w, const uint64_t time_us,
+                     const uint64_t mono_ns,
+                     struct pqos_mon_data * const *grps)
+{
+        struct pqos_event_values *values;
+        struct shmring_slot *slot;
+        uint64_t n;
+        unsigned i;
+
+        if (w == NULL || grps == NULL)
+                return;
+
+        n = w->hdr->head;
+        slot = get_slot(w->hdr, n);
+        values = (struct pqos_event_values *)(slot + 1);
+
+        __atomic_store_n(&slot->seq, 2 * n + 1, __ATOMIC_RELAXED);
+        /* odd seq is visible before any of the new data */
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        slot->time_us = time_us;
+        slot->mono_ns = mono_ns;
+        for (i = 0; i < w->hdr->num_groups; i++)
+                values[i] = grps[i]->values;
+        __atomic_store_n(&slot->seq, 2 * n + 2, __ATOMIC_RELEASE);
+        __atomic_store_n(&w->hdr->head, n + 1, __ATOMIC_RELEASE);
+}
+
+void shmring_destroy(struct shmring_writer *w)
+{
+        if (w == NULL)
+                return;
+        __atomic_store_n(&w->hdr->closed, 1, __ATOMIC_RELEASE);
+        munmap(w->hdr, w->size);
+        shm_unlink(w->name);
+        free(w->name);
+        free(w);
+}
+
+struct shmring_reader *shmring_open(const char *name)
+{
+        struct shmring_header *hdr;
+        struct shmring_reader *r;
+        struct stat st;
+        void *map;
+        int fd;
+
+        if (name == NULL)
+                return NULL;
+        fd = shm_open(name, O_RDONLY, 0);
+        if (fd < 0)
+                return NULL;
+        if (fstat(fd, &st) != 0 ||
+            (size_t)st.st_size < sizeof(struct shmring_header)) {
+                close(fd);
+                return NULL;
+        }
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED)
+                return NULL;
+
+        hdr = map;
+        if (memcmp(hdr->magic, SHMRING_MAGIC, sizeof(SHMRING_MAGIC)) != 0 ||
+            hdr->version != SHMRING_VERSION ||
+            hdr->value_size != sizeof(struct pqos_event_values) ||
+            hdr->num_groups == 0 || hdr->num_slots == 0 ||
+            hdr->slot_size < sizeof(struct shmring_slot) +
+            hdr->num_groups * sizeof(struct pqos_event_values) ||
+            (size_t)hdr->slot_offset +
+            (size_t)hdr->num_slots * hdr->slot_size >
+            (size_t)st.st_size) {
+                munmap(map, st.st_size);
+                return NULL;
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        r = malloc(sizeof(*r));
+        if (r == NULL) {
+                munmap(map, st.st_size);
+                return NULL;
+        }
+        r->hdr = hdr;
+        r->size = st.st_size;
+        return r;
+}
+
+unsigned shmring_groups(const struct shmring_reader *r,
+                        const struct shmring_group **groups)
+{
+        if (r == NULL)
+                return 0;
+        if (groups != NULL)
+                *groups = (const struct shmring_group *)(r->hdr + 1);
+        return r->hdr->num_groups;
+}
+
+uint64_t shmring_head(const struct shmring_reader *r)
+{
+        if (r == NULL)
+                return 0;
+        return __atomic_load_n(&r->hdr->head, __ATOMIC_ACQUIRE);
+}
+
+int shmring_read(struct shmring_reader *r, const uint64_t n,
+                 uint64_t *time_us, uint64_t *mono_ns,
+                 struct pqos_event_values *values)
+{
+        const struct shmring_slot *slot;
+        uint64_t head, seq, t, mono;
+
+        if (r == NULL || values == NULL)
+                return -1;
+
+        head = shmring_head(r);
+        if (__atomic_load_n(&r->hdr->closed, __ATOMIC_ACQUIRE))
+                return -1;
+        if (n >= head)
+                return 0;
+        if (head - n > r->hdr->num_slots)
+                return -1;
+
+        slot = get_slot(r->hdr, n);
+        seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if (seq != 2 * n + 2)
+                return -1;
+        t = slot->time_us;
+        mono = slot->mono_ns;
+        memcpy(values, slot + 1,
+               r->hdr->num_groups * sizeof(struct pqos_event_values));
+        /* copy is complete before seq is checked again */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq)
+                return -1;
+        if (time_us != NULL)
+                *time_us = t;
+        if (mono_ns != NULL)
+                *mono_ns = mono;
+        return 1;
+}
+
+void shmring_close(struct shmring_reader *r)
+{
+        if (r == NULL)
+                return;
+        munmap(r->hdr, r->size);
+        free(r);
+}
@@ -0,0 +1,191 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - shared memory sample ring module
+ *
+ * The monitor publishes the event values of all its groups, once per
+ * interval, into a ring in /dev/shm. Any number of processes can read
+ * the samples without counter access and without polling the counters
+ * again.
+ */
+
+#ifndef __SHMRING_H__
+#define __SHMRING_H__
+
+#include <stdint.h>
+#include "pqos.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SHMRING_NAME      "/muses_mon"  /**< ring of the monitor */
+#define SHMRING_SLOTS     256           /**< samples kept */
+#define SHMRING_LABEL_LEN 32            /**< max group label length + 1 */
+#define SHMRING_MAX_GROUPS 1024         /**< max groups per sample */
+
+/**
+ * Shared memory layout, native byte order:
+ *
+ *   struct shmring_header
+ *   struct shmring_group [num_groups]
+ *   slots, each slot_size bytes from slot_offset:
+ *       struct shmring_slot
+ *       struct pqos_event_values [num_groups]
+ *
+ * Each slot is a seqlock: while sample n is written its seq is 2n + 1,
+ * once written 2n + 2. head is the number of samples ever published,
+ * sample n lives in slot n % num_slots.
+ */
+struct shmring_header {
+        char magic[8];                  /**< "MUSESRB", set last */
+        uint32_t version;               /**< SHMRING_VERSION */
+        uint32_t num_groups;            /**< groups per sample */
+        uint32_t num_slots;             /**< samples kept */
+        uint32_t slot_size;             /**< bytes per slot */
+        uint32_t slot_offset;           /**< offset of slot 0 */
+        uint32_t value_size;            /**< sizeof pqos_event_values */
+        uint32_t closed;                /**< writer is gone */
+        uint32_t interval_ms;           /**< sampling interval */
+        uint64_t head;                  /**< samples published */
+};
+
+struct shmring_group {
+        char label[SHMRING_LABEL_LEN];  /**< cores or pid of the group */
+};
+
+struct shmring_slot {
+        uint64_t seq;                   /**< seqlock sequence */
+        uint64_t time_us;               /**< sample time, us since epoch */
+        uint64_t mono_ns;               /**< CLOCK_MONOTONIC_RAW, ns */
+};
+
+struct shmring_writer;
+struct shmring_reader;
+
+/**
+ * @brief Creates ring \a name, replacing any earlier one
+ *
+ * @param [in] name shared memory object name, e.g. SHMRING_NAME
+ * @param [in] labels label of each group
+ * @param [in] num_groups number of groups
+ * @param [in] interval_ms sampling interval, for readers
+ *
+ * @return Pointer to writer
+ * @retval NULL on error
+ */
+struct shmring_writer *shmring_create(const char *name,
+                                      const char * const *labels,
+                                      const unsigned num_groups,
+                                      const unsigned interval_ms);
+
+/**
+ * @brief Publishes current values of \a grps as the next sample
+ *
+ * Never blocks, readers of an overwritten slot retry or skip it.
+ *
+ * @param [in] w writer
+ * @param [in] time_us sample wall-clock time
+ * @param [in] mono_ns sample time from ticker_now_ns(), not affected
+ *             by wall-clock changes
+ * @param [in] grps num_groups monitoring groups, in creation order
+ */
+void shmring_publish(struct shmring_writer *w, const uint64_t time_us,
+                     const uint64_t mono_ns,
+                     struct pqos_mon_data * const *grps);
+
+/**
+ * @brief Marks the ring closed, unmaps and removes it
+ *
+ * @param [in] w writer, may be NULL
+ */
+void shmring_destroy(struct shmring_writer *w);
+
+/**
+ * @brief Maps ring \a name read-only
+ *
+ * @return Pointer to reader
+ * @retval NULL on error, e.g. no monitor running
+ */
+struct shmring_reader *shmring_open(const char *name);
+
+/**
+ * @brief Returns group labels of the ring
+ *
+ * @param [in] r reader
+ * @param [out] groups place to store pointer to labels
+ *
+ * @return Number of groups
+ */
+unsigned shmring_groups(const struct shmring_reader *r,
+                        const struct shmring_group **groups);
+
+/**
+ * @brief Returns number of samples published so far
+ *
+ * The newest sample is the returned value minus 1.
+ */
+uint64_t shmring_head(const struct shmring_reader *r);
+
+/**
+ * @brief Copies sample \a n
+ *
+ * @param [in] r reader
+ * @param [in] n sample number
+ * @param [out] time_us optional place to store sample wall-clock time
+ * @param [out] mono_ns optional place to store sample monotonic time
+ * @param [out] values place to store num_groups values
+ *
+ * @return Operation status
+ * @retval 1 sample copied
+ * @retval 0 sample not published yet
+ * @retval -1 sample overwritten, or the writer is gone and the ring
+ *            has to be opened again
+ */
+int shmring_read(struct shmring_reader *r, const uint64_t n,
+                 uint64_t *time_us, uint64_t *mono_ns,
+                 struct pqos_event_values *values);
+
+/**
+ * @brief Unmaps ring
+ *
+ * @param [in] r reader, may be NULL
+ */
+void shmring_close(struct shmring_reader *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SHMRING_H__ */
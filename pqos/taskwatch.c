@@ -0,0 +1,572 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - task watch module
+ *
+ * Every cgroup directory of the watched tree has one inotify watch and an
+ * open descriptor of its tasks file. Writes to tasks or cgroup.procs and
+ * creation of sub-directories are reported by inotify, after which only
+ * the affected directory is re-counted. Threads created by clone() are
+ * noticed through the pids controller count of the tree.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <limits.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/inotify.h>
+
+#include "taskwatch.h"
+
+#define CGROUP_MOUNT "/sys/fs/cgroup/"
+
+#define TASKWATCH_MASK (IN_MODIFY | IN_CREATE | IN_MOVED_TO | IN_DELETE | \
+                        IN_MOVED_FROM | IN_DELETE_SELF | IN_ONLYDIR)
+
+/**
+ * Watched cgroup directory
+ */
+struct tw_dir {
+        int wd;                         /**< inotify watch descriptor */
+        int root;                       /**< index of watched tree */
+        int fd;                         /**< descriptor of tasks file */
+        int count;                      /**< threads in this directory */
+        char *path;                     /**< directory path */
+};
+
+static int m_fd = -1;
+static char *m_roots[TASKWATCH_MAX_ROOTS];
+static int m_total[TASKWATCH_MAX_ROOTS];
+static unsigned m_root_num = 0;
+static struct tw_dir *m_dirs = NULL;
+static unsigned m_dir_num = 0;
+static unsigned m_dir_cap = 0;
+static int m_pids_fd[TASKWATCH_MAX_ROOTS]; /**< pids.current or -1 */
+static long long m_pids[TASKWATCH_MAX_ROOTS]; /**< last pids.current */
+static long long m_rescan_at[TASKWATCH_MAX_ROOTS]; /**< next check */
+static unsigned m_changed = 0;
+
+/**
+ * @brief Counts threads listed in tasks file open as \a fd
+ *
+ * @return Number of threads
+ */
+static int
+count_tasks(const int fd)
+{
+        char buf[4096];
+        off_t off = 0;
+        ssize_t len, i;
+        int count = 0;
+
+        if (fd < 0)
+                return 0;
+
+        while ((len = pread(fd, buf, sizeof(buf), off)) > 0) {
+                for (i = 0; i < len; i++)
+                        if (buf[i] == '\n')
+                                count++;
+                off += len;
+        }
+        return count;
+}
+
+/**
+ * @brief Re-counts threads of directory \a d
+ */
+static void
+recount_dir(struct tw_dir *d)
+{
+        int count;
+
+        if (d->fd < 0) {
+                char file[PATH_MAX];
+
+                snprintf(file, sizeof(file), "%s/tasks", d->path);
+                d->fd = open(file, O_RDONLY | O_CLOEXEC);
+        }
+        count = count_tasks(d->fd);
+        if (count == d->count)
+                return;
+
+        m_total[d->root] += count - d->count;
+        d->count = count;
+        m_changed = 1;
+}
+
+/**
+ * @brief Finds watched directory by inotify watch descriptor
+ *
+ * @return Pointer to directory or NULL if not found
+ */
+static struct tw_dir *
+find_dir(const int wd)
+{
+        unsigned i;
+
+        for (i = 0; i < m_dir_num; i++)
+                if (m_dirs[i].wd == wd)
+                        return &m_dirs[i];
+        return NULL;
+}
+
+/**
+ * @brief Stops tracking directory \a d
+ */
+static void
+remove_dir(struct tw_dir *d)
+{
+        if (d->count != 0) {
+                m_total[d->root] -= d->count;
+                m_changed = 1;
+        }
+        if (d->fd >= 0)
+                close(d->fd);
+        free(d->path);
+        *d = m_dirs[--m_dir_num];
+}
+
+/**
+ * @brief Stops tracking \a path and all its sub-directories
+ *
+ * Used on removal reported by the parent, DELETE_SELF of the directory
+ * itself may be delayed while its tasks file is still open.
+ */
+static void
+remove_tree(const char *path)
+{
+        const size_t len = strlen(path);
+        unsigned i = 0;
+
+        while (i < m_dir_num) {
+                struct tw_dir *d = &m_dirs[i];
+
+                if (strncmp(d->path, path, len) == 0 &&
+                    (d->path[len] == '\0' || d->path[len] == '/')) {
+                        inotify_rm_watch(m_fd, d->wd);
+                        remove_dir(d);
+                } else
+                        i++;
+        }
+}
+
+/**
+ * @brief Starts tracking \a path and all its sub-directories as part
+ *        of tree \a root
+ *
+ * Directories that are already watched are only descended into, so this
+ * is safe to call again on a sub-tree after an event queue overflow.
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+add_dir(const char *path, const int root)
+{
+        struct tw_dir *d;
+        struct dirent *ent;
+        char file[PATH_MAX];
+        DIR *dir;
+        int wd;
+
+        wd = inotify_add_watch(m_fd, path, TASKWATCH_MASK);
+        if (wd < 0) {
+                /* directory removed before we got to it */
+                if (errno == ENOENT)
+                        return 0;
+                printf("Error : Cannot watch %s: %s\n", path, strerror(errno));
+                return -1;
+        }
+
+        if (find_dir(wd) == NULL) {
+                if (m_dir_num == m_dir_cap) {
+                        const unsigned cap = m_dir_cap ? m_dir_cap * 2 : 16;
+                        struct tw_dir *p;
+
+                        p = realloc(m_dirs, cap * sizeof(*p));
+                        if (p == NULL) {
+                                inotify_rm_watch(m_fd, wd);
+                                return -1;
+                        }
+                        m_dirs = p;
+                        m_dir_cap = cap;
+                }
+                d = &m_dirs[m_dir_num];
+                d->path = strdup(path);
+                if (d->path == NULL) {
+                        inotify_rm_watch(m_fd, wd);
+                        return -1;
+                }
+                d->wd = wd;
+                d->root = root;
+                d->fd = -1;
+                d->count = 0;
+                m_dir_num++;
+                recount_dir(d);
+        }
+
+        /* sub-directories created before the watch was in place */
+        dir = opendir(path);
+        if (dir == NULL)
+                return 0;
+        while ((ent = readdir(dir)) != NULL) {
+                if (ent->d_type != DT_DIR || strcmp(ent->d_name, ".") == 0 ||
+                    strcmp(ent->d_name, "..") == 0)
+                        continue;
+                snprintf(file, sizeof(file), "%s/%s", path, ent->d_name);
+                if (add_dir(file, root) != 0) {
+                        closedir(dir);
+                        return -1;
+                }
+        }
+        closedir(dir);
+        return 0;
+}
+
+/**
+ * @brief Re-counts threads of all watched directories
+ */
+static void
+recount_all(void)
+{
+        unsigned i;
+
+        for (i = 0; i < m_dir_num; i++)
+                recount_dir(&m_dirs[i]);
+}
+
+/**
+ * @brief Re-counts threads of watched directories of tree \a root
+ */
+static void
+recount_root(const int root)
+{
+        unsigned i;
+
+        for (i = 0; i < m_dir_num; i++)
+                if (m_dirs[i].root == root)
+                        recount_dir(&m_dirs[i]);
+}
+
+/**
+ * @brief Opens pids.current counting the threads of tree \a root
+ *
+ * With cgroup v2 it is in the tree itself, with cgroup v1 in the same
+ * path of the pids hierarchy.
+ *
+ * @return File descriptor
+ * @retval -1 no pids controller for the tree
+ */
+static int
+open_pids(const char *root)
+{
+        char file[PATH_MAX];
+        const char *rel;
+        int fd;
+
+        snprintf(file, sizeof(file), "%s/pids.current", root);
+        fd = open(file, O_RDONLY | O_CLOEXEC);
+        if (fd >= 0 || strncmp(root, CGROUP_MOUNT,
+                               sizeof(CGROUP_MOUNT) - 1) != 0)
+                return fd;
+
+        /* skip controller directory of the v1 hierarchy */
+        rel = strchr(root + sizeof(CGROUP_MOUNT) - 1, '/');
+        if (rel == NULL)
+                return -1;
+        snprintf(file, sizeof(file), "%spids%s/pids.current",
+                 CGROUP_MOUNT, rel);
+        return open(file, O_RDONLY | O_CLOEXEC);
+}
+
+/**
+ * @brief Reads pids.current open as \a fd
+ *
+ * @return Number of threads
+ * @retval -1 error
+ */
+static long long
+read_pids(const int fd)
+{
+        char buf[32];
+        ssize_t len;
+
+        len = pread(fd, buf, sizeof(buf) - 1, 0);
+        if (len <= 0)
+                return -1;
+        buf[len] = '\0';
+        return strtoll(buf, NULL, 10);
+}
+
+/**
+ * @brief Picks up threads created by clone() in trees due for a check
+ *
+ * Tasks files of a tree are re-read only if its pids.current changed,
+ * or every TASKWATCH_RESCAN_MS if it has none.
+ *
+ * @param [in] now current time in ms
+ *
+ * @return Time of the next check in ms
+ */
+static long long
+check_roots(const long long now)
+{
+        long long next = 0;
+        unsigned i;
+
+        for (i = 0; i < m_root_num; i++) {
+                if (now >= m_rescan_at[i]) {
+                        if (m_pids_fd[i] >= 0) {
+                                const long long pids =
+                                        read_pids(m_pids_fd[i]);
+
+                                if (pids != m_pids[i]) {
+                                        m_pids[i] = pids;
+                                        recount_root((int)i);
+                                }
+                                m_rescan_at[i] = now + TASKWATCH_PIDS_MS;
+                        } else {
+                                recount_root((int)i);
+                                m_rescan_at[i] = now + TASKWATCH_RESCAN_MS;
+                        }
+                }
+                if (next == 0 || m_rescan_at[i] < next)
+                        next = m_rescan_at[i];
+        }
+        return next;
+}
+
+/**
+ * @brief Reads and applies pending inotify events
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+handle_events(void)
+{
+        char buf[4096]
+                __attribute__((aligned(__alignof__(struct inotify_event))));
+        const struct inotify_event *ev;
+        char path[PATH_MAX];
+        struct tw_dir *d;
+        ssize_t len;
+        char *p;
+
+        len = read(m_fd, buf, sizeof(buf));
+        if (len < 0)
+                return (errno == EAGAIN) ? 0 : -1;
+
+        for (p = buf; p < buf + len; p += sizeof(*ev) + ev->len) {
+                ev = (const struct inotify_event *)(void *)p;
+
+                if (ev->mask & IN_Q_OVERFLOW) {
+                        unsigned i;
+
+                        /* events lost, walk the trees again */
+                        for (i = 0; i < m_root_num; i++)
+                                if (add_dir(m_roots[i], (int)i) != 0)
+                                        return -1;
+                        recount_all();
+                        continue;
+                }
+                d = find_dir(ev->wd);
+                if (d == NULL)
+                        continue;
+                if (ev->mask & (IN_DELETE_SELF | IN_IGNORED)) {
+                        remove_dir(d);
+                        continue;
+                }
+                if (ev->len == 0)
+                        continue;
+                if (ev->mask & IN_ISDIR) {
+                        snprintf(path, sizeof(path), "%s/%s",
+                                 d->path, ev->name);
+                        if (ev->mask & (IN_DELETE | IN_MOVED_FROM))
+                                remove_tree(path);
+                        else if ((ev->mask & (IN_CREATE | IN_MOVED_TO)) &&
+                                 add_dir(path, d->root) != 0)
+                                return -1;
+                } else if ((ev->mask & IN_MODIFY) &&
+                           (strcmp(ev->name, "tasks") == 0 ||
+                            strcmp(ev->name, "cgroup.procs") == 0))
+                        recount_dir(d);
+        }
+        return 0;
+}
+
+/**
+ * @brief Returns monotonic time in milliseconds
+ */
+static long long
+now_ms(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+int taskwatch_init(void)
+{
+        if (m_fd >= 0)
+                return 0;
+
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_fd < 0) {
+                printf("Error : inotify_init1() failed: %s\n",
+                       strerror(errno));
+                return -1;
+        }
+        return 0;
+}
+
+int taskwatch_add(const char *root)
+{
+        const int id = (int)m_root_num;
+
+        if (root == NULL || m_fd < 0 || m_root_num >= TASKWATCH_MAX_ROOTS)
+                return -1;
+
+        m_roots[id] = strdup(root);
+        if (m_roots[id] == NULL)
+                return -1;
+        m_total[id] = 0;
+        m_root_num++;
+        m_pids_fd[id] = open_pids(root);
+        m_pids[id] = m_pids_fd[id] >= 0 ? read_pids(m_pids_fd[id]) : -1;
+        m_rescan_at[id] = 0;
+        if (add_dir(root, id) != 0) {
+                unsigned i = 0;
+
+                /* drop watches added so far and release the slot */
+                while (i < m_dir_num)
+                        if (m_dirs[i].root == id) {
+                                inotify_rm_watch(m_fd, m_dirs[i].wd);
+                                remove_dir(&m_dirs[i]);
+                        } else
+                                i++;
+                if (m_pids_fd[id] >= 0)
+                        close(m_pids_fd[id]);
+                m_pids_fd[id] = -1;
+                free(m_roots[id]);
+                m_roots[id] = NULL;
+                m_total[id] = 0;
+                m_root_num--;
+                return -1;
+        }
+
+        printf("Info : Watching %s, %d tasks\n", root, m_total[id]);
+        return id;
+}
+
+int taskwatch_wait(const int timeout_ms)
+{
+        const long long start = now_ms();
+        struct pollfd pfd;
+        int ret;
+
+        if (m_fd < 0)
+                return -1;
+
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+        m_changed = 0;
+        for (;;) {
+                /* threads created by clone(), see TASKWATCH_PIDS_MS */
+                const long long next = check_roots(now_ms());
+                const long long now = now_ms();
+                long long wait = -1;
+
+                if (m_changed)
+                        return 1;
+
+                if (next > 0)
+                        wait = next > now ? next - now : 0;
+                if (timeout_ms >= 0 &&
+                    (wait < 0 || timeout_ms - (now - start) < wait))
+                        wait = timeout_ms - (now - start);
+                if (wait < -1)
+                        wait = 0;
+
+                ret = poll(&pfd, 1, (int)wait);
+                if (ret < 0)
+                        return -1;
+
+                if (ret > 0 && handle_events() != 0)
+                        return -1;
+
+                if (m_changed)
+                        return 1;
+                if (timeout_ms >= 0 && now_ms() - start >= timeout_ms)
+                        return 0;
+        }
+}
+
+int taskwatch_count(const int id)
+{
+        if (id < 0 || (unsigned)id >= m_root_num)
+                return 0;
+        return m_total[id];
+}
+
+void taskwatch_fini(void)
+{
+        unsigned i;
+
+        while (m_dir_num > 0)
+                remove_dir(&m_dirs[m_dir_num - 1]);
+        free(m_dirs);
+        m_dirs = NULL;
+        m_dir_cap = 0;
+        for (i = 0; i < m_root_num; i++) {
+                free(m_roots[i]);
+                m_roots[i] = NULL;
+                m_total[i] = 0;
+                if (m_pids_fd[i] >= 0)
+                        close(m_pids_fd[i]);
+                m_pids_fd[i] = -1;
+        }
+        m_root_num = 0;
+        if (m_fd >= 0)
+                close(m_fd);
+        m_fd = -1;
+}
@@ -0,0 +1,108 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - task watch module
+ *
+ * Keeps the number of threads in cgroup sub-trees up to date using
+ * inotify instead of re-scanning the tree with external commands.
+ */
+
+#ifndef __TASKWATCH_H__
+#define __TASKWATCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Process moves are tracked through inotify, but threads created by
+ * clone() join the parent's cgroup without any write to tasks or
+ * cgroup.procs, so no event is generated for them. They are picked up
+ * from pids.current of the tree, checked every TASKWATCH_PIDS_MS, and
+ * tasks files are re-read only when it changes. Trees without
+ * pids.current re-read their tasks files every TASKWATCH_RESCAN_MS.
+ */
+#define TASKWATCH_PIDS_MS   100
+#define TASKWATCH_RESCAN_MS 500
+
+#define TASKWATCH_MAX_ROOTS 16          /**< max number of watched trees */
+
+/**
+ * @brief Initializes the task watch module
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int taskwatch_init(void);
+
+/**
+ * @brief Starts watching \a root and all its sub-directories
+ *
+ * @param [in] root cgroup directory to watch
+ *
+ * @return Id of the watched tree to pass to taskwatch_count()
+ * @retval -1 error
+ */
+int taskwatch_add(const char *root);
+
+/**
+ * @brief Waits until the thread count of any watched tree changes
+ *
+ * Returns early with -1 and errno set to EINTR when a signal arrives.
+ *
+ * @param [in] timeout_ms time to wait, negative to wait forever
+ *
+ * @return Wait status
+ * @retval 1 thread count changed
+ * @retval 0 timeout, thread counts unchanged
+ * @retval -1 error
+ */
+int taskwatch_wait(const int timeout_ms);
+
+/**
+ * @brief Returns current number of threads in watched tree \a id
+ */
+int taskwatch_count(const int id);
+
+/**
+ * @brief Removes all watches and frees module resources
+ */
+void taskwatch_fini(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TASKWATCH_H__ */
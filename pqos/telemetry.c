@@ -0,0 +1,779 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - binary telemetry log module
+ *
+ * Samples are collected column by column into blocks under a mutex and
+ * a writer thread encodes and writes full blocks, so the sampling loop
+ * never formats text nor waits for the disk. Blocks are written with
+ * one write() each and a restart cuts off a block torn by a crash
+ * before appending, so a log only ever holds whole blocks.
+ *
+ * Structures are written as they are in memory, like model files, so
+ * logs are little-endian as every host with RDT is.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "telemetry.h"
+
+#define TELEMETRY_MAGIC       "MUSESTL"
+#define TELEMETRY_VERSION     1
+#define TELEMETRY_BLOCK_MAGIC 0x4b4c4254    /**< "TBLK" */
+#define TELEMETRY_QUEUE       8             /**< blocks, filled + sealed */
+#define TELEMETRY_FLUSH_MS    1000          /**< max age of a partial block */
+#define VARINT_MAX            10            /**< bytes of a 64-bit varint */
+
+/**
+ * Largest encoded block
+ */
+#define BLOCK_MAX_SIZE (sizeof(struct telemetry_block_header) +   \
+                        TELEMETRY_MAX_COLUMNS *                   \
+                        (sizeof(uint32_t) + TELEMETRY_BLOCK_ROWS * VARINT_MAX))
+
+/**
+ * Samples of one block, column major
+ */
+struct block {
+        unsigned rows;                  /**< samples in the block */
+        uint64_t data[TELEMETRY_MAX_COLUMNS * TELEMETRY_BLOCK_ROWS];
+};
+
+struct telemetry_writer {
+        char *path;                     /**< log file name */
+        struct telemetry_options opt;   /**< writer settings */
+        struct telemetry_file_header hdr; /**< header of new files */
+        struct telemetry_file_column cols[TELEMETRY_MAX_COLUMNS];
+
+        /* writer thread only once started */
+        int fd;                         /**< current log file */
+        uint64_t size;                  /**< size of current log file */
+        uint32_t created;               /**< creation time of the file */
+        int failed;                     /**< last write failed */
+        uint8_t buf[BLOCK_MAX_SIZE];    /**< encoded block */
+
+        pthread_t thread;               /**< writer thread */
+        int started;                    /**< thread is running */
+        pthread_mutex_t lock;           /**< protects fields below */
+        pthread_cond_t wake;            /**< signalled on sealed block */
+        int stop;                       /**< thread should exit */
+        unsigned head;                  /**< block being filled */
+        unsigned tail;                  /**< oldest sealed block */
+        uint64_t head_ms;               /**< first sample of head block */
+        uint64_t dropped;               /**< samples dropped */
+        struct block blocks[TELEMETRY_QUEUE];
+};
+
+struct telemetry_reader {
+        FILE *fp;                       /**< log file */
+        uint32_t flags;                 /**< TELEMETRY_F_* */
+        unsigned num_cols;              /**< number of columns */
+        struct telemetry_column cols[TELEMETRY_MAX_COLUMNS];
+        char names[TELEMETRY_MAX_COLUMNS][TELEMETRY_NAME_LEN];
+        unsigned pos;                   /**< next row of the block */
+        struct block blk;               /**< decoded block */
+        uint8_t buf[BLOCK_MAX_SIZE];    /**< encoded block */
+};
+
+/**
+ * @brief Returns monotonic time in milliseconds
+ */
+static uint64_t
+now_ms(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static inline uint64_t zigzag(const int64_t v)
+{
+        return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t unzigzag(const uint64_t v)
+{
+        return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+/**
+ * @brief Stores \a v as a little-endian base 128 varint
+ *
+ * @return Number of bytes stored
+ */
+static unsigned
+put_varint(uint8_t *p, uint64_t v)
+{
+        unsigned n = 0;
+
+        while (v >= 0x80) {
+                p[n++] = (uint8_t)(v | 0x80);
+                v >>= 7;
+        }
+        p[n++] = (uint8_t)v;
+        return n;
+}
+
+/**
+ * @brief Loads varint from [\a p, \a end)
+ *
+ * @return Number of bytes used
+ * @retval 0 malformed varint
+ */
+static unsigned
+get_varint(const uint8_t *p, const uint8_t *end, uint64_t *v)
+{
+        uint64_t x = 0;
+        unsigned n;
+
+        for (n = 0; n < VARINT_MAX && p + n < end; n++) {
+                x |= (uint64_t)(p[n] & 0x7f) << (7 * n);
+                if (!(p[n] & 0x80)) {
+                        *v = x;
+                        return n + 1;
+                }
+        }
+        return 0;
+}
+
+/**
+ * @brief Writes all of \a buf
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+write_all(const int fd, const void *buf, size_t len)
+{
+        const char *p = buf;
+
+        while (len > 0) {
+                const ssize_t n = write(fd, p, len);
+
+                if (n < 0 && errno == EINTR)
+                        continue;
+                if (n <= 0)
+                        return -1;
+                p += n;
+                len -= (size_t)n;
+        }
+        return 0;
+}
+
+/**
+ * @brief Encodes \a b into w->buf
+ *
+ * @return Encoded size in bytes
+ */
+static size_t
+encode_block(struct telemetry_writer *w, const struct block *b)
+{
+        struct telemetry_block_header bh;
+        uint8_t *p = w->buf + sizeof(bh);
+        unsigned c, r;
+
+        for (c = 0; c < w->hdr.num_columns; c++) {
+                const uint64_t *col = &b->data[c * TELEMETRY_BLOCK_ROWS];
+                uint8_t *start = p + sizeof(uint32_t);
+                uint64_t prev = 0;
+                uint32_t len;
+
+                p = start;
+                if (!(w->hdr.flags & TELEMETRY_F_DELTA)) {
+                        memcpy(p, col, b->rows * sizeof(col[0]));
+                        p += b->rows * sizeof(col[0]);
+                } else if (w->cols[c].type == TELEMETRY_F64) {
+                        /* close doubles share sign, exponent and top bits */
+                        for (r = 0; r < b->rows; r++) {
+                                p += put_varint(p, col[r] ^ prev);
+                                prev = col[r];
+                        }
+                } else {
+                        for (r = 0; r < b->rows; r++) {
+                                p += put_varint(p, zigzag((int64_t)(col[r] -
+                                                                    prev)));
+                                prev = col[r];
+                        }
+                }
+                len = (uint32_t)(p - start);
+                memcpy(start - sizeof(len), &len, sizeof(len));
+        }
+
+        bh.magic = TELEMETRY_BLOCK_MAGIC;
+        bh.num_rows = b->rows;
+        bh.size = (uint32_t)(p - w->buf - sizeof(bh));
+        bh.reserved = 0;
+        memcpy(w->buf, &bh, sizeof(bh));
+        return (size_t)(p - w->buf);
+}
+
+/**
+ * @brief Renames <path> to <path>.1, <path>.1 to <path>.2 and so on,
+ *        dropping the file past opt.keep
+ */
+static void
+rotate_files(const struct telemetry_writer *w)
+{
+        const size_t len = strlen(w->path) + 16;
+        char *from = malloc(len), *to = malloc(len);
+        unsigned i;
+
+        if (from == NULL || to == NULL || w->opt.keep == 0) {
+                unlink(w->path);
+                free(from);
+                free(to);
+                return;
+        }
+        for (i = w->opt.keep - 1; i > 0; i--) {
+                snprintf(from, len, "%s.%u", w->path, i);
+                snprintf(to, len, "%s.%u", w->path, i + 1);
+                rename(from, to);
+        }
+        snprintf(to, len, "%s.1", w->path);
+        rename(w->path, to);
+        free(from);
+        free(to);
+}
+
+/**
+ * @brief Checks that \a fd is a log with the columns and flags of \a w
+ *        and returns the end of its last whole block
+ *
+ * @return End of the last whole block
+ * @retval 0 not a matching log
+ */
+static uint64_t
+check_log(const struct telemetry_writer *w, const int fd,
+          const uint64_t file_size, uint32_t *created)
+{
+        const size_t cols_size = w->hdr.num_columns * sizeof(w->cols[0]);
+        struct telemetry_file_column cols[TELEMETRY_MAX_COLUMNS];
+        struct telemetry_file_header hdr;
+        struct telemetry_block_header bh;
+        uint64_t off;
+
+        if (pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr) ||
+            memcmp(hdr.magic, w->hdr.magic, sizeof(hdr.magic)) != 0 ||
+            hdr.version != w->hdr.version ||
+            hdr.num_columns != w->hdr.num_columns ||
+            hdr.flags != w->hdr.flags ||
+            pread(fd, cols, cols_size, sizeof(hdr)) != (ssize_t)cols_size ||
+            memcmp(cols, w->cols, cols_size) != 0)
+                return 0;
+
+        off = sizeof(hdr) + cols_size;
+        while (pread(fd, &bh, sizeof(bh), off) == (ssize_t)sizeof(bh) &&
+               bh.magic == TELEMETRY_BLOCK_MAGIC &&
+               off + sizeof(bh) + bh.size <= file_size)
+                off += sizeof(bh) + bh.size;
+        *created = hdr.created;
+        return off;
+}
+
+/**
+ * @brief Opens w->path, appending to a matching log or starting a new one
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+open_log(struct telemetry_writer *w)
+{
+        const size_t cols_size = w->hdr.num_columns * sizeof(w->cols[0]);
+        struct stat st;
+        uint64_t end = 0;
+
+        w->fd = open(w->path, O_RDWR | O_CREAT, 0644);
+        if (w->fd < 0 || fstat(w->fd, &st) != 0)
+                goto error;
+
+        if (st.st_size > 0)
+                end = check_log(w, w->fd, (uint64_t)st.st_size, &w->created);
+        if (st.st_size > 0 && end == 0) {
+                printf("Info : %s is not a matching telemetry log, "
+                       "rotating it.\n", w->path);
+                close(w->fd);
+                rotate_files(w);
+                w->fd = open(w->path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+                if (w->fd < 0)
+                        goto error;
+        }
+        if (end > 0) {
+                /* drop a block torn by a crash */
+                if (end < (uint64_t)st.st_size &&
+                    ftruncate(w->fd, (off_t)end) != 0)
+                        goto error;
+                if (lseek(w->fd, (off_t)end, SEEK_SET) < 0)
+                        goto error;
+                w->size = end;
+                return 0;
+        }
+
+        w->created = (uint32_t)time(NULL);
+        w->hdr.created = w->created;
+        if (write_all(w->fd, &w->hdr, sizeof(w->hdr)) != 0 ||
+            write_all(w->fd, w->cols, cols_size) != 0)
+                goto error;
+        w->size = sizeof(w->hdr) + cols_size;
+        return 0;
+
+ error:
+        printf("Error : Cannot open telemetry log %s: %s\n", w->path,
+               strerror(errno));
+        if (w->fd >= 0)
+                close(w->fd);
+        w->fd = -1;
+        return -1;
+}
+
+/**
+ * @brief Starts a new log if the current one is too big or too old
+ */
+static void
+maybe_rotate(struct telemetry_writer *w, const size_t len)
+{
+        const uint64_t empty = sizeof(w->hdr) +
+                w->hdr.num_columns * sizeof(w->cols[0]);
+        const uint32_t now = (uint32_t)time(NULL);
+        int full, old;
+
+        /* retry a log that failed to open */
+        if (w->fd < 0) {
+                open_log(w);
+                return;
+        }
+        if (w->size <= empty)
+                return;
+        full = w->opt.max_bytes > 0 && w->size + len > w->opt.max_bytes;
+        old = w->opt.max_age_s > 0 && now - w->created >= w->opt.max_age_s;
+        if (!full && !old)
+                return;
+
+        close(w->fd);
+        w->fd = -1;
+        rotate_files(w);
+        open_log(w);
+}
+
+/**
+ * @brief Encodes and writes block \a b
+ */
+static void
+write_block(struct telemetry_writer *w, const struct block *b)
+{
+        const size_t len = encode_block(w, b);
+
+        maybe_rotate(w, len);
+        if (w->fd < 0)
+                return;
+        if (write_all(w->fd, w->buf, len) != 0) {
+                if (!w->failed)
+                        printf("Error : Telemetry write to %s failed: %s\n",
+                               w->path, strerror(errno));
+                w->failed = 1;
+                /* keep the log made of whole blocks */
+                if (ftruncate(w->fd, (off_t)w->size) != 0 ||
+                    lseek(w->fd, (off_t)w->size, SEEK_SET) < 0) {
+                        close(w->fd);
+                        w->fd = -1;
+                }
+                return;
+        }
+        w->failed = 0;
+        w->size += len;
+}
+
+/**
+ * @brief Hands the block being filled over to the writer thread
+ *
+ * Called with w->lock held.
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 queue full, block emptied
+ */
+static int
+seal_block(struct telemetry_writer *w)
+{
+        if (w->head - w->tail >= TELEMETRY_QUEUE - 1) {
+                w->dropped += w->blocks[w->head % TELEMETRY_QUEUE].rows;
+                w->blocks[w->head % TELEMETRY_QUEUE].rows = 0;
+                return -1;
+        }
+        w->head++;
+        w->blocks[w->head % TELEMETRY_QUEUE].rows = 0;
+        pthread_cond_signal(&w->wake);
+        return 0;
+}
+
+/**
+ * @brief Writer thread, writes sealed blocks and seals old partial ones
+ */
+static void *
+writer_main(void *arg)
+{
+        struct telemetry_writer *w = arg;
+
+        pthread_mutex_lock(&w->lock);
+        for (;;) {
+                const struct block *cur = &w->blocks[w->head %
+                                                     TELEMETRY_QUEUE];
+
+                if (w->head == w->tail && cur->rows > 0 &&
+                    (w->stop || now_ms() - w->head_ms >= TELEMETRY_FLUSH_MS))
+                        seal_block(w);
+
+                if (w->head != w->tail) {
+                        const struct block *b =
+                                &w->blocks[w->tail % TELEMETRY_QUEUE];
+
+                        /* sealed blocks are not touched by producers */
+                        pthread_mutex_unlock(&w->lock);
+                        write_block(w, b);
+                        pthread_mutex_lock(&w->lock);
+                        w->tail++;
+                        continue;
+                }
+                if (w->stop)
+                        break;
+
+                {
+                        struct timespec ts;
+
+                        clock_gettime(CLOCK_REALTIME, &ts);
+                        ts.tv_nsec += TELEMETRY_FLUSH_MS % 1000 * 1000000L;
+                        ts.tv_sec += TELEMETRY_FLUSH_MS / 1000 +
+                                ts.tv_nsec / 1000000000L;
+                        ts.tv_nsec %= 1000000000L;
+                        pthread_cond_timedwait(&w->wake, &w->lock, &ts);
+                }
+        }
+        pthread_mutex_unlock(&w->lock);
+        return NULL;
+}
+
+struct telemetry_writer *telemetry_open(const char *path,
+                                        const struct telemetry_column *cols,
+                                        const unsigned num_cols,
+                                        const struct telemetry_options *opt)
+{
+        struct telemetry_writer *w;
+        sigset_t all, old;
+        unsigned i;
+        int ret;
+
+        if (path == NULL || cols == NULL || opt == NULL || num_cols == 0 ||
+            num_cols > TELEMETRY_MAX_COLUMNS)
+                return NULL;
+
+        w = calloc(1, sizeof(*w));
+        if (w == NULL)
+                return NULL;
+        w->fd = -1;
+        pthread_mutex_init(&w->lock, NULL);
+        pthread_cond_init(&w->wake, NULL);
+        w->opt = *opt;
+        w->path = strdup(path);
+        if (w->path == NULL)
+                goto error;
+
+        memcpy(w->hdr.magic, TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC));
+        w->hdr.version = TELEMETRY_VERSION;
+        w->hdr.num_columns = num_cols;
+        w->hdr.flags = opt->compress ? TELEMETRY_F_DELTA : 0;
+        for (i = 0; i < num_cols; i++) {
+                if (cols[i].name == NULL ||
+                    strlen(cols[i].name) >= TELEMETRY_NAME_LEN)
+                        goto error;
+                strncpy(w->cols[i].name, cols[i].name,
+                        TELEMETRY_NAME_LEN);
+                w->cols[i].type = cols[i].type;
+        }
+        if (open_log(w) != 0)
+                goto error;
+
+        /* signals are handled by the sampling thread */
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        ret = pthread_create(&w->thread, NULL, writer_main, w);
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+        if (ret != 0) {
+                printf("Error : Cannot start telemetry writer thread!\n");
+                goto error;
+        }
+        w->started = 1;
+        return w;
+
+ error:
+        telemetry_close(w);
+        return NULL;
+}
+
+int telemetry_append(struct telemetry_writer *w,
+                     const union telemetry_value *row)
+{
+        struct block *b;
+        unsigned c;
+        int ret = 0;
+
+        if (w == NULL || row == NULL)
+                return -1;
+
+        pthread_mutex_lock(&w->lock);
+        b = &w->blocks[w->head % TELEMETRY_QUEUE];
+        if (b->rows == 0)
+                w->head_ms = now_ms();
+        for (c = 0; c < w->hdr.num_columns; c++)
+                memcpy(&b->data[c * TELEMETRY_BLOCK_ROWS + b->rows], &row[c],
+                       sizeof(b->data[0]));
+        if (++b->rows == TELEMETRY_BLOCK_ROWS)
+                ret = seal_block(w);
+        pthread_mutex_unlock(&w->lock);
+        return ret;
+}
+
+void telemetry_close(struct telemetry_writer *w)
+{
+        if (w == NULL)
+                return;
+
+        if (w->started) {
+                pthread_mutex_lock(&w->lock);
+                w->stop = 1;
+                pthread_cond_signal(&w->wake);
+                pthread_mutex_unlock(&w->lock);
+                pthread_join(w->thread, NULL);
+        }
+        if (w->dropped > 0)
+                printf("Warning : %llu telemetry samples dropped, "
+                       "%s is too slow\n", (unsigned long long)w->dropped,
+                       w->path);
+        if (w->fd >= 0)
+                close(w->fd);
+        pthread_cond_destroy(&w->wake);
+        pthread_mutex_destroy(&w->lock);
+        free(w->path);
+        free(w);
+}
+
+struct telemetry_reader *telemetry_reader_open(const char *path)
+{
+        struct telemetry_file_column cols[TELEMETRY_MAX_COLUMNS];
+        struct telemetry_file_header hdr;
+        struct telemetry_reader *r;
+        unsigned i;
+
+        if (path == NULL)
+                return NULL;
+        r = calloc(1, sizeof(*r));
+        if (r == NULL)
+                return NULL;
+        r->fp = fopen(path, "rb");
+        if (r->fp == NULL) {
+                printf("Error : Cannot open telemetry log %s!\n", path);
+                free(r);
+                return NULL;
+        }
+        if (fread(&hdr, sizeof(hdr), 1, r->fp) != 1 ||
+            memcmp(hdr.magic, TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC)) ||
+            hdr.version != TELEMETRY_VERSION || hdr.num_columns == 0 ||
+            hdr.num_columns > TELEMETRY_MAX_COLUMNS ||
+            fread(cols, sizeof(cols[0]), hdr.num_columns, r->fp) !=
+            hdr.num_columns) {
+                printf("Error : %s is not a telemetry log!\n", path);
+                telemetry_reader_close(r);
+                return NULL;
+        }
+
+        r->flags = hdr.flags;
+        r->num_cols = hdr.num_columns;
+        for (i = 0; i < r->num_cols; i++) {
+                memcpy(r->names[i], cols[i].name, TELEMETRY_NAME_LEN);
+                r->names[i][TELEMETRY_NAME_LEN - 1] = '\0';
+                r->cols[i].name = r->names[i];
+                r->cols[i].type = cols[i].type == TELEMETRY_F64 ?
+                        TELEMETRY_F64 : TELEMETRY_I64;
+        }
+        return r;
+}
+
+unsigned telemetry_reader_columns(const struct telemetry_reader *r,
+                                  const struct telemetry_column **cols)
+{
+        if (r == NULL)
+                return 0;
+        if (cols != NULL)
+                *cols = r->cols;
+        return r->num_cols;
+}
+
+/**
+ * @brief Reads and decodes next block
+ *
+ * @return Operation status
+ * @retval 1 block read
+ * @retval 0 end of log
+ * @retval -1 error
+ */
+static int
+read_block(struct telemetry_reader *r)
+{
+        struct telemetry_block_header bh;
+        const uint8_t *p = r->buf, *end;
+        unsigned c, i;
+
+        if (fread(&bh, sizeof(bh), 1, r->fp) != 1)
+                return 0;
+        if (bh.magic != TELEMETRY_BLOCK_MAGIC || bh.num_rows == 0 ||
+            bh.num_rows > TELEMETRY_BLOCK_ROWS ||
+            bh.size > sizeof(r->buf) - sizeof(bh))
+                return -1;
+        /* block cut short by a crash ends the log */
+        if (fread(r->buf, 1, bh.size, r->fp) != bh.size)
+                return 0;
+        end = r->buf + bh.size;
+
+        for (c = 0; c < r->num_cols; c++) {
+                uint64_t *col = &r->blk.data[c * TELEMETRY_BLOCK_ROWS];
+                const uint8_t *col_end;
+                uint64_t prev = 0, v;
+                uint32_t len;
+
+                if (end - p < (ptrdiff_t)sizeof(len))
+                        return -1;
+                memcpy(&len, p, sizeof(len));
+                p += sizeof(len);
+                if ((size_t)(end - p) < len)
+                        return -1;
+                col_end = p + len;
+
+                if (!(r->flags & TELEMETRY_F_DELTA)) {
+                        if (len != bh.num_rows * sizeof(col[0]))
+                                return -1;
+                        memcpy(col, p, len);
+                        p = col_end;
+                        continue;
+                }
+                for (i = 0; i < bh.num_rows; i++) {
+                        const unsigned n = get_varint(p, col_end, &v);
+
+                        if (n == 0)
+                                return -1;
+                        p += n;
+                        if (r->cols[c].type == TELEMETRY_F64)
+                                prev ^= v;
+                        else
+                                prev += (uint64_t)unzigzag(v);
+                        col[i] = prev;
+                }
+                if (p != col_end)
+                        return -1;
+        }
+        r->blk.rows = bh.num_rows;
+        r->pos = 0;
+        return 1;
+}
+
+int telemetry_reader_next(struct telemetry_reader *r,
+                          union telemetry_value *row)
+{
+        unsigned c;
+
+        if (r == NULL || row == NULL)
+                return -1;
+        if (r->pos >= r->blk.rows) {
+                const int ret = read_block(r);
+
+                if (ret <= 0)
+                        return ret;
+        }
+        for (c = 0; c < r->num_cols; c++)
+                memcpy(&row[c],
+                       &r->blk.data[c * TELEMETRY_BLOCK_ROWS + r->pos],
+                       sizeof(row[c]));
+        r->pos++;
+        return 1;
+}
+
+void telemetry_reader_close(struct telemetry_reader *r)
+{
+        if (r == NULL)
+                return;
+        if (r->fp != NULL)
+                fclose(r->fp);
+        free(r);
+}
+
+int telemetry_dump(const char *path, FILE *out)
+{
+        union telemetry_value row[TELEMETRY_MAX_COLUMNS];
+        const struct telemetry_column *cols;
+        struct telemetry_reader *r;
+        unsigned n, c;
+        int ret;
+
+        if (out == NULL)
+                return -1;
+        r = telemetry_reader_open(path);
+        if (r == NULL)
+                return -1;
+
+        n = telemetry_reader_columns(r, &cols);
+        for (c = 0; c < n; c++)
+                fprintf(out, "%s%c", cols[c].name, c + 1 < n ? ',' : '\n');
+        while ((ret = telemetry_reader_next(r, row)) == 1)
+                for (c = 0; c < n; c++) {
+                        if (cols[c].type == TELEMETRY_F64)
+                                fprintf(out, "%lf", row[c].f);
+                        else
+                                fprintf(out, "%lld", (long long)row[c].i);
+                        fputc(c + 1 < n ? ',' : '\n', out);
+                }
+        if (ret < 0)
+                printf("Error : %s is corrupted!\n", path);
+        telemetry_reader_close(r);
+        return ret;
+}
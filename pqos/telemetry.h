@@ -0,0 +1,233 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - binary telemetry log module
+ *
+ * Append-only log of fixed-width samples. A file starts with a header
+ * describing the columns and is followed by blocks of up to
+ * TELEMETRY_BLOCK_ROWS samples stored column by column.
+ */
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TELEMETRY_NAME_LEN   28         /**< max column name length + 1 */
+#define TELEMETRY_MAX_COLUMNS 32        /**< max columns of a log */
+#define TELEMETRY_BLOCK_ROWS 64         /**< max samples per block */
+
+/**
+ * File layout, all fields little-endian:
+ *
+ *   struct telemetry_file_header
+ *   struct telemetry_file_column [num_columns]
+ *   blocks: struct telemetry_block_header, then for every column a
+ *           uint32_t byte count followed by the column data
+ *
+ * Column data is num_rows 8 byte values, or with TELEMETRY_F_DELTA
+ * varints of the zigzag difference to the previous row (integers) or of
+ * the XOR with the previous row (doubles). Every block starts from 0 so
+ * blocks decode on their own.
+ */
+struct telemetry_file_header {
+        char magic[8];                  /**< "MUSESTL" */
+        uint32_t version;               /**< TELEMETRY_VERSION */
+        uint32_t num_columns;           /**< number of columns */
+        uint32_t flags;                 /**< TELEMETRY_F_* */
+        uint32_t created;               /**< creation time, seconds since
+                                             the epoch */
+};
+
+#define TELEMETRY_F_DELTA 1             /**< delta/XOR varint columns */
+
+struct telemetry_file_column {
+        char name[TELEMETRY_NAME_LEN];  /**< column name */
+        uint32_t type;                  /**< enum telemetry_type */
+};
+
+struct telemetry_block_header {
+        uint32_t magic;                 /**< TELEMETRY_BLOCK_MAGIC */
+        uint32_t num_rows;              /**< samples in the block */
+        uint32_t size;                  /**< bytes following the header */
+        uint32_t reserved;              /**< 0 */
+};
+
+/**
+ * Column types
+ */
+enum telemetry_type {
+        TELEMETRY_I64 = 0,              /**< signed integer */
+        TELEMETRY_F64                   /**< double */
+};
+
+/**
+ * Column of a log
+ */
+struct telemetry_column {
+        const char *name;               /**< column name */
+        enum telemetry_type type;       /**< column type */
+};
+
+/**
+ * One value of a sample, member selected by the column type
+ */
+union telemetry_value {
+        int64_t i;                      /**< TELEMETRY_I64 */
+        double f;                       /**< TELEMETRY_F64 */
+};
+
+/**
+ * Writer settings
+ */
+struct telemetry_options {
+        uint64_t max_bytes;             /**< rotate above this size,
+                                             0 never */
+        unsigned max_age_s;             /**< rotate files older than this,
+                                             0 never */
+        unsigned keep;                  /**< rotated files kept as
+                                             <path>.1 .. <path>.keep */
+        int compress;                   /**< use TELEMETRY_F_DELTA */
+};
+
+struct telemetry_writer;
+struct telemetry_reader;
+
+/**
+ * @brief Opens log \a path for appending and starts its writer thread
+ *
+ * An existing log with the same columns and flags is appended to, a
+ * partly written last block is cut off. Any other existing file is
+ * rotated away first.
+ *
+ * @param [in] path log file name
+ * @param [in] cols columns of a sample
+ * @param [in] num_cols number of columns
+ * @param [in] opt writer settings
+ *
+ * @return Pointer to writer
+ * @retval NULL on error
+ */
+struct telemetry_writer *telemetry_open(const char *path,
+                                        const struct telemetry_column *cols,
+                                        const unsigned num_cols,
+                                        const struct telemetry_options *opt);
+
+/**
+ * @brief Queues one sample
+ *
+ * Never waits for the disk. Full blocks are written by the writer
+ * thread, partial ones once they are a second old. If the writer falls
+ * behind by more than its queue the newest block is dropped.
+ *
+ * @param [in] w writer
+ * @param [in] row num_cols values
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 sample dropped
+ */
+int telemetry_append(struct telemetry_writer *w,
+                     const union telemetry_value *row);
+
+/**
+ * @brief Writes queued samples, stops the writer thread and frees \a w
+ *
+ * @param [in] w writer, may be NULL
+ */
+void telemetry_close(struct telemetry_writer *w);
+
+/**
+ * @brief Opens log \a path for reading
+ *
+ * @return Pointer to reader
+ * @retval NULL on error
+ */
+struct telemetry_reader *telemetry_reader_open(const char *path);
+
+/**
+ * @brief Returns columns of the log
+ *
+ * @param [in] r reader
+ * @param [out] cols place to store pointer to columns, valid until
+ *              telemetry_reader_close()
+ *
+ * @return Number of columns
+ */
+unsigned telemetry_reader_columns(const struct telemetry_reader *r,
+                                  const struct telemetry_column **cols);
+
+/**
+ * @brief Reads next sample
+ *
+ * @param [in] r reader
+ * @param [out] row place to store num_cols values
+ *
+ * @return Operation status
+ * @retval 1 sample read
+ * @retval 0 end of log, including a partly written last block
+ * @retval -1 error
+ */
+int telemetry_reader_next(struct telemetry_reader *r,
+                          union telemetry_value *row);
+
+/**
+ * @brief Closes reader
+ *
+ * @param [in] r reader, may be NULL
+ */
+void telemetry_reader_close(struct telemetry_reader *r);
+
+/**
+ * @brief Converts log \a path to CSV with a header line
+ *
+ * @param [in] path log file name
+ * @param [in] out CSV output
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int telemetry_dump(const char *path, FILE *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TELEMETRY_H__ */
@@ -0,0 +1,360 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - tenant configuration module
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "tenant.h"
+
+/**
+ * @brief Duplicates \a val into \a *dst, freeing the old value
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+set_str(char **dst, const char *val)
+{
+        char *s = strdup(val);
+
+        if (s == NULL)
+                return -1;
+        free(*dst);
+        *dst = s;
+        return 0;
+}
+
+/**
+ * @brief Parses whole string \a val as integer
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+parse_int(const char *val, int *out)
+{
+        char *end = NULL;
+        long v;
+
+        errno = 0;
+        v = strtol(val, &end, 10);
+        if (errno != 0 || end == val || *end != '\0' ||
+            v < -1000000 || v > 1000000)
+                return -1;
+        *out = (int)v;
+        return 0;
+}
+
+/**
+ * @brief Parses whole string \a val as non-negative number
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+parse_double(const char *val, double *out)
+{
+        char *end = NULL;
+        double v;
+
+        errno = 0;
+        v = strtod(val, &end);
+        if (errno != 0 || end == val || *end != '\0' || !(v >= 0))
+                return -1;
+        *out = v;
+        return 0;
+}
+
+/**
+ * @brief Parses whole string \a val as "<min> <max>" range of quota
+ *        search grid, multiplied by \a scale
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+parse_range(const char *val, const double scale, const double limit,
+            int *min, int *max)
+{
+        char *end = NULL;
+        double lo, hi;
+
+        errno = 0;
+        lo = strtod(val, &end);
+        if (errno != 0 || end == val || !isspace((unsigned char)*end))
+                return -1;
+        val = end;
+        hi = strtod(val, &end);
+        if (errno != 0 || end == val || *end != '\0' ||
+            !(lo >= 0) || !(hi > lo) || hi > limit)
+                return -1;
+        *min = (int)(lo * scale + 0.5);
+        *max = (int)(hi * scale + 0.5);
+        return *max > *min ? 0 : -1;
+}
+
+/**
+ * @brief Starts new group \a name of class \a type
+ *
+ * @return Pointer to the new group
+ * @retval NULL on error
+ */
+static struct tenant_group *
+add_group(struct tenant_config *cfg, const char *name,
+          const enum tenant_class type)
+{
+        struct tenant_group *grp;
+        unsigned i;
+
+        if (cfg->num_groups >= TENANT_MAX_GROUPS) {
+                printf("Error : Too many groups, max %d!\n",
+                       TENANT_MAX_GROUPS);
+                return NULL;
+        }
+        if (*name == '\0' || strlen(name) >= TENANT_NAME_LEN) {
+                printf("Error : Invalid group name '%s'!\n", name);
+                return NULL;
+        }
+        for (i = 0; i < cfg->num_groups; i++)
+                if (strcmp(cfg->groups[i].name, name) == 0) {
+                        printf("Error : Duplicate group '%s'!\n", name);
+                        return NULL;
+                }
+
+        grp = &cfg->groups[cfg->num_groups++];
+        memset(grp, 0, sizeof(*grp));
+        strcpy(grp->name, name);
+        grp->type = type;
+        if (type == TENANT_ONLINE) {
+                grp->tasks_offset = TENANT_DEFAULT_TASKS_OFFSET;
+                quota_grid_default(&grp->grid);
+                cfg->num_online++;
+        }
+        return grp;
+}
+
+/**
+ * @brief Checks that groups of \a cfg are complete
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+static int
+check_config(const struct tenant_config *cfg)
+{
+        unsigned i;
+
+        if (cfg->num_online == 0) {
+                printf("Error : No online group configured!\n");
+                return -1;
+        }
+        for (i = 0; i < cfg->num_groups; i++) {
+                const struct tenant_group *grp = &cfg->groups[i];
+
+                if (grp->cpuset_dir == NULL) {
+                        printf("Error : Group '%s' has no cpuset!\n",
+                               grp->name);
+                        return -1;
+                }
+                if (grp->type == TENANT_ONLINE && grp->model_file == NULL) {
+                        printf("Error : Online group '%s' has no model!\n",
+                               grp->name);
+                        return -1;
+                }
+                if (grp->retrain_s > 0 && grp->perf_dir == NULL) {
+                        printf("Error : Group '%s' needs perf to retrain!\n",
+                               grp->name);
+                        return -1;
+                }
+        }
+        return 0;
+}
+
+int tenant_config_load(const char *fname, struct tenant_config *cfg)
+{
+        struct tenant_group *grp = NULL;
+        unsigned line = 0;
+        char cb[512];
+        FILE *fp;
+
+        if (fname == NULL || cfg == NULL)
+                return -1;
+
+        memset(cfg, 0, sizeof(*cfg));
+        fp = fopen(fname, "r");
+        if (fp == NULL) {
+                printf("Error : Cannot open configuration file %s!\n", fname);
+                return -1;
+        }
+
+        while (fgets(cb, sizeof(cb), fp) != NULL) {
+                char *key = cb, *val, *end;
+                int ok = 0;
+
+                line++;
+                while (isspace((unsigned char)*key))
+                        key++;
+                if (*key == '\0' || *key == '#')
+                        continue; /**< blank line or comment */
+
+                end = key + strlen(key);
+                while (end > key && isspace((unsigned char)end[-1]))
+                        *(--end) = '\0';
+
+                val = strchr(key, ':');
+                if (val == NULL)
+                        goto syntax_error;
+                *val++ = '\0';
+                while (isspace((unsigned char)*val))
+                        val++;
+
+                if (strcmp(key, "online-group") == 0) {
+                        grp = add_group(cfg, val, TENANT_ONLINE);
+                        ok = (grp != NULL);
+                } else if (strcmp(key, "best-effort-group") == 0) {
+                        grp = add_group(cfg, val, TENANT_BEST_EFFORT);
+                        ok = (grp != NULL);
+                } else if (grp == NULL) {
+                        printf("Error : '%s' outside of a group!\n", key);
+                } else if (strcmp(key, "cpuset") == 0) {
+                        ok = (set_str(&grp->cpuset_dir, val) == 0);
+                } else if (strcmp(key, "memory") == 0) {
+                        ok = (set_str(&grp->memory_dir, val) == 0);
+                } else if (strcmp(key, "model") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              set_str(&grp->model_file, val) == 0);
+                } else if (strcmp(key, "perf") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              set_str(&grp->perf_dir, val) == 0);
+                } else if (strcmp(key, "retrain") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              parse_int(val, &grp->retrain_s) == 0 &&
+                              grp->retrain_s >= 0);
+                } else if (strcmp(key, "slo-ips") == 0) {
+                        ok = (parse_double(val, &grp->slo_ips) == 0);
+                } else if (strcmp(key, "grid-cpu") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              parse_range(val, 10, 1024,
+                                          &grp->grid.cpu_min,
+                                          &grp->grid.cpu_max) == 0);
+                } else if (strcmp(key, "grid-mem") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              parse_range(val, 1, INT_MAX,
+                                          &grp->grid.mem_min,
+                                          &grp->grid.mem_max) == 0);
+                } else if (strcmp(key, "grid-llc") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              parse_range(val, 1, INT_MAX,
+                                          &grp->grid.llc_min,
+                                          &grp->grid.llc_max) == 0);
+                } else if (strcmp(key, "grid-mba") == 0) {
+                        ok = (grp->type == TENANT_ONLINE &&
+                              parse_range(val, 1, 100,
+                                          &grp->grid.mba_min,
+                                          &grp->grid.mba_max) == 0);
+                } else if (strcmp(key, "priority") == 0) {
+                        ok = (parse_int(val, &grp->priority) == 0);
+                } else if (strcmp(key, "tasks-offset") == 0) {
+                        ok = (parse_int(val, &grp->tasks_offset) == 0);
+                } else {
+                        printf("Error : Unknown option '%s'!\n", key);
+                }
+                if (ok)
+                        continue;
+
+ syntax_error:
+                printf("Error : %s:%u: invalid line!\n", fname, line);
+                fclose(fp);
+                tenant_config_free(cfg);
+                return -1;
+        }
+        fclose(fp);
+
+        if (check_config(cfg) != 0) {
+                tenant_config_free(cfg);
+                return -1;
+        }
+        return 0;
+}
+
+int tenant_config_default(struct tenant_config *cfg, const char *online_dir,
+                          const char *offline_dir, const char *model)
+{
+        struct tenant_group *grp;
+
+        if (cfg == NULL || online_dir == NULL || offline_dir == NULL ||
+            model == NULL)
+                return -1;
+
+        memset(cfg, 0, sizeof(*cfg));
+        grp = add_group(cfg, "online", TENANT_ONLINE);
+        if (grp == NULL || set_str(&grp->cpuset_dir, online_dir) != 0 ||
+            set_str(&grp->model_file, model) != 0)
+                goto error;
+        grp = add_group(cfg, "offline", TENANT_BEST_EFFORT);
+        if (grp == NULL || set_str(&grp->cpuset_dir, offline_dir) != 0)
+                goto error;
+        return 0;
+
+ error:
+        tenant_config_free(cfg);
+        return -1;
+}
+
+void tenant_config_free(struct tenant_config *cfg)
+{
+        unsigned i;
+
+        if (cfg == NULL)
+                return;
+        for (i = 0; i < cfg->num_groups; i++) {
+                free(cfg->groups[i].cpuset_dir);
+                free(cfg->groups[i].memory_dir);
+                free(cfg->groups[i].model_file);
+                free(cfg->groups[i].perf_dir);
+        }
+        memset(cfg, 0, sizeof(*cfg));
+}
@@ -0,0 +1,152 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - tenant configuration module
+ *
+ * Describes the latency-critical (online) and best-effort groups the
+ * isolation controller shares the node between.
+ */
+
+#ifndef __TENANT_H__
+#define __TENANT_H__
+
+#include "quota.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TENANT_MAX_GROUPS 15            /**< max groups in a config */
+#define TENANT_NAME_LEN   32            /**< max group name length */
+
+/**
+ * Threads that are not part of the service itself, e.g. YARN AM threads
+ * running next to mysql in the container
+ */
+#define TENANT_DEFAULT_TASKS_OFFSET -54
+
+/**
+ * Group classes
+ */
+enum tenant_class {
+        TENANT_ONLINE = 0,              /**< latency-critical service */
+        TENANT_BEST_EFFORT              /**< batch jobs, gets what is left */
+};
+
+/**
+ * One group of the configuration
+ */
+struct tenant_group {
+        char name[TENANT_NAME_LEN];     /**< group name */
+        enum tenant_class type;         /**< group class */
+        char *cpuset_dir;               /**< cpuset cgroup directory */
+        char *memory_dir;               /**< memory cgroup directory or NULL */
+        char *model_file;               /**< IPS model, online groups only */
+        char *perf_dir;                 /**< perf_event cgroup directory,
+                                             enables IPS feedback */
+        int retrain_s;                  /**< model refit period in seconds,
+                                             0 disables retraining */
+        double slo_ips;                 /**< IPS target, 0 for default */
+        struct quota_grid grid;         /**< quota search grid,
+                                             online groups only */
+        int priority;                   /**< higher is served first */
+        int tasks_offset;               /**< added to watched thread count */
+};
+
+/**
+ * Controller configuration
+ */
+struct tenant_config {
+        unsigned num_groups;            /**< number of groups */
+        unsigned num_online;            /**< number of online groups */
+        struct tenant_group groups[TENANT_MAX_GROUPS];
+};
+
+/**
+ * @brief Loads configuration file
+ *
+ * Each group starts with "online-group: <name>" or
+ * "best-effort-group: <name>" and is followed by its settings:
+ *
+ *     cpuset: <dir>           cpuset cgroup directory (required)
+ *     memory: <dir>           memory cgroup directory
+ *     model: <file>           IPS model (online groups)
+ *     perf: <dir>             perf_event cgroup, corrects the model
+ *                             quota from measured IPS (online groups)
+ *     retrain: <seconds>      refits the model to measured IPS with
+ *                             this period, 0 disables (needs perf)
+ *     slo-ips: <ips>          IPS target, 0 for 90% of max IPS
+ *                             the model predicts
+ *     grid-cpu: <min> <max>   quota search range in cores
+ *     grid-mem: <min> <max>   quota search range in KB
+ *     grid-llc: <min> <max>   quota search range in KB
+ *     grid-mba: <min> <max>   quota search range in percent
+ *                             (online groups, default is the mysql grid)
+ *     priority: <n>           higher priority is served first
+ *     tasks-offset: <n>       added to the thread count
+ *
+ * @param [in] fname configuration file name
+ * @param [out] cfg place to store the configuration
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int tenant_config_load(const char *fname, struct tenant_config *cfg);
+
+/**
+ * @brief Builds configuration of one online and one best-effort group
+ *
+ * @param [out] cfg place to store the configuration
+ * @param [in] online_dir cpuset directory of online group
+ * @param [in] offline_dir cpuset directory of best-effort group
+ * @param [in] model IPS model of online group
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int tenant_config_default(struct tenant_config *cfg, const char *online_dir,
+                          const char *offline_dir, const char *model);
+
+/**
+ * @brief Frees memory held by \a cfg
+ */
+void tenant_config_free(struct tenant_config *cfg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TENANT_H__ */
@@ -0,0 +1,115 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - sampling ticker module
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/timerfd.h>
+
+#include "ticker.h"
+
+int ticker_start(struct ticker *t, const uint64_t period_us)
+{
+        struct itimerspec its;
+        struct timespec now;
+
+        if (t == NULL || period_us < TICKER_MIN_PERIOD_US)
+                return -1;
+
+        memset(t, 0, sizeof(*t));
+        t->period_us = period_us;
+        t->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (t->fd < 0) {
+                printf("Error : Cannot create sampling timer: %s\n",
+                       strerror(errno));
+                return -1;
+        }
+
+        /* absolute first expiry, later ones follow at exact periods */
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        its.it_interval.tv_sec = (time_t)(period_us / 1000000);
+        its.it_interval.tv_nsec = (long)(period_us % 1000000) * 1000;
+        its.it_value.tv_sec = now.tv_sec + its.it_interval.tv_sec;
+        its.it_value.tv_nsec = now.tv_nsec + its.it_interval.tv_nsec;
+        if (its.it_value.tv_nsec >= 1000000000L) {
+                its.it_value.tv_sec++;
+                its.it_value.tv_nsec -= 1000000000L;
+        }
+        if (timerfd_settime(t->fd, TFD_TIMER_ABSTIME, &its, NULL) != 0) {
+                printf("Error : Cannot start sampling timer: %s\n",
+                       strerror(errno));
+                close(t->fd);
+                t->fd = -1;
+                return -1;
+        }
+        return 0;
+}
+
+int ticker_wait(struct ticker *t)
+{
+        uint64_t expired = 0;
+        ssize_t n;
+
+        if (t == NULL || t->fd < 0)
+                return -1;
+
+        n = read(t->fd, &expired, sizeof(expired));
+        if (n != (ssize_t)sizeof(expired) || expired == 0)
+                return -1;
+        t->ticks += expired;
+        t->missed += expired - 1;
+        return (expired - 1 > INT_MAX) ? INT_MAX : (int)(expired - 1);
+}
+
+void ticker_stop(struct ticker *t)
+{
+        if (t == NULL || t->fd < 0)
+                return;
+        close(t->fd);
+        t->fd = -1;
+}
+
+uint64_t ticker_now_ns(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,106 @@
+/*
+ * BSD LICENSE
+ *
+ * Copyright(c) 2014-2017 Intel Corporation. All rights reserved.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the
+ *     distribution.
+ *   * Neither the name of Intel Corporation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Platform QoS utility - sampling ticker module
+ *
+ * Periodic ticks from a timerfd on CLOCK_MONOTONIC. Ticks are due at
+ * start + n x period, so the schedule does not drift with the time
+ * spent sampling and is not moved by wall clock changes.
+ */
+
+#ifndef __TICKER_H__
+#define __TICKER_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TICKER_MIN_PERIOD_US 1000       /**< shortest period, 1 ms */
+
+/**
+ * Ticker state
+ */
+struct ticker {
+        int fd;                         /**< timerfd */
+        uint64_t period_us;             /**< tick period */
+        uint64_t ticks;                 /**< ticks waited for */
+        uint64_t missed;                /**< ticks that passed unseen */
+};
+
+/**
+ * @brief Starts ticking every \a period_us, first tick one period from now
+ *
+ * @param [out] t ticker
+ * @param [in] period_us tick period, at least TICKER_MIN_PERIOD_US
+ *
+ * @return Operation status
+ * @retval 0 OK
+ * @retval -1 error
+ */
+int ticker_start(struct ticker *t, const uint64_t period_us);
+
+/**
+ * @brief Waits for the next tick
+ *
+ * If sampling took longer than a period the ticks in between are
+ * skipped, counted in t->missed and returned.
+ *
+ * @param [in] t ticker
+ *
+ * @return Number of ticks missed since the previous wait
+ * @retval -1 error or interrupted by a signal (errno EINTR)
+ */
+int ticker_wait(struct ticker *t);
+
+/**
+ * @brief Stops ticking
+ *
+ * @param [in] t ticker
+ */
+void ticker_stop(struct ticker *t);
+
+/**
+ * @brief Returns sample timestamp from CLOCK_MONOTONIC_RAW in ns
+ *
+ * Not slewed by NTP, so differences of timestamps are exact durations.
+ */
+uint64_t ticker_now_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TICKER_H__ */
@@ -7,6 +7,7 @@ from sklearn.metrics import mean_absolute_error
 from sklearn.metrics import median_absolute_error
 from sklearn.metrics import r2_score
 from sklearn.externals import joblib
+import export_model
 
 from sklearn.model_selection import train_test_split
 
@@ -15,6 +16,7 @@ from sklearn.preprocessing import StandardScaler
 #加载数据
 #data = "/Users/quximing/Desktop/Muses_output_100clients.csv"
 #data = "/Users/quximing/Desktop/20181024kafkaProduce实验数据整理图片/Muses_output_20181024_kalfaProduce.csv"
+#Muses_output.csv由 ./Muses --dump Muses_output.tlm > Muses_output.csv 生成
 data = "./Muses_output.csv"
 # df = pd.read_excel(data, header=0, parse_cols="A:E")
 df = pd.read_csv(data, header=0, usecols=[0,1,2,3,4,5,6])
@@ -88,6 +90,9 @@ def try_different_method(model):
 
     #save model:
     joblib.dump(model,'GBRT.model')
+    #同时导出Muses可直接加载的二进制模型
+    if isinstance(model, ensemble.GradientBoostingRegressor):
+        export_model.export_model(model, 'GBRT.gbrt')
 
 
 ###########3.具体方法选择##########